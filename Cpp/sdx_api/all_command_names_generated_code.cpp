@@ -0,0 +1,1196 @@
+#include "all_command_names_generated_code.h"
+
+#include "all_commands_generated_code.h"
+
+namespace Sdx
+{
+  namespace Cmd
+  {
+    const std::array<const char*, ALL_COMMAND_NAMES_COUNT>& allCommandNames()
+    {
+      static const std::array<const char*, ALL_COMMAND_NAMES_COUNT> names = {
+        AbortWaitSimulatorState::CmdName,
+        AddDataSet::CmdName,
+        AddEmptySVAntennaModel::CmdName,
+        AddEmptyVehicleAntennaModel::CmdName,
+        AddIntTx::CmdName,
+        AddSVGainPatternOffset::CmdName,
+        AddSVPhasePatternOffset::CmdName,
+        AddSpoofTx::CmdName,
+        AddVehicleGainPatternOffset::CmdName,
+        AddVehiclePhasePatternOffset::CmdName,
+        ApplyDelayInSbas::CmdName,
+        Arm::CmdName,
+        ArmPPS::CmdName,
+        BeginIntTxTrackDefinition::CmdName,
+        BeginRouteDefinition::CmdName,
+        BeginSpoofTxTrackDefinition::CmdName,
+        BeginTrackDefinition::CmdName,
+        BeginVehicleInfo::CmdName,
+        BroadcastConfig::CmdName,
+        CalibFunction::CmdName,
+        CalibratePilotOutput::CmdName,
+        CancelBroadcastConfig::CmdName,
+        ChangeCustomSignalColor::CmdName,
+        ChangeIntTxColor::CmdName,
+        ChangeModulationTargetIQPlayback::CmdName,
+        ChangeModulationTargetInterference::CmdName,
+        ChangeModulationTargetName::CmdName,
+        ChangeModulationTargetSignals::CmdName,
+        ChangeSpoofTxColor::CmdName,
+        ClearAllAntennaChanges::CmdName,
+        ClearAllLOSForSystem::CmdName,
+        ClearAllMessageModifications::CmdName,
+        ClearAllMessageModificationsForNavMsgFamily::CmdName,
+        ClearAllMessageModificationsForSignal::CmdName,
+        ClearAllSbasServiceMessageRegionGroup::CmdName,
+        ClearAutomatePage::CmdName,
+        ClearQzssL1SAugmentations::CmdName,
+        ClearSpoofTxGpuIdx::CmdName,
+        ClearStatusLog::CmdName,
+        ClearVehiculeTrajectory::CmdName,
+        CommandGroup::CmdName,
+        ConnectSerialPortReceiver::CmdName,
+        CopySVAntennaModel::CmdName,
+        CopyVehicleAntennaModel::CmdName,
+        DataFolderResult::CmdName,
+        DeleteDataSet::CmdName,
+        DeleteSVAntennaModel::CmdName,
+        DeleteVehicleAntennaModel::CmdName,
+        DisconnectSerialPortReceiver::CmdName,
+        DuplicateDataSet::CmdName,
+        EnableAlmanacExtrapolationFromEphemeris::CmdName,
+        EnableAutomaticGpuAllocation::CmdName,
+        EnableCnav2Pages::CmdName,
+        EnableDektecAdjustedNoise::CmdName,
+        EnableEachSV::CmdName,
+        EnableEarthMask::CmdName,
+        EnableElevationMaskAbove::CmdName,
+        EnableElevationMaskBelow::CmdName,
+        EnableIntTx::CmdName,
+        EnableIntTxSignal::CmdName,
+        EnableIntTxTrajectorySmoothing::CmdName,
+        EnableIonoOffset::CmdName,
+        EnableLogDownlink::CmdName,
+        EnableLogHILInput::CmdName,
+        EnableLogNmea::CmdName,
+        EnableLogRaw::CmdName,
+        EnableLogRinex::CmdName,
+        EnableLosForEachSV::CmdName,
+        EnableLosForSV::CmdName,
+        EnableMainInstanceSync::CmdName,
+        EnableManualSbasMessageSequence::CmdName,
+        EnableMasterPps::CmdName,
+        EnableMultipath::CmdName,
+        EnableNtpClient::CmdName,
+        EnableOsnmaForEachSV::CmdName,
+        EnableOsnmaForSV::CmdName,
+        EnablePYCodeForEachSV::CmdName,
+        EnablePYCodeForSV::CmdName,
+        EnablePlugin::CmdName,
+        EnableRFOutputForEachSV::CmdName,
+        EnableRFOutputForSV::CmdName,
+        EnableSV::CmdName,
+        EnableSbasFastCorrectionsFor::CmdName,
+        EnableSbasLongTermCorrectionsFor::CmdName,
+        EnableSbasMessages::CmdName,
+        EnableSignalForEachSV::CmdName,
+        EnableSignalForSV::CmdName,
+        EnableSignalStrengthModel::CmdName,
+        EnableSimulationStopAtTrajectoryEnd::CmdName,
+        EnableSlavePps::CmdName,
+        EnableSpoofTx::CmdName,
+        EnableSpoofTxTrajectorySmoothing::CmdName,
+        EnableTrajectorySmoothing::CmdName,
+        EnableWorkerInstanceSync::CmdName,
+        EndIntTxTrackDefinition::CmdName,
+        EndIntTxTrackDefinitionResult::CmdName,
+        EndRouteDefinition::CmdName,
+        EndRouteDefinitionResult::CmdName,
+        EndSpoofTxTrackDefinition::CmdName,
+        EndSpoofTxTrackDefinitionResult::CmdName,
+        EndTrackDefinition::CmdName,
+        EndTrackDefinitionResult::CmdName,
+        EndVehicleInfo::CmdName,
+        ExecuteGpuBenchmark::CmdName,
+        ExecuteGpuBenchmarkResult::CmdName,
+        ExportHilGraphDataToCSV::CmdName,
+        ExportIonoGridErrors::CmdName,
+        ExportIonoGridGIVEI::CmdName,
+        ExportIonoGridMask::CmdName,
+        ExportMerkleTree::CmdName,
+        ExportMessageSequenceToCSV::CmdName,
+        ExportPerformanceDataToCSV::CmdName,
+        ExportSVAntennaModel::CmdName,
+        ExportSbasMessageSequence::CmdName,
+        ExportVehicleAntennaModel::CmdName,
+        ExportWFAntenna::CmdName,
+        FailureResult::CmdName,
+        ForceAttitudeToZero::CmdName,
+        ForceIntTxAttitudeToZero::CmdName,
+        ForceSVGeo::CmdName,
+        ForceSpoofTxAttitudeToZero::CmdName,
+        GetActiveDataSet::CmdName,
+        GetActiveDataSetResult::CmdName,
+        GetAgeOfDataBeiDou::CmdName,
+        GetAgeOfDataBeiDouResult::CmdName,
+        GetAllIntTxID::CmdName,
+        GetAllIntTxIDResult::CmdName,
+        GetAllMerkleTreeID::CmdName,
+        GetAllMerkleTreeIDResult::CmdName,
+        GetAllMessageModificationIdsForNavMsgFamily::CmdName,
+        GetAllMessageModificationIdsForNavMsgFamilyResult::CmdName,
+        GetAllMessageModificationIdsForSignal::CmdName,
+        GetAllMessageModificationIdsForSignalResult::CmdName,
+        GetAllModulationTargets::CmdName,
+        GetAllModulationTargetsResult::CmdName,
+        GetAllMultipathForResult::CmdName,
+        GetAllMultipathForSV::CmdName,
+        GetAllMultipathForSignal::CmdName,
+        GetAllMultipathForSystem::CmdName,
+        GetAllPowerForSV::CmdName,
+        GetAllPowerForSVResult::CmdName,
+        GetAllPseudorangeRampForSV::CmdName,
+        GetAllPseudorangeRampForSVResult::CmdName,
+        GetAllSVAntennaNames::CmdName,
+        GetAllSVAntennaNamesResult::CmdName,
+        GetAllSatellitesPseudorangeNoiseGaussMarkov::CmdName,
+        GetAllSatellitesPseudorangeNoiseOffset::CmdName,
+        GetAllSatellitesPseudorangeNoiseSineWave::CmdName,
+        GetAllSignalsFromIntTx::CmdName,
+        GetAllSignalsFromIntTxResult::CmdName,
+        GetAllSpoofTxID::CmdName,
+        GetAllSpoofTxIDResult::CmdName,
+        GetAllVehicleAntennaNames::CmdName,
+        GetAllVehicleAntennaNamesResult::CmdName,
+        GetAlmanacInitialUploadTimeOffset::CmdName,
+        GetAlmanacInitialUploadTimeOffsetResult::CmdName,
+        GetAlmanacUploadTimeInterval::CmdName,
+        GetAlmanacUploadTimeIntervalResult::CmdName,
+        GetAntennaChange::CmdName,
+        GetAntennaChangeResult::CmdName,
+        GetBeiDouAutonomousHealthForSV::CmdName,
+        GetBeiDouAutonomousHealthForSVResult::CmdName,
+        GetBeiDouCNavHealthInfoForSV::CmdName,
+        GetBeiDouCNavHealthInfoForSVResult::CmdName,
+        GetBeiDouEphBoolParamForEachSV::CmdName,
+        GetBeiDouEphBoolParamForEachSVResult::CmdName,
+        GetBeiDouEphBoolParamForSV::CmdName,
+        GetBeiDouEphBoolParamForSVResult::CmdName,
+        GetBeiDouEphDoubleParamForEachSV::CmdName,
+        GetBeiDouEphDoubleParamForEachSVResult::CmdName,
+        GetBeiDouEphDoubleParamForSV::CmdName,
+        GetBeiDouEphDoubleParamForSVResult::CmdName,
+        GetBeiDouEphemerisBoolParams::CmdName,
+        GetBeiDouEphemerisDoubleParams::CmdName,
+        GetBeiDouHealthInfoForSV::CmdName,
+        GetBeiDouHealthInfoForSVResult::CmdName,
+        GetBeiDouHealthStatusForSV::CmdName,
+        GetBeiDouHealthStatusForSVResult::CmdName,
+        GetCnav2PagesEnabled::CmdName,
+        GetCnav2PagesEnabledResult::CmdName,
+        GetComputerSystemTimeSinceEpochAtPps0::CmdName,
+        GetComputerSystemTimeSinceEpochAtPps0Result::CmdName,
+        GetConfigBroadcastFilter::CmdName,
+        GetConfigBroadcastFilterResult::CmdName,
+        GetConfigBroadcastOnStart::CmdName,
+        GetConfigBroadcastOnStartResult::CmdName,
+        GetConfigPaths::CmdName,
+        GetConfigPathsResult::CmdName,
+        GetConstellationParameterForEachSV::CmdName,
+        GetConstellationParameterForEachSVResult::CmdName,
+        GetConstellationParameterForSV::CmdName,
+        GetConstellationParameterForSVResult::CmdName,
+        GetCrossAuthenticatedSatellitesForSV::CmdName,
+        GetCrossAuthenticatedSatellitesForSVResult::CmdName,
+        GetCurrentConfigPath::CmdName,
+        GetCurrentConfigPathResult::CmdName,
+        GetCurrentPropagationModel::CmdName,
+        GetCurrentPropagationModelResult::CmdName,
+        GetDataFolder::CmdName,
+        GetDataSetAssignation::CmdName,
+        GetDataSetAssignationResult::CmdName,
+        GetDefaultIntTxPersistence::CmdName,
+        GetDefaultIntTxPersistenceResult::CmdName,
+        GetDefaultVehicleAntennaModel::CmdName,
+        GetDefaultVehicleAntennaModelResult::CmdName,
+        GetDuration::CmdName,
+        GetDurationResult::CmdName,
+        GetDynamicRangeOffset::CmdName,
+        GetDynamicRangeOffsetResult::CmdName,
+        GetEffectiveIonisationLevelCoefficient::CmdName,
+        GetEffectiveIonisationLevelCoefficientResult::CmdName,
+        GetElevationAzimuthForEachSV::CmdName,
+        GetElevationAzimuthForEachSVResult::CmdName,
+        GetElevationAzimuthForSV::CmdName,
+        GetElevationAzimuthForSVResult::CmdName,
+        GetElevationMaskAbove::CmdName,
+        GetElevationMaskAboveResult::CmdName,
+        GetElevationMaskBelow::CmdName,
+        GetElevationMaskBelowResult::CmdName,
+        GetEnabledSignalsForSV::CmdName,
+        GetEnabledSignalsForSVResult::CmdName,
+        GetEncryptionLibraryPath::CmdName,
+        GetEncryptionLibraryPathResult::CmdName,
+        GetEngineLatency::CmdName,
+        GetEngineLatencyResult::CmdName,
+        GetEphemerisErrorForSV::CmdName,
+        GetEphemerisErrorForSVResult::CmdName,
+        GetEphemerisReferenceTime::CmdName,
+        GetEphemerisReferenceTimeForSV::CmdName,
+        GetEphemerisReferenceTimeForSVResult::CmdName,
+        GetEphemerisTocOffset::CmdName,
+        GetEphemerisTocOffsetResult::CmdName,
+        GetEphemerisUpdateInterval::CmdName,
+        GetEphemerisUpdateIntervalResult::CmdName,
+        GetGalileoDataHealthForSV::CmdName,
+        GetGalileoDataHealthForSVResult::CmdName,
+        GetGalileoEphDoubleParamForEachSV::CmdName,
+        GetGalileoEphDoubleParamForEachSVResult::CmdName,
+        GetGalileoEphDoubleParamForSV::CmdName,
+        GetGalileoEphDoubleParamForSVResult::CmdName,
+        GetGalileoEphemerisDoubleParams::CmdName,
+        GetGalileoFnavSatelliteK::CmdName,
+        GetGalileoFnavSatelliteKResult::CmdName,
+        GetGalileoSignalHealthForSV::CmdName,
+        GetGalileoSignalHealthForSVResult::CmdName,
+        GetGaussianNoisePowerDensityOffset::CmdName,
+        GetGaussianNoisePowerDensityOffsetResult::CmdName,
+        GetGaussianNoiseSeed::CmdName,
+        GetGaussianNoiseSeedResult::CmdName,
+        GetGlobalPowerOffset::CmdName,
+        GetGlobalPowerOffsetResult::CmdName,
+        GetGlonassAlmanacUnhealthyFlagForSV::CmdName,
+        GetGlonassAlmanacUnhealthyFlagForSVResult::CmdName,
+        GetGlonassDoubleParams::CmdName,
+        GetGlonassEphDoubleParamForEachSV::CmdName,
+        GetGlonassEphDoubleParamForEachSVResult::CmdName,
+        GetGlonassEphDoubleParamForSV::CmdName,
+        GetGlonassEphDoubleParamForSVResult::CmdName,
+        GetGlonassEphemerisHealthFlagForSV::CmdName,
+        GetGlonassEphemerisHealthFlagForSVResult::CmdName,
+        GetGlonassFrequencyNumberForEachSV::CmdName,
+        GetGlonassFrequencyNumberForEachSVResult::CmdName,
+        GetGpsAntiSpoofingFlagForSV::CmdName,
+        GetGpsAntiSpoofingFlagForSVResult::CmdName,
+        GetGpsCNavAlertFlagToSV::CmdName,
+        GetGpsCNavAlertFlagToSVResult::CmdName,
+        GetGpsConfigurationCodeForSV::CmdName,
+        GetGpsConfigurationCodeForSVResult::CmdName,
+        GetGpsConfigurationForEachSV::CmdName,
+        GetGpsConfigurationForEachSVResult::CmdName,
+        GetGpsDataHealthForSV::CmdName,
+        GetGpsDataHealthForSVResult::CmdName,
+        GetGpsEphBoolParamForEachSV::CmdName,
+        GetGpsEphBoolParamForEachSVResult::CmdName,
+        GetGpsEphBoolParamForSV::CmdName,
+        GetGpsEphBoolParamForSVResult::CmdName,
+        GetGpsEphDoubleParamForEachSV::CmdName,
+        GetGpsEphDoubleParamForEachSVResult::CmdName,
+        GetGpsEphDoubleParamForSV::CmdName,
+        GetGpsEphDoubleParamForSVResult::CmdName,
+        GetGpsEphemerisBoolParams::CmdName,
+        GetGpsEphemerisDoubleParams::CmdName,
+        GetGpsL1HealthForSV::CmdName,
+        GetGpsL1HealthForSVResult::CmdName,
+        GetGpsL1cHealthForSV::CmdName,
+        GetGpsL1cHealthForSVResult::CmdName,
+        GetGpsL2HealthForSV::CmdName,
+        GetGpsL2HealthForSVResult::CmdName,
+        GetGpsL5HealthForSV::CmdName,
+        GetGpsL5HealthForSVResult::CmdName,
+        GetGpsNavAlertFlagForSV::CmdName,
+        GetGpsNavAlertFlagForSVResult::CmdName,
+        GetGpsSVConfigurationForAllSat::CmdName,
+        GetGpsSignalHealthForSV::CmdName,
+        GetGpsSignalHealthForSVResult::CmdName,
+        GetGpsStartTime::CmdName,
+        GetGpsStartTimeResult::CmdName,
+        GetGpsTimingReceiver::CmdName,
+        GetGpsTimingReceiverResult::CmdName,
+        GetGpu::CmdName,
+        GetGpuResult::CmdName,
+        GetHilExtrapolationState::CmdName,
+        GetHilExtrapolationStateResult::CmdName,
+        GetHilPort::CmdName,
+        GetIntTx::CmdName,
+        GetIntTxAWGN::CmdName,
+        GetIntTxAWGNResult::CmdName,
+        GetIntTxAntenna::CmdName,
+        GetIntTxAntennaOffset::CmdName,
+        GetIntTxAntennaOffsetResult::CmdName,
+        GetIntTxAntennaResult::CmdName,
+        GetIntTxBOC::CmdName,
+        GetIntTxBOCResult::CmdName,
+        GetIntTxBPSK::CmdName,
+        GetIntTxBPSKResult::CmdName,
+        GetIntTxCW::CmdName,
+        GetIntTxCWResult::CmdName,
+        GetIntTxChirp::CmdName,
+        GetIntTxChirpResult::CmdName,
+        GetIntTxCircular::CmdName,
+        GetIntTxCircularResult::CmdName,
+        GetIntTxColor::CmdName,
+        GetIntTxColorResult::CmdName,
+        GetIntTxFix::CmdName,
+        GetIntTxFixEcef::CmdName,
+        GetIntTxFixEcefResult::CmdName,
+        GetIntTxFixResult::CmdName,
+        GetIntTxHiddenOnMap::CmdName,
+        GetIntTxHiddenOnMapResult::CmdName,
+        GetIntTxIqFile::CmdName,
+        GetIntTxIqFileResult::CmdName,
+        GetIntTxPersistence::CmdName,
+        GetIntTxPersistenceResult::CmdName,
+        GetIntTxPulse::CmdName,
+        GetIntTxPulseResult::CmdName,
+        GetIntTxResult::CmdName,
+        GetIntTxTrajectory::CmdName,
+        GetIntTxTrajectoryResult::CmdName,
+        GetIntTxVehicleType::CmdName,
+        GetIntTxVehicleTypeResult::CmdName,
+        GetInterModulation::CmdName,
+        GetInterModulationResult::CmdName,
+        GetIonoAlpha::CmdName,
+        GetIonoAlphaResult::CmdName,
+        GetIonoBdgimAlpha::CmdName,
+        GetIonoBdgimAlphaResult::CmdName,
+        GetIonoBeta::CmdName,
+        GetIonoBetaResult::CmdName,
+        GetIonoGridError::CmdName,
+        GetIonoGridErrorAll::CmdName,
+        GetIonoGridErrorAllResult::CmdName,
+        GetIonoGridErrorResult::CmdName,
+        GetIonoGridGIVEI::CmdName,
+        GetIonoGridGIVEIAll::CmdName,
+        GetIonoGridGIVEIAllResult::CmdName,
+        GetIonoGridGIVEIResult::CmdName,
+        GetIonoGridMask::CmdName,
+        GetIonoGridMaskAll::CmdName,
+        GetIonoGridMaskAllResult::CmdName,
+        GetIonoGridMaskResult::CmdName,
+        GetIonoModel::CmdName,
+        GetIonoModelResult::CmdName,
+        GetIssueOfData::CmdName,
+        GetIssueOfDataBeiDou::CmdName,
+        GetIssueOfDataBeiDouResult::CmdName,
+        GetIssueOfDataGalileo::CmdName,
+        GetIssueOfDataGalileoResult::CmdName,
+        GetIssueOfDataNavIC::CmdName,
+        GetIssueOfDataNavICResult::CmdName,
+        GetIssueOfDataQzss::CmdName,
+        GetIssueOfDataQzssResult::CmdName,
+        GetIssueOfDataResult::CmdName,
+        GetLastLeapSecondDate::CmdName,
+        GetLastLeapSecondDateResult::CmdName,
+        GetLeapSecondFuture::CmdName,
+        GetLeapSecondFutureResult::CmdName,
+        GetLogNmeaRate::CmdName,
+        GetLogRawRate::CmdName,
+        GetMainInstanceStatus::CmdName,
+        GetMainInstanceStatusResult::CmdName,
+        GetManualPowerOffsetForSV::CmdName,
+        GetManualPowerOffsetForSVResult::CmdName,
+        GetMasterStatus::CmdName,
+        GetMasterStatusResult::CmdName,
+        GetMerkleTreeParameters::CmdName,
+        GetMerkleTreeParametersResult::CmdName,
+        GetMerkleTreeXML::CmdName,
+        GetMerkleTreeXMLResult::CmdName,
+        GetMessageModificationToBeiDouCNav1::CmdName,
+        GetMessageModificationToBeiDouCNav1Result::CmdName,
+        GetMessageModificationToBeiDouCNav2::CmdName,
+        GetMessageModificationToBeiDouCNav2Result::CmdName,
+        GetMessageModificationToBeiDouD1Nav::CmdName,
+        GetMessageModificationToBeiDouD1NavResult::CmdName,
+        GetMessageModificationToBeiDouD2Nav::CmdName,
+        GetMessageModificationToBeiDouD2NavResult::CmdName,
+        GetMessageModificationToGalileoCNav::CmdName,
+        GetMessageModificationToGalileoCNavResult::CmdName,
+        GetMessageModificationToGalileoFNav::CmdName,
+        GetMessageModificationToGalileoFNavResult::CmdName,
+        GetMessageModificationToGalileoINav::CmdName,
+        GetMessageModificationToGalileoINavResult::CmdName,
+        GetMessageModificationToGlonassNav::CmdName,
+        GetMessageModificationToGlonassNavResult::CmdName,
+        GetMessageModificationToGpsCNav::CmdName,
+        GetMessageModificationToGpsCNav2::CmdName,
+        GetMessageModificationToGpsCNav2Result::CmdName,
+        GetMessageModificationToGpsCNavResult::CmdName,
+        GetMessageModificationToGpsLNav::CmdName,
+        GetMessageModificationToGpsLNavResult::CmdName,
+        GetMessageModificationToNavICNav::CmdName,
+        GetMessageModificationToNavICNavResult::CmdName,
+        GetMessageModificationToPulsarNav::CmdName,
+        GetMessageModificationToPulsarNavResult::CmdName,
+        GetMessageModificationToPulsarX1::CmdName,
+        GetMessageModificationToPulsarX1Result::CmdName,
+        GetMessageModificationToPulsarX5::CmdName,
+        GetMessageModificationToPulsarX5Result::CmdName,
+        GetMessageModificationToQzssCNav::CmdName,
+        GetMessageModificationToQzssCNav2::CmdName,
+        GetMessageModificationToQzssCNav2Result::CmdName,
+        GetMessageModificationToQzssCNavResult::CmdName,
+        GetMessageModificationToQzssLNav::CmdName,
+        GetMessageModificationToQzssLNavResult::CmdName,
+        GetMessageModificationToQzssSlas::CmdName,
+        GetMessageModificationToQzssSlasResult::CmdName,
+        GetMessageModificationToSbasNav::CmdName,
+        GetMessageModificationToSbasNavResult::CmdName,
+        GetMessageSequence::CmdName,
+        GetMessageSequenceResult::CmdName,
+        GetModulationTarget::CmdName,
+        GetModulationTargetIQPlayback::CmdName,
+        GetModulationTargetIQPlaybackResult::CmdName,
+        GetModulationTargetInterferences::CmdName,
+        GetModulationTargetInterferencesResult::CmdName,
+        GetModulationTargetResult::CmdName,
+        GetModulationTargetSignals::CmdName,
+        GetModulationTargetSignalsResult::CmdName,
+        GetMultipathForID::CmdName,
+        GetMultipathForIDResult::CmdName,
+        GetN310LocalOscillatorSource::CmdName,
+        GetN310LocalOscillatorSourceResult::CmdName,
+        GetNavICEphDoubleParamForEachSV::CmdName,
+        GetNavICEphDoubleParamForEachSVResult::CmdName,
+        GetNavICEphDoubleParamForSV::CmdName,
+        GetNavICEphDoubleParamForSVResult::CmdName,
+        GetNavICEphemerisDoubleParam::CmdName,
+        GetNavICEphemerisDoubleParams::CmdName,
+        GetNavICL1HealthForSV::CmdName,
+        GetNavICL1HealthForSVResult::CmdName,
+        GetNavICL5HealthForSV::CmdName,
+        GetNavICL5HealthForSVResult::CmdName,
+        GetNavICNavAlertFlagForSV::CmdName,
+        GetNavICNavAlertFlagForSVResult::CmdName,
+        GetNavICSHealthForSV::CmdName,
+        GetNavICSHealthForSVResult::CmdName,
+        GetNavICSatelliteL5Health::CmdName,
+        GetNavICSatelliteNavAlertFlag::CmdName,
+        GetNmeaLoggerSentences::CmdName,
+        GetNmeaLoggerSentencesResult::CmdName,
+        GetNmeaLoggerSerialPortDelay::CmdName,
+        GetNmeaLoggerSerialPortDelayResult::CmdName,
+        GetNtpServer::CmdName,
+        GetNtpServerResult::CmdName,
+        GetOfficialLeapSecond::CmdName,
+        GetOfficialLeapSecondResult::CmdName,
+        GetOsnmaMacFunction::CmdName,
+        GetOsnmaMacFunctionResult::CmdName,
+        GetOsnmaMacLtId::CmdName,
+        GetOsnmaMacLtIdResult::CmdName,
+        GetOsnmaTagSize::CmdName,
+        GetOsnmaTagSizeResult::CmdName,
+        GetOsnmaTeslaHashFunction::CmdName,
+        GetOsnmaTeslaHashFunctionResult::CmdName,
+        GetOsnmaTeslaKeySize::CmdName,
+        GetOsnmaTeslaKeySizeResult::CmdName,
+        GetPerturbations::CmdName,
+        GetPerturbationsForAllSat::CmdName,
+        GetPerturbationsForAllSatResult::CmdName,
+        GetPerturbationsResult::CmdName,
+        GetPlugins::CmdName,
+        GetPluginsResult::CmdName,
+        GetPowerGlobalOffset::CmdName,
+        GetPowerOffset::CmdName,
+        GetPowerSbasOffset::CmdName,
+        GetPowerSbasOffsetResult::CmdName,
+        GetPrnForEachSV::CmdName,
+        GetPrnForEachSVResult::CmdName,
+        GetPrnOfSVID::CmdName,
+        GetPrnOfSVIDResult::CmdName,
+        GetPropagationModelParameters::CmdName,
+        GetPropagationModelParametersResult::CmdName,
+        GetPseudorangeNoiseGaussMarkovForEachSV::CmdName,
+        GetPseudorangeNoiseGaussMarkovForEachSVResult::CmdName,
+        GetPseudorangeNoiseGaussMarkovForSV::CmdName,
+        GetPseudorangeNoiseGaussMarkovForSVResult::CmdName,
+        GetPseudorangeNoiseOffsetForEachSV::CmdName,
+        GetPseudorangeNoiseOffsetForEachSVResult::CmdName,
+        GetPseudorangeNoiseOffsetForSV::CmdName,
+        GetPseudorangeNoiseOffsetForSVResult::CmdName,
+        GetPseudorangeNoiseSineWaveForEachSV::CmdName,
+        GetPseudorangeNoiseSineWaveForEachSVResult::CmdName,
+        GetPseudorangeNoiseSineWaveForSV::CmdName,
+        GetPseudorangeNoiseSineWaveForSVResult::CmdName,
+        GetPseudorangeRampForSV::CmdName,
+        GetPseudorangeRampForSVResult::CmdName,
+        GetPulsarX1AccuracyIntegrityForSV::CmdName,
+        GetPulsarX1AccuracyIntegrityForSVResult::CmdName,
+        GetPulsarX1HealthForSV::CmdName,
+        GetPulsarX1HealthForSVResult::CmdName,
+        GetPulsarX5AccuracyIntegrityForSV::CmdName,
+        GetPulsarX5AccuracyIntegrityForSVResult::CmdName,
+        GetPulsarX5HealthForSV::CmdName,
+        GetPulsarX5HealthForSVResult::CmdName,
+        GetQzssEphBoolParamForEachSV::CmdName,
+        GetQzssEphBoolParamForEachSVResult::CmdName,
+        GetQzssEphBoolParamForSV::CmdName,
+        GetQzssEphBoolParamForSVResult::CmdName,
+        GetQzssEphDoubleParamForEachSV::CmdName,
+        GetQzssEphDoubleParamForEachSVResult::CmdName,
+        GetQzssEphDoubleParamForSV::CmdName,
+        GetQzssEphDoubleParamForSVResult::CmdName,
+        GetQzssEphemerisBoolParam::CmdName,
+        GetQzssEphemerisBoolParams::CmdName,
+        GetQzssEphemerisDoubleParam::CmdName,
+        GetQzssEphemerisDoubleParams::CmdName,
+        GetQzssL1DataHealthForSV::CmdName,
+        GetQzssL1DataHealthForSVResult::CmdName,
+        GetQzssL1HealthForSV::CmdName,
+        GetQzssL1HealthForSVResult::CmdName,
+        GetQzssL1SAugmentation::CmdName,
+        GetQzssL1SAugmentationResult::CmdName,
+        GetQzssL1SAugmentations::CmdName,
+        GetQzssL1SAugmentationsResult::CmdName,
+        GetQzssL1cHealthForSV::CmdName,
+        GetQzssL1cHealthForSVResult::CmdName,
+        GetQzssL2HealthForSV::CmdName,
+        GetQzssL2HealthForSVResult::CmdName,
+        GetQzssL5HealthForSV::CmdName,
+        GetQzssL5HealthForSVResult::CmdName,
+        GetQzssL6HealthForSV::CmdName,
+        GetQzssL6HealthForSVResult::CmdName,
+        GetQzssNavAlertFlagForSV::CmdName,
+        GetQzssNavAlertFlagForSVResult::CmdName,
+        GetQzssSatelliteL1DataHealth::CmdName,
+        GetQzssSatelliteL1Health::CmdName,
+        GetQzssSatelliteL1cHealth::CmdName,
+        GetQzssSatelliteL2Health::CmdName,
+        GetQzssSatelliteL5Health::CmdName,
+        GetQzssSatelliteNavAlertFlag::CmdName,
+        GetRawDataLoggingInterval::CmdName,
+        GetSVAntennaGain::CmdName,
+        GetSVAntennaGainResult::CmdName,
+        GetSVAntennaModelForEachSV::CmdName,
+        GetSVAntennaModelForEachSVResult::CmdName,
+        GetSVAntennaModelForSV::CmdName,
+        GetSVAntennaModelForSVResult::CmdName,
+        GetSVAntennaPhaseOffset::CmdName,
+        GetSVAntennaPhaseOffsetResult::CmdName,
+        GetSVDataUpdateMode::CmdName,
+        GetSVDataUpdateModeResult::CmdName,
+        GetSVGainPatternOffset::CmdName,
+        GetSVGainPatternOffsetResult::CmdName,
+        GetSVIDsOfPrn::CmdName,
+        GetSVIDsOfPrnResult::CmdName,
+        GetSVPhasePatternOffset::CmdName,
+        GetSVPhasePatternOffsetResult::CmdName,
+        GetSVType::CmdName,
+        GetSVTypeResult::CmdName,
+        GetSbasDeltaUdreiOutsideOfRegions::CmdName,
+        GetSbasDeltaUdreiOutsideOfRegionsResult::CmdName,
+        GetSbasEphParamsForSV::CmdName,
+        GetSbasEphParamsForSVResult::CmdName,
+        GetSbasEphemerisReferenceTimeForSV::CmdName,
+        GetSbasEphemerisReferenceTimeForSVResult::CmdName,
+        GetSbasMessageUpdateInterval::CmdName,
+        GetSbasMessageUpdateIntervalResult::CmdName,
+        GetSbasMessagesEnabled::CmdName,
+        GetSbasMessagesEnabledResult::CmdName,
+        GetSbasMonitoredSystems::CmdName,
+        GetSbasMonitoredSystemsResult::CmdName,
+        GetSbasServiceMessageRegionGroup::CmdName,
+        GetSbasServiceMessageRegionGroupResult::CmdName,
+        GetSignalFilterAssignation::CmdName,
+        GetSignalFilterAssignationResult::CmdName,
+        GetSignalFromIntTx::CmdName,
+        GetSignalFromIntTxResult::CmdName,
+        GetSignalPowerOffset::CmdName,
+        GetSignalPowerOffsetResult::CmdName,
+        GetSimulationElapsedTime::CmdName,
+        GetSimulatorState::CmdName,
+        GetSlaveStatus::CmdName,
+        GetSlaveStatusResult::CmdName,
+        GetSpoofTx::CmdName,
+        GetSpoofTxAntenna::CmdName,
+        GetSpoofTxAntennaOffset::CmdName,
+        GetSpoofTxAntennaOffsetResult::CmdName,
+        GetSpoofTxAntennaResult::CmdName,
+        GetSpoofTxCircular::CmdName,
+        GetSpoofTxCircularResult::CmdName,
+        GetSpoofTxColor::CmdName,
+        GetSpoofTxColorResult::CmdName,
+        GetSpoofTxFix::CmdName,
+        GetSpoofTxFixEcef::CmdName,
+        GetSpoofTxFixEcefResult::CmdName,
+        GetSpoofTxFixResult::CmdName,
+        GetSpoofTxRemoteAddress::CmdName,
+        GetSpoofTxRemoteAddressResult::CmdName,
+        GetSpoofTxResult::CmdName,
+        GetSpoofTxTrajectory::CmdName,
+        GetSpoofTxTrajectoryResult::CmdName,
+        GetSpoofTxVehicleType::CmdName,
+        GetSpoofTxVehicleTypeResult::CmdName,
+        GetStartTimeMode::CmdName,
+        GetStartTimeModeResult::CmdName,
+        GetStartTimeOffset::CmdName,
+        GetStartTimeOffsetResult::CmdName,
+        GetStatusLog::CmdName,
+        GetStatusLogResult::CmdName,
+        GetStreamingBuffer::CmdName,
+        GetStreamingBufferResult::CmdName,
+        GetSyncTime::CmdName,
+        GetSyncTimeMainInstance::CmdName,
+        GetSyncTimeMainInstanceResult::CmdName,
+        GetSyncTimeMaster::CmdName,
+        GetSyncTimeResult::CmdName,
+        GetTransmittedPrnForSV::CmdName,
+        GetTransmittedPrnForSVResult::CmdName,
+        GetTropoModel::CmdName,
+        GetTropoModelResult::CmdName,
+        GetUdreiForEachSV::CmdName,
+        GetUdreiForEachSVResult::CmdName,
+        GetUdreiForSV::CmdName,
+        GetUdreiForSVResult::CmdName,
+        GetVehicleAntennaGain::CmdName,
+        GetVehicleAntennaGainResult::CmdName,
+        GetVehicleAntennaModel::CmdName,
+        GetVehicleAntennaModelResult::CmdName,
+        GetVehicleAntennaOffset::CmdName,
+        GetVehicleAntennaOffsetResult::CmdName,
+        GetVehicleAntennaPhaseOffset::CmdName,
+        GetVehicleAntennaPhaseOffsetResult::CmdName,
+        GetVehicleGainPatternOffset::CmdName,
+        GetVehicleGainPatternOffsetResult::CmdName,
+        GetVehiclePhasePatternOffset::CmdName,
+        GetVehiclePhasePatternOffsetResult::CmdName,
+        GetVehicleTrajectory::CmdName,
+        GetVehicleTrajectoryCircular::CmdName,
+        GetVehicleTrajectoryCircularResult::CmdName,
+        GetVehicleTrajectoryFix::CmdName,
+        GetVehicleTrajectoryFixEcef::CmdName,
+        GetVehicleTrajectoryFixEcefResult::CmdName,
+        GetVehicleTrajectoryFixResult::CmdName,
+        GetVehicleTrajectoryOrbit::CmdName,
+        GetVehicleTrajectoryOrbitResult::CmdName,
+        GetVehicleTrajectoryResult::CmdName,
+        GetVehicleType::CmdName,
+        GetVehicleTypeResult::CmdName,
+        GetVersion::CmdName,
+        GetVisibleSV::CmdName,
+        GetVisibleSVResult::CmdName,
+        GetWFAntennaElementModel::CmdName,
+        GetWFAntennaElementModelResult::CmdName,
+        GetWFAntennaElementOffset::CmdName,
+        GetWFAntennaElementOffsetResult::CmdName,
+        GetWFAntennaElementPhasePatternOffset::CmdName,
+        GetWFAntennaElementPhasePatternOffsetResult::CmdName,
+        GetWFAntennaGain::CmdName,
+        GetWFAntennaGainResult::CmdName,
+        GetWFAntennaOffset::CmdName,
+        GetWFAntennaOffsetResult::CmdName,
+        GetWFElement::CmdName,
+        GetWFElementResult::CmdName,
+        GetWorkerInstanceStatus::CmdName,
+        GetWorkerInstanceStatusResult::CmdName,
+        HilPortResult::CmdName,
+        ImportCCIRFilesFromDirectory::CmdName,
+        ImportConstellationParameters::CmdName,
+        ImportGlonassAlmanac::CmdName,
+        ImportIonoGridErrors::CmdName,
+        ImportIonoGridGIVEI::CmdName,
+        ImportIonoGridMask::CmdName,
+        ImportIonoParameters::CmdName,
+        ImportMODIPFile::CmdName,
+        ImportNmeaIntTxTrack::CmdName,
+        ImportNmeaSpoofTxTrack::CmdName,
+        ImportNmeaTrack::CmdName,
+        ImportSVAntennaModel::CmdName,
+        ImportVehicleAntennaModel::CmdName,
+        ImportWFAntenna::CmdName,
+        IsAlmanacExtrapolationFromEphemerisEnabled::CmdName,
+        IsAlmanacExtrapolationFromEphemerisEnabledResult::CmdName,
+        IsAttitudeToZeroForced::CmdName,
+        IsAttitudeToZeroForcedResult::CmdName,
+        IsAutomaticGpuAllocationEnabled::CmdName,
+        IsAutomaticGpuAllocationEnabledResult::CmdName,
+        IsDektecAdjustedNoiseEnabled::CmdName,
+        IsDektecAdjustedNoiseEnabledResult::CmdName,
+        IsDelayAppliedInSbas::CmdName,
+        IsDelayAppliedInSbasResult::CmdName,
+        IsEachSVEnabled::CmdName,
+        IsEachSVEnabledResult::CmdName,
+        IsEarthMaskEnabled::CmdName,
+        IsEarthMaskEnabledResult::CmdName,
+        IsElevationMaskAboveEnabled::CmdName,
+        IsElevationMaskAboveEnabledResult::CmdName,
+        IsElevationMaskBelowEnabled::CmdName,
+        IsElevationMaskBelowEnabledResult::CmdName,
+        IsIntTxAttitudeToZeroForced::CmdName,
+        IsIntTxAttitudeToZeroForcedResult::CmdName,
+        IsIntTxIgnoreRxAntennaGainPattern::CmdName,
+        IsIntTxIgnoreRxAntennaGainPatternResult::CmdName,
+        IsIntTxIgnoreRxAntennaPhasePattern::CmdName,
+        IsIntTxIgnoreRxAntennaPhasePatternResult::CmdName,
+        IsIntTxTrajectorySmoothingEnabled::CmdName,
+        IsIntTxTrajectorySmoothingEnabledResult::CmdName,
+        IsIonoOffsetEnabled::CmdName,
+        IsIonoOffsetEnabledResult::CmdName,
+        IsLOSEnabledForEachSV::CmdName,
+        IsLOSEnabledForEachSVResult::CmdName,
+        IsLogDownlinkEnabled::CmdName,
+        IsLogDownlinkEnabledResult::CmdName,
+        IsLogHILInputEnabled::CmdName,
+        IsLogHILInputEnabledResult::CmdName,
+        IsLogNmeaEnabled::CmdName,
+        IsLogNmeaEnabledResult::CmdName,
+        IsLogRawEnabled::CmdName,
+        IsLogRawEnabledResult::CmdName,
+        IsLogRinexEnabled::CmdName,
+        IsLogRinexEnabledResult::CmdName,
+        IsLosEnabledForSV::CmdName,
+        IsLosEnabledForSVResult::CmdName,
+        IsManualSbasMessageSequence::CmdName,
+        IsManualSbasMessageSequenceResult::CmdName,
+        IsMapAnalysisEnabled::CmdName,
+        IsMapAnalysisEnabledResult::CmdName,
+        IsNtpClientEnabled::CmdName,
+        IsNtpClientEnabledResult::CmdName,
+        IsOsnmaEnabledForEachSV::CmdName,
+        IsOsnmaEnabledForEachSVResult::CmdName,
+        IsOsnmaEnabledForSV::CmdName,
+        IsOsnmaEnabledForSVResult::CmdName,
+        IsPYCodeEnabledForEachSV::CmdName,
+        IsPYCodeEnabledForEachSVResult::CmdName,
+        IsPYCodeEnabledForSV::CmdName,
+        IsPYCodeEnabledForSVResult::CmdName,
+        IsPluginEnabled::CmdName,
+        IsPluginEnabledResult::CmdName,
+        IsPropagationDelayEnabled::CmdName,
+        IsPropagationDelayEnabledResult::CmdName,
+        IsRFOutputEnabled::CmdName,
+        IsRFOutputEnabledForEachSV::CmdName,
+        IsRFOutputEnabledForEachSVResult::CmdName,
+        IsRFOutputEnabledResult::CmdName,
+        IsSVEnabled::CmdName,
+        IsSVEnabledResult::CmdName,
+        IsSVForcedGeo::CmdName,
+        IsSVForcedGeoResult::CmdName,
+        IsSatMotionFixed::CmdName,
+        IsSatMotionFixedResult::CmdName,
+        IsSbasFastCorrectionsEnabledFor::CmdName,
+        IsSbasFastCorrectionsEnabledForResult::CmdName,
+        IsSbasLongTermCorrectionsEnabledFor::CmdName,
+        IsSbasLongTermCorrectionsEnabledForResult::CmdName,
+        IsSignalEnabledForEachSV::CmdName,
+        IsSignalEnabledForEachSVResult::CmdName,
+        IsSignalEnabledForSV::CmdName,
+        IsSignalEnabledForSVResult::CmdName,
+        IsSignalStrengthModelEnabled::CmdName,
+        IsSignalStrengthModelEnabledResult::CmdName,
+        IsSimStopWhenCommandFailEnabled::CmdName,
+        IsSimStopWhenCommandFailEnabledResult::CmdName,
+        IsSimulationStopAtTrajectoryEndEnabled::CmdName,
+        IsSimulationStopAtTrajectoryEndEnabledResult::CmdName,
+        IsSpectrumVisible::CmdName,
+        IsSpectrumVisibleResult::CmdName,
+        IsSpoofTxAttitudeToZeroForced::CmdName,
+        IsSpoofTxAttitudeToZeroForcedResult::CmdName,
+        IsSpoofTxIgnoreRxAntennaGainPattern::CmdName,
+        IsSpoofTxIgnoreRxAntennaGainPatternResult::CmdName,
+        IsSpoofTxIgnoreRxAntennaPhasePattern::CmdName,
+        IsSpoofTxIgnoreRxAntennaPhasePatternResult::CmdName,
+        IsSpoofTxTrajectorySmoothingEnabled::CmdName,
+        IsSpoofTxTrajectorySmoothingEnabledResult::CmdName,
+        IsStopMainInstanceWhenWorkerInstanceStop::CmdName,
+        IsStopMainInstanceWhenWorkerInstanceStopResult::CmdName,
+        IsStopMasterWhenSlaveStop::CmdName,
+        IsStopMasterWhenSlaveStopResult::CmdName,
+        IsTrajectoryCompleted::CmdName,
+        IsTrajectoryCompletedResult::CmdName,
+        IsTrajectorySmoothingEnabled::CmdName,
+        IsTrajectorySmoothingEnabledResult::CmdName,
+        IsTransmitMessage2InSbasMessage0::CmdName,
+        IsTransmitMessage2InSbasMessage0Result::CmdName,
+        IsUsingVelocityInSbasMessage25::CmdName,
+        IsUsingVelocityInSbasMessage25Result::CmdName,
+        IsWFAntennaElementEnabled::CmdName,
+        IsWFAntennaElementEnabledResult::CmdName,
+        LockGUI::CmdName,
+        LogNmeaRateResult::CmdName,
+        LogRawRateResult::CmdName,
+        MessageSequenceImport::CmdName,
+        MessageSequenceInsert::CmdName,
+        MessageSequenceRemove::CmdName,
+        MessageSequenceSwap::CmdName,
+        New::CmdName,
+        Open::CmdName,
+        Pause::CmdName,
+        PushDynamicAlmanacData::CmdName,
+        PushDynamicSVData::CmdName,
+        PushIntTxTrackEcef::CmdName,
+        PushIntTxTrackEcefNed::CmdName,
+        PushRouteEcef::CmdName,
+        PushSpoofTxTrackEcef::CmdName,
+        PushSpoofTxTrackEcefNed::CmdName,
+        PushTrackEcef::CmdName,
+        PushTrackEcefNed::CmdName,
+        Quit::CmdName,
+        RandomizePseudorangeNoiseGaussMarkovSeedsForAllSV::CmdName,
+        RandomizeSeedsForAllSatellitesPseudorangeNoiseGaussMarkov::CmdName,
+        RawDataLoggingIntervalResult::CmdName,
+        RedoCmd::CmdName,
+        RemoveAllIntTx::CmdName,
+        RemoveAllInterferences::CmdName,
+        RemoveAllModulationTargets::CmdName,
+        RemoveAllMultipathForSV::CmdName,
+        RemoveAllMultipathForSignal::CmdName,
+        RemoveAllMultipathForSystem::CmdName,
+        RemoveAllPilots::CmdName,
+        RemoveAllPseudorangeRamp::CmdName,
+        RemoveAllPseudorangeRampForSV::CmdName,
+        RemoveAllPseudorangeRampForSystem::CmdName,
+        RemoveAllSignalsFromIntTx::CmdName,
+        RemoveAntennaChange::CmdName,
+        RemoveIntTx::CmdName,
+        RemoveInterference::CmdName,
+        RemoveMerkleTree::CmdName,
+        RemoveMessageModification::CmdName,
+        RemoveMessageModificationForNavMsgFamily::CmdName,
+        RemoveMessageModificationForSignal::CmdName,
+        RemoveModulationTarget::CmdName,
+        RemoveMultipath::CmdName,
+        RemovePseudorangeRamp::CmdName,
+        RemoveQzssL1SAugmentation::CmdName,
+        RemoveSbasServiceMessageRegionGroup::CmdName,
+        RemoveSignalFromIntTx::CmdName,
+        RemoveSpoofTx::CmdName,
+        RemoveWFElement::CmdName,
+        RenameDataSet::CmdName,
+        RenameIntTx::CmdName,
+        RenameSVAntennaModel::CmdName,
+        RenameSpoofTx::CmdName,
+        RenameVehicleAntennaModel::CmdName,
+        ResetAllSatPower::CmdName,
+        ResetDefaultConfiguration::CmdName,
+        ResetManualPowerOffsets::CmdName,
+        ResetPerturbations::CmdName,
+        ResetToDefaultPrn::CmdName,
+        Resume::CmdName,
+        Save::CmdName,
+        SaveAs::CmdName,
+        SetActiveDataSet::CmdName,
+        SetAgeOfDataBeiDou::CmdName,
+        SetAllSatellitesPseudorangeNoiseGaussMarkov::CmdName,
+        SetAllSatellitesPseudorangeNoiseOffset::CmdName,
+        SetAllSatellitesPseudorangeNoiseSineWave::CmdName,
+        SetAlmanacInitialUploadTimeOffset::CmdName,
+        SetAlmanacUploadTimeInterval::CmdName,
+        SetAntennaChange::CmdName,
+        SetBeiDouAutonomousHealthForSV::CmdName,
+        SetBeiDouCNavHealthInfoForSV::CmdName,
+        SetBeiDouEphBoolParamForEachSV::CmdName,
+        SetBeiDouEphBoolParamForSV::CmdName,
+        SetBeiDouEphDoubleParamForEachSV::CmdName,
+        SetBeiDouEphDoubleParamForSV::CmdName,
+        SetBeiDouEphemerisBoolParams::CmdName,
+        SetBeiDouEphemerisDoubleParams::CmdName,
+        SetBeiDouHealthInfoForSV::CmdName,
+        SetBeiDouHealthStatusForSV::CmdName,
+        SetBeiDouUraIndexForSV::CmdName,
+        SetConfigBroadcastFilter::CmdName,
+        SetConfigBroadcastOnStart::CmdName,
+        SetConstellationParameterForEachSV::CmdName,
+        SetConstellationParameterForSV::CmdName,
+        SetCrossAuthenticatedSatellitesForSV::CmdName,
+        SetCurrentPropagationModel::CmdName,
+        SetDataSetAssignation::CmdName,
+        SetDefaultConfiguration::CmdName,
+        SetDefaultIntTxPersistence::CmdName,
+        SetDefaultVehicleAntennaModel::CmdName,
+        SetDuration::CmdName,
+        SetDynamicRangeOffset::CmdName,
+        SetEffectiveIonisationLevelCoefficient::CmdName,
+        SetElevationMaskAbove::CmdName,
+        SetElevationMaskBelow::CmdName,
+        SetEncryptionLibraryPath::CmdName,
+        SetEngineLatency::CmdName,
+        SetEphemerisErrorForSV::CmdName,
+        SetEphemerisReferenceTime::CmdName,
+        SetEphemerisReferenceTimeForSV::CmdName,
+        SetEphemerisTocOffset::CmdName,
+        SetEphemerisUpdateInterval::CmdName,
+        SetExternalChannelsPath::CmdName,
+        SetGalileoDataHealthForSV::CmdName,
+        SetGalileoEphDoubleParamForEachSV::CmdName,
+        SetGalileoEphDoubleParamForSV::CmdName,
+        SetGalileoEphemerisDoubleParams::CmdName,
+        SetGalileoFnavSatelliteK::CmdName,
+        SetGalileoSignalHealthForSV::CmdName,
+        SetGalileoSisaE1E5aIndexForSV::CmdName,
+        SetGalileoSisaE1E5bIndexForSV::CmdName,
+        SetGaussianNoisePowerDensityOffset::CmdName,
+        SetGaussianNoiseSeed::CmdName,
+        SetGlobalPowerOffset::CmdName,
+        SetGlonassAlmanacUnhealthyFlagForSV::CmdName,
+        SetGlonassDoubleParams::CmdName,
+        SetGlonassEphDoubleParamForEachSV::CmdName,
+        SetGlonassEphDoubleParamForSV::CmdName,
+        SetGlonassEphemerisHealthFlagForSV::CmdName,
+        SetGpsAntiSpoofingFlagForSV::CmdName,
+        SetGpsCNavAlertFlagToSV::CmdName,
+        SetGpsConfigurationCodeForSV::CmdName,
+        SetGpsConfigurationForEachSV::CmdName,
+        SetGpsDataHealthForSV::CmdName,
+        SetGpsEphBoolParamForEachSV::CmdName,
+        SetGpsEphBoolParamForSV::CmdName,
+        SetGpsEphDoubleParamForEachSV::CmdName,
+        SetGpsEphDoubleParamForSV::CmdName,
+        SetGpsEphemerisBoolParams::CmdName,
+        SetGpsEphemerisDoubleParams::CmdName,
+        SetGpsL1HealthForSV::CmdName,
+        SetGpsL1cHealthForSV::CmdName,
+        SetGpsL2HealthForSV::CmdName,
+        SetGpsL5HealthForSV::CmdName,
+        SetGpsNavAlertFlagForSV::CmdName,
+        SetGpsSVConfigurationForAllSat::CmdName,
+        SetGpsSignalHealthForSV::CmdName,
+        SetGpsStartTime::CmdName,
+        SetGpsTimingReceiver::CmdName,
+        SetGpsUraIndexForSV::CmdName,
+        SetGpu::CmdName,
+        SetHilTjoin::CmdName,
+        SetIntTxAWGN::CmdName,
+        SetIntTxAntenna::CmdName,
+        SetIntTxAntennaOffset::CmdName,
+        SetIntTxBOC::CmdName,
+        SetIntTxBPSK::CmdName,
+        SetIntTxCW::CmdName,
+        SetIntTxChirp::CmdName,
+        SetIntTxCircular::CmdName,
+        SetIntTxFix::CmdName,
+        SetIntTxFixEcef::CmdName,
+        SetIntTxGroup::CmdName,
+        SetIntTxHiddenOnMap::CmdName,
+        SetIntTxHil::CmdName,
+        SetIntTxIgnorePropagationLoss::CmdName,
+        SetIntTxIgnoreRxAntennaGainPattern::CmdName,
+        SetIntTxIgnoreRxAntennaPatterns::CmdName,
+        SetIntTxIgnoreRxAntennaPhasePattern::CmdName,
+        SetIntTxIgnoreVehicleAntennaPattern::CmdName,
+        SetIntTxIqFile::CmdName,
+        SetIntTxNone::CmdName,
+        SetIntTxPersistence::CmdName,
+        SetIntTxPulse::CmdName,
+        SetIntTxRefPower::CmdName,
+        SetIntTxSignalManualPropagationLoss::CmdName,
+        SetIntTxUseManualPropagationLoss::CmdName,
+        SetIntTxVehicleType::CmdName,
+        SetInterModulation::CmdName,
+        SetInterferenceAWGN::CmdName,
+        SetInterferenceBOC::CmdName,
+        SetInterferenceBPSK::CmdName,
+        SetInterferenceCW::CmdName,
+        SetInterferenceChirp::CmdName,
+        SetIonoAlpha::CmdName,
+        SetIonoBdgimAlpha::CmdName,
+        SetIonoBeta::CmdName,
+        SetIonoGridError::CmdName,
+        SetIonoGridErrorAll::CmdName,
+        SetIonoGridGIVEI::CmdName,
+        SetIonoGridGIVEIAll::CmdName,
+        SetIonoGridMask::CmdName,
+        SetIonoGridMaskAll::CmdName,
+        SetIonoModel::CmdName,
+        SetIssueOfData::CmdName,
+        SetIssueOfDataBeiDou::CmdName,
+        SetIssueOfDataGalileo::CmdName,
+        SetIssueOfDataNavIC::CmdName,
+        SetIssueOfDataQzss::CmdName,
+        SetLeapSecond::CmdName,
+        SetLeapSecondFuture::CmdName,
+        SetLogNmeaRate::CmdName,
+        SetLogRawRate::CmdName,
+        SetManualPowerOffsetForSV::CmdName,
+        SetMerkleTreeParameters::CmdName,
+        SetMessageModificationToBeiDouCNav1::CmdName,
+        SetMessageModificationToBeiDouCNav2::CmdName,
+        SetMessageModificationToBeiDouD1Nav::CmdName,
+        SetMessageModificationToBeiDouD2Nav::CmdName,
+        SetMessageModificationToGalileoCNav::CmdName,
+        SetMessageModificationToGalileoFNav::CmdName,
+        SetMessageModificationToGalileoINav::CmdName,
+        SetMessageModificationToGlonassNav::CmdName,
+        SetMessageModificationToGpsCNav::CmdName,
+        SetMessageModificationToGpsCNav2::CmdName,
+        SetMessageModificationToGpsLNav::CmdName,
+        SetMessageModificationToNavICNav::CmdName,
+        SetMessageModificationToPulsarNav::CmdName,
+        SetMessageModificationToPulsarX1::CmdName,
+        SetMessageModificationToPulsarX5::CmdName,
+        SetMessageModificationToQzssCNav::CmdName,
+        SetMessageModificationToQzssCNav2::CmdName,
+        SetMessageModificationToQzssLNav::CmdName,
+        SetMessageModificationToQzssSlas::CmdName,
+        SetMessageModificationToSbasNav::CmdName,
+        SetModulationTarget::CmdName,
+        SetMultipathForSV::CmdName,
+        SetN310LocalOscillatorSource::CmdName,
+        SetNavICEphDoubleParamForEachSV::CmdName,
+        SetNavICEphDoubleParamForSV::CmdName,
+        SetNavICEphemerisDoubleParam::CmdName,
+        SetNavICEphemerisDoubleParams::CmdName,
+        SetNavICL1HealthForSV::CmdName,
+        SetNavICL5HealthForSV::CmdName,
+        SetNavICNavAlertFlagForSV::CmdName,
+        SetNavICSHealthForSV::CmdName,
+        SetNavICSatelliteL5Health::CmdName,
+        SetNavICSatelliteNavAlertFlag::CmdName,
+        SetNavICUraIndex::CmdName,
+        SetNavICUraIndexForSV::CmdName,
+        SetNmeaLoggerSentences::CmdName,
+        SetNmeaLoggerSerialPortDelay::CmdName,
+        SetNtpServer::CmdName,
+        SetOsnmaMacFunction::CmdName,
+        SetOsnmaMacLtId::CmdName,
+        SetOsnmaTagSize::CmdName,
+        SetOsnmaTeslaHashFunction::CmdName,
+        SetOsnmaTeslaKeySize::CmdName,
+        SetPerturbations::CmdName,
+        SetPerturbationsForAllSat::CmdName,
+        SetPilotCW::CmdName,
+        SetPilotPRN::CmdName,
+        SetPowerGlobalOffset::CmdName,
+        SetPowerOffset::CmdName,
+        SetPowerSbasOffset::CmdName,
+        SetPps0GpsTime::CmdName,
+        SetPrnForEachSV::CmdName,
+        SetPrnOfSVID::CmdName,
+        SetPropagationDelay::CmdName,
+        SetPropagationModelParameters::CmdName,
+        SetPseudorangeNoiseGaussMarkovForEachSV::CmdName,
+        SetPseudorangeNoiseGaussMarkovForSV::CmdName,
+        SetPseudorangeNoiseOffsetForEachSV::CmdName,
+        SetPseudorangeNoiseOffsetForSV::CmdName,
+        SetPseudorangeNoiseSineWaveForEachSV::CmdName,
+        SetPseudorangeNoiseSineWaveForSV::CmdName,
+        SetPseudorangeRampForSV::CmdName,
+        SetPulsarX1AccuracyIntegrityForSV::CmdName,
+        SetPulsarX1HealthForSV::CmdName,
+        SetPulsarX5AccuracyIntegrityForSV::CmdName,
+        SetPulsarX5HealthForSV::CmdName,
+        SetQzssEphBoolParamForEachSV::CmdName,
+        SetQzssEphBoolParamForSV::CmdName,
+        SetQzssEphDoubleParamForEachSV::CmdName,
+        SetQzssEphDoubleParamForSV::CmdName,
+        SetQzssEphemerisBoolParam::CmdName,
+        SetQzssEphemerisBoolParams::CmdName,
+        SetQzssEphemerisDoubleParam::CmdName,
+        SetQzssEphemerisDoubleParams::CmdName,
+        SetQzssL1DataHealthForSV::CmdName,
+        SetQzssL1HealthForSV::CmdName,
+        SetQzssL1SAugmentation::CmdName,
+        SetQzssL1cHealthForSV::CmdName,
+        SetQzssL2HealthForSV::CmdName,
+        SetQzssL5HealthForSV::CmdName,
+        SetQzssL6HealthForSV::CmdName,
+        SetQzssNavAlertFlagForSV::CmdName,
+        SetQzssSatelliteL1DataHealth::CmdName,
+        SetQzssSatelliteL1Health::CmdName,
+        SetQzssSatelliteL1cHealth::CmdName,
+        SetQzssSatelliteL2Health::CmdName,
+        SetQzssSatelliteL5Health::CmdName,
+        SetQzssSatelliteNavAlertFlag::CmdName,
+        SetQzssUraIndex::CmdName,
+        SetQzssUraIndexForSV::CmdName,
+        SetRFOutputOffsets::CmdName,
+        SetRawDataLoggingInterval::CmdName,
+        SetRfGain::CmdName,
+        SetSVAntennaGain::CmdName,
+        SetSVAntennaGainCSV::CmdName,
+        SetSVAntennaModelForEachSV::CmdName,
+        SetSVAntennaModelForSV::CmdName,
+        SetSVAntennaPhaseOffset::CmdName,
+        SetSVAntennaPhaseOffsetCSV::CmdName,
+        SetSVDataUpdateMode::CmdName,
+        SetSVType::CmdName,
+        SetSatMotionFixed::CmdName,
+        SetSbasCorrectionsHealthForSV::CmdName,
+        SetSbasDeltaUdreiOutsideOfRegions::CmdName,
+        SetSbasEphParamsForSV::CmdName,
+        SetSbasEphemerisReferenceTimeForSV::CmdName,
+        SetSbasIntegrityHealthForSV::CmdName,
+        SetSbasMessageUpdateInterval::CmdName,
+        SetSbasMonitoredSystems::CmdName,
+        SetSbasRangingHealthForSV::CmdName,
+        SetSbasReservedHealthForSV::CmdName,
+        SetSbasServiceHealthForSV::CmdName,
+        SetSbasServiceMessageRegionGroup::CmdName,
+        SetSbasUraIndexForSV::CmdName,
+        SetSignalFilterAssignation::CmdName,
+        SetSignalPowerOffset::CmdName,
+        SetSpectrumVisible::CmdName,
+        SetSpoofSignalManualPropagationLoss::CmdName,
+        SetSpoofTxAntenna::CmdName,
+        SetSpoofTxAntennaOffset::CmdName,
+        SetSpoofTxCircular::CmdName,
+        SetSpoofTxFix::CmdName,
+        SetSpoofTxFixEcef::CmdName,
+        SetSpoofTxGpuIdx::CmdName,
+        SetSpoofTxHil::CmdName,
+        SetSpoofTxIgnorePropagationLoss::CmdName,
+        SetSpoofTxIgnoreRxAntennaGainPattern::CmdName,
+        SetSpoofTxIgnoreRxAntennaPatterns::CmdName,
+        SetSpoofTxIgnoreRxAntennaPhasePattern::CmdName,
+        SetSpoofTxRefPower::CmdName,
+        SetSpoofTxRemoteAddress::CmdName,
+        SetSpoofTxUseManualPropagationLoss::CmdName,
+        SetSpoofTxVehicleType::CmdName,
+        SetStartTimeMode::CmdName,
+        SetStartTimeOffset::CmdName,
+        SetStatusLogMaxEntriesCount::CmdName,
+        SetStatusLogMaxEntriesCountMode::CmdName,
+        SetStreamingBuffer::CmdName,
+        SetSyncClient::CmdName,
+        SetSyncServer::CmdName,
+        SetSyncTime::CmdName,
+        SetSyncTimeMainInstance::CmdName,
+        SetSyncTimeMaster::CmdName,
+        SetTransmitMessage2InSbasMessage0::CmdName,
+        SetTransmittedPrnForSV::CmdName,
+        SetTropoModel::CmdName,
+        SetUdreiForEachSV::CmdName,
+        SetUdreiForSV::CmdName,
+        SetUsingVelocityInSbasMessage25::CmdName,
+        SetVehicleAntennaGain::CmdName,
+        SetVehicleAntennaGainCSV::CmdName,
+        SetVehicleAntennaOffset::CmdName,
+        SetVehicleAntennaPhaseOffset::CmdName,
+        SetVehicleAntennaPhaseOffsetCSV::CmdName,
+        SetVehicleTrajectory::CmdName,
+        SetVehicleTrajectoryCircular::CmdName,
+        SetVehicleTrajectoryFix::CmdName,
+        SetVehicleTrajectoryFixEcef::CmdName,
+        SetVehicleTrajectoryOrbit::CmdName,
+        SetVehicleType::CmdName,
+        SetWFAntennaElementEnabled::CmdName,
+        SetWFAntennaElementModel::CmdName,
+        SetWFAntennaElementOffset::CmdName,
+        SetWFAntennaElementPhasePatternOffset::CmdName,
+        SetWFAntennaGain::CmdName,
+        SetWFAntennaOffset::CmdName,
+        SetWFElement::CmdName,
+        SetWavefrontJamCalibrationState::CmdName,
+        ShowMapAnalysis::CmdName,
+        SimulationElapsedTimeResult::CmdName,
+        SimulatorStateResult::CmdName,
+        Start::CmdName,
+        StartPPS::CmdName,
+        Stop::CmdName,
+        StopMainInstanceWhenWorkerInstanceStop::CmdName,
+        StopMasterWhenSlaveStop::CmdName,
+        StopWhenCommandFail::CmdName,
+        SuccessResult::CmdName,
+        SwapSbasServiceMessageRegionGroup::CmdName,
+        TestEncryptionLibrary::CmdName,
+        UndoCmd::CmdName,
+        UnlockGUI::CmdName,
+        VersionResult::CmdName,
+        WaitAndResetPPS::CmdName,
+        WaitSimulatorState::CmdName
+      };
+      return names;
+    }
+  }
+}
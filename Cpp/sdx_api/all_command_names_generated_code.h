@@ -0,0 +1,17 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace Sdx
+{
+  namespace Cmd
+  {
+    constexpr size_t ALL_COMMAND_NAMES_COUNT = 1180;
+
+    // Names of all the generated commands and results, sorted. Unlike CommandFactory::registeredNames, the table
+    // doesn't depend on the generated objects linked in the application: it refers to every command, so they are
+    // all linked and registered to the CommandFactory.
+    const std::array<const char*, ALL_COMMAND_NAMES_COUNT>& allCommandNames();
+  }
+}
@@ -0,0 +1,24 @@
+#ifndef CANCELLATION_TOKEN_H
+#define CANCELLATION_TOKEN_H
+
+#include <atomic>
+
+namespace Sdx
+{
+
+// Cancels from another thread the waits it is passed to, see RemoteSimulator::call. A cancelled token stays cancelled
+// until reset.
+class CancellationToken
+{
+public:
+  inline void cancel() { m_cancelled.store(true, std::memory_order_release); }
+  inline void reset() { m_cancelled.store(false, std::memory_order_release); }
+  inline bool isCancelled() const { return m_cancelled.load(std::memory_order_acquire); }
+
+private:
+  std::atomic<bool> m_cancelled {false};
+};
+
+} // namespace Sdx
+
+#endif // CANCELLATION_TOKEN_H
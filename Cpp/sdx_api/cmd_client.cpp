@@ -7,6 +7,7 @@
 #define MSG_WAITALL 0
 #else
 #include <winsock2.h>
+#include <ws2tcpip.h>
 #endif
 #else
 #include <arpa/inet.h>
@@ -17,43 +18,117 @@
 #include <unistd.h>
 #endif
 
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
 #include <chrono>
+#include <exception>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 #include "all_commands.h"
+#include "cancellation_token.h"
 #include "command_base.h"
 #include "command_factory.h"
 #include "command_result.h"
+#include "latency_stats.h"
+#include "precision_policy.h"
+#include "stream_recorder.h"
+#include "streaming_parse.h"
+#include "trace_recorder.h"
 
 #define CMD_BLOCK_SIZE 65535
 
 namespace Sdx
 {
 
+// Thread safe, unlike gethostbyname which returns a static hostent: clients connect concurrently, see SimulatorCluster
+static bool resolveHost(const std::string& ip, int socketType, sockaddr_in& addr)
+{
+#ifdef WINSOCK1
+  // The Windows gethostbyname result is per thread
+  hostent* server = gethostbyname(ip.c_str());
+  if (!server)
+    return false;
+  memcpy(&addr.sin_addr.s_addr, server->h_addr, server->h_length);
+  return true;
+#else
+  addrinfo hints {};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = socketType;
+  addrinfo* result = nullptr;
+  if (getaddrinfo(ip.c_str(), nullptr, &hints, &result) != 0 || !result)
+    return false;
+  addr.sin_addr = reinterpret_cast<sockaddr_in*>(result->ai_addr)->sin_addr;
+  freeaddrinfo(result);
+  return true;
+#endif
+}
+
 struct CmdClient::Pimpl
 {
+  // Set by the writer and reader threads of a CommandDispatcher when the connection drops
+  mutable std::mutex error_mutex;
   std::string error_message;
 
   int s;
-  struct hostent* server;
   struct sockaddr_in serv_addr;
-  bool connected;
+  std::atomic<bool> connected;
   char message2Send[CMD_BLOCK_SIZE];
   char message[CMD_BLOCK_SIZE];
   std::string address;
-  bool stop_request;
+  std::atomic<bool> stop_request;
   bool exceptionOnError;
   bool verbose;
+
+  LatencyStats* latencyStats;
+  StreamRecorder* streamRecorder;
+  const PrecisionPolicy* precisionPolicy;
+  // End of send of the commands waiting for their result, by uuid
+  std::unordered_map<std::string, std::chrono::steady_clock::time_point> pendingSince;
+  std::chrono::steady_clock::time_point firstByteTime;
+
+  std::chrono::steady_clock::time_point deadline;
+  const CancellationToken* cancellation;
+  bool timedOut;
+
+  inline bool isTimed() const { return latencyStats && latencyStats->isEnabled(); }
 };
 
+// Results never waited for are forgotten past this count
+static constexpr size_t MAX_PENDING_LATENCIES = 10000;
+// Longest wait before a cancellation is noticed
+static constexpr std::chrono::milliseconds CANCELLATION_POLL_INTERVAL(50);
+
+// True if the serialized result is the one of cmd, read from its related command without parsing the result
+static bool isResultOf(std::string_view resultJson, const CommandBase& cmd)
+{
+  std::string relatedJson;
+  if (!findStringMember(resultJson, CommandResult::RelatedCommand, relatedJson))
+    return false;
+  std::string uuid;
+  return findStringMember(relatedJson, CommandBase::CmdUuidKey, uuid) && uuid == cmd.uuid();
+}
+
 CmdClient::CmdClient(bool exceptionOnError) : m(new Pimpl)
 {
   m->s = -1;
-  m->server = 0;
   m->connected = false;
   m->exceptionOnError = exceptionOnError;
   m->verbose = false;
   m->stop_request = false;
+  m->latencyStats = nullptr;
+  m->streamRecorder = nullptr;
+  m->precisionPolicy = nullptr;
+  m->deadline = std::chrono::steady_clock::time_point::max();
+  m->cancellation = nullptr;
+  m->timedOut = false;
 #if _WIN32
   WORD versionWanted = MAKEWORD(2, 0);
   WSADATA wsaData;
@@ -84,11 +159,13 @@ const std::string& CmdClient::address() const
 
 bool CmdClient::hasError() const
 {
+  std::lock_guard lock(m->error_mutex);
   return !m->error_message.empty();
 }
 
 void CmdClient::clearError()
 {
+  std::lock_guard lock(m->error_mutex);
   m->error_message.clear();
 }
 
@@ -103,16 +180,14 @@ bool CmdClient::connectToHost(const std::string& ip, int port)
   }
 
   m->address = ip;
-  m->server = gethostbyname(ip.c_str());
-  if (!m->server)
+  memset(&m->serv_addr, 0, sizeof(m->serv_addr));
+  m->serv_addr.sin_family = AF_INET;
+  if (!resolveHost(ip, SOCK_STREAM, m->serv_addr))
   {
     closeSocket();
     errorMessage("Unable to get host by name");
     return false;
   }
-  memset(&m->serv_addr, 0, sizeof(m->serv_addr));
-  m->serv_addr.sin_family = AF_INET;
-  memcpy(&m->serv_addr.sin_addr.s_addr, m->server->h_addr, m->server->h_length);
   m->serv_addr.sin_port = htons(static_cast<u_short>(port));
 
 #ifndef _WIN32
@@ -141,9 +216,59 @@ bool CmdClient::isVerbose() const
   return m->verbose;
 }
 
+void CmdClient::setLatencyStats(LatencyStats* stats)
+{
+  m->latencyStats = stats;
+  m->pendingSince.clear();
+}
+
+void CmdClient::setStreamRecorder(StreamRecorder* recorder)
+{
+  m->streamRecorder = recorder;
+}
+
+void CmdClient::setPrecisionPolicy(const PrecisionPolicy* policy)
+{
+  m->precisionPolicy = policy;
+}
+
+const PrecisionPolicy* CmdClient::precisionPolicy() const
+{
+  return m->precisionPolicy;
+}
+
+void CmdClient::setWaitLimits(std::chrono::steady_clock::time_point deadline, const CancellationToken* token)
+{
+  m->deadline = deadline;
+  m->cancellation = token;
+}
+
+bool CmdClient::sendRawMessage(const char* message, int length)
+{
+  return sendMessage(message, length);
+}
+
+bool CmdClient::receiveRawMessage(std::string_view& message)
+{
+  if (!receiveMessage())
+    return false;
+  message = std::string_view(m->message, reinterpret_cast<uint16_t*>(&m->message[0])[0] + 2);
+  return true;
+}
+
+void CmdClient::interrupt()
+{
+  m->stop_request = true;
+  if (m->s >= 0)
+    shutdown(m->s, 2);
+}
+
 void CmdClient::errorMessage(const std::string& msg)
 {
-  m->error_message = msg;
+  {
+    std::lock_guard lock(m->error_mutex);
+    m->error_message = msg;
+  }
   if (m->exceptionOnError)
     throw std::runtime_error(msg);
   if (m->verbose)
@@ -185,14 +310,30 @@ int CmdClient::getServerApiVersion()
 
 bool CmdClient::sendCommand(CommandBasePtr cmd)
 {
-  std::string jsonStr = cmd->toString();
+  TraceScope trace("cmd", "send", cmd->name());
+  using Clock = std::chrono::steady_clock;
+  const bool timed = m->isTimed();
+  const Clock::time_point sendStart = timed ? Clock::now() : Clock::time_point();
+
+  std::string jsonStr = m->precisionPolicy ? cmd->toString(*m->precisionPolicy) : cmd->toString();
   m->message2Send[2] = static_cast<char>(CmdMsgId_Command);
   memcpy(&m->message2Send[3], jsonStr.c_str(), jsonStr.size() + 1);
 
   int msgSize = static_cast<int>(jsonStr.size()) + 4;
   reinterpret_cast<uint16_t*>(&m->message2Send)[0] = msgSize - 2;
 
-  return sendMessage(m->message2Send, msgSize);
+  if (!sendMessage(m->message2Send, msgSize))
+    return false;
+
+  if (timed)
+  {
+    const Clock::time_point sendEnd = Clock::now();
+    m->latencyStats->record(cmd->name(), LatencyPhase::Send, sendEnd - sendStart);
+    if (m->pendingSince.size() >= MAX_PENDING_LATENCIES)
+      m->pendingSince.clear();
+    m->pendingSince[cmd->uuid()] = sendEnd;
+  }
+  return true;
 }
 
 CommandResultPtr CmdClient::waitCommand(CommandBasePtr cmd)
@@ -200,10 +341,7 @@ CommandResultPtr CmdClient::waitCommand(CommandBasePtr cmd)
   while (true)
   {
     if (!receiveMessage())
-    {
-      std::cout << "Failed to receive command result. Is server still running?" << std::endl;
-      throw std::runtime_error("Failed to receive command result. Is server still running?");
-    }
+      receiveFailed();
 
     int msgId = static_cast<int>(m->message[2]);
     switch (msgId)
@@ -212,8 +350,16 @@ CommandResultPtr CmdClient::waitCommand(CommandBasePtr cmd)
       {
         char* msgJson = &m->message[7];
         std::string errorMsg;
-        if (auto result = CommandFactory::instance()->createCommandResult(msgJson, &errorMsg))
+        const bool timed = m->isTimed();
+        const auto parseStart = timed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+        // Declared before the trace, which refers to the name of its command until destroyed
+        CommandResultPtr result;
+        TraceScope trace("cmd", "parse");
+        if ((result = CommandFactory::instance()->createCommandResult(msgJson, &errorMsg)))
         {
+          trace.setDetail(result->relatedCommand()->name());
+          if (timed)
+            recordResultLatency(result, parseStart, std::chrono::steady_clock::now());
           if (cmd->uuid() == result->relatedCommand()->uuid())
             return result;
         }
@@ -231,12 +377,199 @@ CommandResultPtr CmdClient::waitCommand(CommandBasePtr cmd)
   }
 }
 
+CommandResultPtr CmdClient::waitCommand(CommandBasePtr cmd,
+                                        const std::string& arrayField,
+                                        const std::function<void(const rapidjson::Value& element)>& onElement)
+{
+  while (true)
+  {
+    if (!receiveMessage())
+      receiveFailed();
+
+    if (static_cast<int>(m->message[2]) != CmdMsgId_Result)
+      continue;
+
+    // The uuid of the command is in the related command serialized in its result: the results of the other commands
+    // are skipped before their elements could be streamed. The uuid may appear elsewhere (a log message...), so the
+    // related command of the messages containing it is checked.
+    const std::string_view msgJson(&m->message[7]);
+    if (msgJson.find(cmd->uuid()) == std::string_view::npos || !isResultOf(msgJson, *cmd))
+      continue;
+
+    std::string errorMsg;
+    const bool timed = m->isTimed();
+    const auto parseStart = timed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+    TraceScope trace("cmd", "parse", cmd->name());
+    rapidjson::Document doc;
+    CommandResultPtr result;
+    if (parseStreaming(msgJson, arrayField, doc, onElement, &errorMsg))
+      result = CommandFactory::instance()->createCommandResult(std::move(doc), &errorMsg);
+    if (!result)
+    {
+      std::cout << "Failed to parse " << msgJson << std::endl;
+      std::cout << errorMsg << std::endl;
+      throw std::runtime_error(errorMsg.c_str());
+    }
+    if (timed)
+      recordResultLatency(result, parseStart, std::chrono::steady_clock::now());
+    if (cmd->uuid() == result->relatedCommand()->uuid())
+      return result;
+  }
+}
+
+std::vector<CommandResultPtr> CmdClient::waitCommands(const std::vector<std::string>& uuids)
+{
+  std::unordered_map<std::string, size_t> indexes;
+  for (size_t i = 0; i < uuids.size(); ++i)
+    indexes.emplace(uuids[i], i);
+
+  std::vector<CommandResultPtr> results(uuids.size());
+  size_t remaining = uuids.size();
+  while (remaining > 0)
+  {
+    if (!receiveMessage())
+      receiveFailed();
+
+    if (static_cast<int>(m->message[2]) != CmdMsgId_Result)
+      continue;
+
+    char* msgJson = &m->message[7];
+    std::string errorMsg;
+    auto result = CommandFactory::instance()->createCommandResult(msgJson, &errorMsg);
+    if (!result)
+    {
+      std::cout << "Failed to parse " << msgJson << std::endl;
+      std::cout << errorMsg << std::endl;
+      throw std::runtime_error(errorMsg.c_str());
+    }
+
+    auto it = indexes.find(result->relatedCommand()->uuid());
+    if (it != indexes.end() && !results[it->second])
+    {
+      results[it->second] = result;
+      --remaining;
+    }
+  }
+  return results;
+}
+
+std::vector<CommandResultPtr> CmdClient::sendAndWaitCommands(const char* messages,
+                                                             size_t length,
+                                                             const std::vector<std::string>& uuids)
+{
+  // The results are read while writing: a server blocked on sending results would otherwise stop reading commands.
+  std::exception_ptr writeError;
+  std::atomic<bool> writeDone {false};
+  std::thread writer([&] {
+    bool written = false;
+    try
+    {
+      written = sendMessage(messages, static_cast<int>(length));
+    }
+    catch (...)
+    {
+      writeError = std::current_exception();
+    }
+    if (!written && m->s >= 0)
+      shutdown(m->s, 2); // Wakes up the reader, the stream is unusable after a partial write
+    writeDone = true;
+  });
+
+  std::vector<CommandResultPtr> results;
+  try
+  {
+    results = waitCommands(uuids);
+  }
+  catch (...)
+  {
+    if (!writeDone)
+    {
+      // The writer may be blocked by a server itself blocked on sending the results no longer read
+      m->connected = false;
+      if (m->s >= 0)
+        shutdown(m->s, 2);
+      writer.join();
+      throw;
+    }
+    writer.join();
+    if (writeError)
+      std::rethrow_exception(writeError);
+    throw;
+  }
+  writer.join();
+  return results;
+}
+
+void CmdClient::recordResultLatency(const CommandResultPtr& result,
+                                    std::chrono::steady_clock::time_point parseStart,
+                                    std::chrono::steady_clock::time_point parseEnd)
+{
+  const CommandBasePtr& cmd = result->relatedCommand();
+  auto it = m->pendingSince.find(cmd->uuid());
+  if (it == m->pendingSince.end())
+    return;
+
+  m->latencyStats->record(cmd->name(), LatencyPhase::FirstByte, m->firstByteTime - it->second);
+  m->latencyStats->record(cmd->name(), LatencyPhase::Parse, parseEnd - parseStart);
+  m->pendingSince.erase(it);
+}
+
+void CmdClient::receiveFailed()
+{
+  if (m->cancellation && m->cancellation->isCancelled())
+    throw std::runtime_error("Wait for command result cancelled.");
+  if (m->timedOut)
+    throw std::runtime_error("Timed out waiting for command result.");
+  std::cout << "Failed to receive command result. Is server still running?" << std::endl;
+  throw std::runtime_error("Failed to receive command result. Is server still running?");
+}
+
+// Waits for data to read until the deadline or the cancellation, false if there is none
+bool CmdClient::waitForInput(bool cancellable)
+{
+  using Clock = std::chrono::steady_clock;
+  const CancellationToken* cancellation = cancellable ? m->cancellation : nullptr;
+  if (m->deadline == Clock::time_point::max() && !cancellation)
+    return true;
+
+  while (true)
+  {
+    if (cancellation && cancellation->isCancelled())
+      return false;
+    const Clock::time_point now = Clock::now();
+    if (now >= m->deadline)
+    {
+      m->timedOut = true;
+      return false;
+    }
+
+    auto wait = std::chrono::duration_cast<std::chrono::microseconds>(m->deadline - now);
+    if (cancellation)
+      wait = std::min<std::chrono::microseconds>(wait, CANCELLATION_POLL_INTERVAL);
+    fd_set fds;
+    FD_ZERO(&fds);
+    FD_SET(m->s, &fds);
+    timeval tv;
+    tv.tv_sec = static_cast<long>(wait.count() / 1000000);
+    tv.tv_usec = static_cast<long>(wait.count() % 1000000);
+    const int status = select(m->s + 1, &fds, 0, 0, &tv);
+    if (status > 0)
+      return true;
+    if (status < 0 && errno != EINTR)
+      return true; // The error is reported by recv
+  }
+}
+
 bool CmdClient::receiveMessage()
 {
+  TraceScope trace("cmd", "receive");
   int rx(0);
+  m->timedOut = false;
 
   do
   {
+    if (!waitForInput(true))
+      return false;
     rx = recv(m->s, m->message, 2, MSG_PEEK);
 
     if (rx <= 0)
@@ -246,12 +579,22 @@ bool CmdClient::receiveMessage()
     }
   } while (rx < 2);
 
+  if (m->isTimed())
+    m->firstByteTime = std::chrono::steady_clock::now();
+
   int bytesToRead = static_cast<int>(reinterpret_cast<uint16_t*>(&m->message[0])[0]) + 2;
   char* messagePtr = m->message;
+  // With a deadline, the message is read as it arrives instead of blocking until it is complete
+  const int flags = m->deadline == std::chrono::steady_clock::time_point::max() ? MSG_WAITALL : 0;
 
   do
   {
-    rx = recv(m->s, messagePtr, bytesToRead, MSG_WAITALL);
+    if (!waitForInput(false))
+    {
+      m->connected = false; // The rest of the message would be read as the next one
+      return false;
+    }
+    rx = recv(m->s, messagePtr, bytesToRead, flags);
 
     if (rx <= 0)
     {
@@ -263,6 +606,10 @@ bool CmdClient::receiveMessage()
     messagePtr += rx;
   } while (bytesToRead > 0);
 
+  if (m->streamRecorder)
+    m->streamRecorder->record(StreamRecordKind::CommandReceived,
+                              m->message,
+                              static_cast<int>(messagePtr - m->message));
   return true;
 }
 
@@ -336,7 +683,10 @@ bool CmdClient::sendMessage(const char* message, int length)
   {
     return false;
   }
-  if (length != send(m->s, message, length, 0))
+  if (m->streamRecorder)
+    m->streamRecorder->record(StreamRecordKind::CommandSent, message, length);
+  // A connection closed by the simulator is reported as an error instead of raising SIGPIPE
+  if (length != send(m->s, message, length, MSG_NOSIGNAL))
   {
     errorMessage("Error sending message.");
     return false;
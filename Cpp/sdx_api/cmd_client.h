@@ -1,8 +1,12 @@
 #ifndef CMD_CLIENT_H
 #define CMD_CLIENT_H
 
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "command_base.h"
 
@@ -16,6 +20,11 @@ enum CmdMessageId
   CmdMsgId_ApiVersion = 2
 };
 
+class CancellationToken;
+class LatencyStats;
+class PrecisionPolicy;
+class StreamRecorder;
+
 class CmdClient
 {
 public:
@@ -31,6 +40,17 @@ public:
   int getServerApiVersion();
   bool sendCommand(CommandBasePtr cmd);
   CommandResultPtr waitCommand(CommandBasePtr cmd);
+  // Same as above, the elements of the array field of the result being passed to onElement as they are decoded instead
+  // of being stored in the result, see parseStreaming. The results of the other commands are skipped unparsed.
+  CommandResultPtr waitCommand(CommandBasePtr cmd,
+                               const std::string& arrayField,
+                               const std::function<void(const rapidjson::Value& element)>& onElement);
+  // Results of the commands with the given uuids, in the same order, whatever the order they are received in.
+  std::vector<CommandResultPtr> waitCommands(const std::vector<std::string>& uuids);
+  // Sends the framed messages in a single write while their results are read, see waitCommands.
+  std::vector<CommandResultPtr> sendAndWaitCommands(const char* messages,
+                                                    size_t length,
+                                                    const std::vector<std::string>& uuids);
 
   int port() const;
   const std::string& address() const;
@@ -38,6 +58,32 @@ public:
   void setVerbose(bool verbose);
   bool isVerbose() const;
 
+  // Records the Send, FirstByte and Parse durations of every command while stats is enabled. The stats must outlive
+  // the client, nullptr detaches them.
+  void setLatencyStats(LatencyStats* stats);
+
+  // Appends every message sent and received to recorder. The recorder must outlive the client, nullptr detaches it.
+  void setStreamRecorder(StreamRecorder* recorder);
+
+  // Serializes the commands sent with policy. The policy must outlive the client and not change while commands are
+  // sent from another thread, nullptr restores the full precision.
+  void setPrecisionPolicy(const PrecisionPolicy* policy);
+  const PrecisionPolicy* precisionPolicy() const;
+
+  // The waits for results fail with std::runtime_error past the deadline or once the token is cancelled, the late
+  // results being skipped by the next waits. A deadline passed while a message is partially received leaves the
+  // connection unusable. time_point::max() and nullptr (default) wait forever.
+  void setWaitLimits(std::chrono::steady_clock::time_point deadline, const CancellationToken* token);
+
+  // Sends an already framed message (size prefix included), as recorded by a StreamRecorder.
+  bool sendRawMessage(const char* message, int length);
+  // Receives the next framed message of any type, message is valid until the next receive.
+  bool receiveRawMessage(std::string_view& message);
+
+  // Wakes up a send or receive blocked in another thread, without reporting an error. The connection is unusable
+  // afterward.
+  void interrupt();
+
 private:
   struct Pimpl;
   Pimpl* m;
@@ -46,7 +92,12 @@ private:
   void errorMessage(const std::string& msg);
   void closeSocket();
   bool receiveMessage();
+  bool waitForInput(bool cancellable);
+  [[noreturn]] void receiveFailed();
   bool sendMessage(const char* message, int length);
+  void recordResultLatency(const CommandResultPtr& result,
+                           std::chrono::steady_clock::time_point parseStart,
+                           std::chrono::steady_clock::time_point parseEnd);
 };
 
 } // namespace Sdx
@@ -5,7 +5,11 @@
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/writer.h>
 
+#include <cstdint>
+#include <random>
+
 #include "date_time.h"
+#include "precision_policy.h"
 
 namespace Sdx
 {
@@ -51,6 +55,30 @@ void CommandBase::generateUuid()
   setValue(CmdUuidKey, value);
 }
 
+void CommandBase::renew()
+{
+  m_cmdUuid.resize(UuidSize);
+  writeRandomUuid(m_cmdUuid.data());
+  setMember(rapidjson::StringRef(CmdUuidKey.c_str(), CmdUuidKey.size()),
+            rapidjson::Value(rapidjson::StringRef(m_cmdUuid.data(), m_cmdUuid.size())));
+}
+
+void CommandBase::writeRandomUuid(char* uuid)
+{
+  static constexpr char Digits[] = "0123456789abcdef";
+  thread_local std::mt19937_64 random(std::random_device {}());
+  uint64_t halves[2] = {random(), random()};
+  halves[0] = (halves[0] & 0xFFFFFFFFFFFF0FFFull) | 0x0000000000004000ull;
+  halves[1] = (halves[1] & 0x3FFFFFFFFFFFFFFFull) | 0x8000000000000000ull;
+
+  for (int i = 0; i < 32; ++i)
+  {
+    if (i == 8 || i == 12 || i == 16 || i == 20)
+      *uuid++ = '-';
+    *uuid++ = Digits[(halves[i / 16] >> (60 - 4 * (i % 16))) & 0xF];
+  }
+}
+
 const rapidjson::Document& CommandBase::values() const
 {
   return m_values;
@@ -163,6 +191,11 @@ std::string CommandBase::toString(bool compact) const
   return sb.GetString();
 }
 
+std::string CommandBase::toString(const PrecisionPolicy& policy) const
+{
+  return policy.write(m_values);
+}
+
 std::string CommandBase::toReadableCommand(bool includeName) const
 {
   rapidjson::Document doc;
@@ -196,6 +229,15 @@ rapidjson::Value& CommandBase::value(const std::string& key)
     throw std::runtime_error("Cannot find " + key);
 }
 
+void CommandBase::setMember(rapidjson::Value::StringRefType key, rapidjson::Value&& value)
+{
+  auto it = m_values.FindMember(rapidjson::Value(key));
+  if (it != m_values.MemberEnd())
+    it->value = value;
+  else
+    m_values.AddMember(key, value, m_values.GetAllocator());
+}
+
 void CommandBase::setValue(const std::string& key, rapidjson::Value& value)
 {
   if (contains(key))
@@ -228,9 +270,9 @@ bool CommandBase::parse(const std::string& serializedCommand, std::string* error
   return true;
 }
 
-bool CommandBase::parse(const std::string& serializedCommand, rapidjson::Document& doc, std::string* errorMsg)
+bool CommandBase::parse(std::string_view serializedCommand, rapidjson::Document& doc, std::string* errorMsg)
 {
-  doc.Parse(serializedCommand.c_str());
+  doc.Parse(serializedCommand.data(), serializedCommand.size());
   if (doc.HasParseError())
   {
     if (errorMsg)
@@ -3,9 +3,11 @@
 
 #include <rapidjson/document.h>
 
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace Sdx
@@ -17,6 +19,7 @@ class CommandResult;
 typedef std::shared_ptr<CommandResult> CommandResultPtr;
 
 struct DateTime;
+class PrecisionPolicy;
 
 class CommandBase
 {
@@ -33,6 +36,7 @@ public:
   static const std::string CmdUuidKey;
   static const std::string CmdTimestampKey;
   static const std::string CmdHidden;
+  static constexpr size_t UuidSize = 36;
 
   explicit CommandBase(const std::string& cmdName, const std::string& targetId);
   virtual ~CommandBase() {}
@@ -55,6 +59,8 @@ public:
   bool hasTimestamp() const;
 
   std::string toString(bool compact = true) const;
+  // Compact JSON with the doubles written with the decimals of the policy
+  std::string toString(const PrecisionPolicy& policy) const;
   virtual std::string toReadableCommand(bool includeName = true) const;
 
   const rapidjson::Value& value(const std::string& key) const;
@@ -62,14 +68,22 @@ public:
   void setValue(const std::string& key, rapidjson::Value& value);
 
   bool parse(const std::string& serializedCommand, std::string* errorMsg = nullptr);
-  static bool parse(const std::string& serializedCommand, rapidjson::Document& doc, std::string* errorMsg = nullptr);
+  static bool parse(std::string_view serializedCommand, rapidjson::Document& doc, std::string* errorMsg = nullptr);
   bool contains(const std::string& key) const;
   void generateUuid();
+  // Gives the command a new UUID without allocating, so that the same command object can be sent again.
+  // The CmdUuid member refers to uuid() afterward instead of a copy.
+  void renew();
+  // Writes a random (version 4) UUID of UuidSize characters, formatted as Guid, without a terminating null
+  static void writeRandomUuid(char* uuid);
 
   const rapidjson::Document& values() const;
   virtual const std::vector<std::string>& fieldNames() const = 0;
 
 protected:
+  // Updates the member in place, or adds it if the command doesn't have it yet. The key is not copied.
+  void setMember(rapidjson::Value::StringRefType key, rapidjson::Value&& value);
+
   std::string m_cmdName;
   std::string m_cmdSplittedName;
   std::string m_cmdUuid;
@@ -0,0 +1,159 @@
+#include "command_blob.h"
+
+#include <guid.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include "cmd_client.h"
+#include "precision_policy.h"
+
+namespace Sdx
+{
+
+namespace
+{
+constexpr char BlobMagic[8] = {'S', 'D', 'X', 'B', 'L', 'O', 'B', '1'};
+constexpr size_t MaxMessageSize = 65535;
+
+template<typename T>
+void write(std::ostream& stream, const T& value)
+{
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool read(std::istream& stream, T& value)
+{
+  return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+} // namespace
+
+CommandBlob::CommandBlob()
+{
+}
+
+CommandBlob::CommandBlob(const std::vector<CommandBasePtr>& commands, const PrecisionPolicy* policy)
+{
+  for (const CommandBasePtr& cmd : commands)
+    append(cmd, policy);
+}
+
+void CommandBlob::append(const CommandBasePtr& cmd, const PrecisionPolicy* policy)
+{
+  const std::string json = policy ? cmd->toString(*policy) : cmd->toString();
+
+  // Same framing as CmdClient::sendCommand: [uint16 size][uint8 message id][json with null terminator]
+  const size_t messageSize = json.size() + 4;
+  if (messageSize > MaxMessageSize)
+    throw std::runtime_error("Command " + cmd->name() + " is too large to be sent in a message.");
+
+  const std::string uuidPattern = "\"" + CommandBase::CmdUuidKey + "\":\"" + cmd->uuid() + "\"";
+  const size_t uuidPosition = json.find(uuidPattern);
+  if (cmd->uuid().size() != UuidSize || uuidPosition == std::string::npos)
+    throw std::runtime_error("Command " + cmd->name() + " has no valid UUID.");
+
+  const uint16_t framedSize = static_cast<uint16_t>(messageSize - 2);
+  const size_t frameOffset = m_frames.size();
+  m_frames.append(reinterpret_cast<const char*>(&framedSize), sizeof(framedSize));
+  m_frames.push_back(static_cast<char>(CmdMsgId_Command));
+  m_frames.append(json.c_str(), json.size() + 1);
+
+  m_entries.push_back({frameOffset + 3 + uuidPosition + uuidPattern.size() - UuidSize - 1, cmd->name()});
+}
+
+void CommandBlob::clear()
+{
+  m_frames.clear();
+  m_entries.clear();
+}
+
+std::string CommandBlob::uuid(size_t index) const
+{
+  return m_frames.substr(m_entries[index].uuidOffset, UuidSize);
+}
+
+std::vector<std::string> CommandBlob::uuids() const
+{
+  std::vector<std::string> uuids;
+  uuids.reserve(m_entries.size());
+  for (size_t i = 0; i < m_entries.size(); ++i)
+    uuids.push_back(uuid(i));
+  return uuids;
+}
+
+void CommandBlob::renewUuids()
+{
+  GuidGenerator generator;
+  std::stringstream stream;
+  for (const Entry& entry : m_entries)
+  {
+    stream.str("");
+    stream << generator.newGuid();
+    const std::string uuid = stream.str();
+    if (uuid.size() == UuidSize)
+      memcpy(&m_frames[entry.uuidOffset], uuid.data(), UuidSize);
+  }
+}
+
+// File layout: magic, uint64 command count, per command (uint64 uuid offset, uint32 name size, name), uint64 frames
+// size, frames.
+bool CommandBlob::save(const std::string& path) const
+{
+  std::ofstream file(path, std::ios::binary);
+  file.write(BlobMagic, sizeof(BlobMagic));
+  write(file, static_cast<uint64_t>(m_entries.size()));
+  for (const Entry& entry : m_entries)
+  {
+    write(file, static_cast<uint64_t>(entry.uuidOffset));
+    write(file, static_cast<uint32_t>(entry.name.size()));
+    file.write(entry.name.data(), static_cast<std::streamsize>(entry.name.size()));
+  }
+  write(file, static_cast<uint64_t>(m_frames.size()));
+  file.write(m_frames.data(), static_cast<std::streamsize>(m_frames.size()));
+  return file.good();
+}
+
+bool CommandBlob::load(const std::string& path)
+{
+  clear();
+  std::ifstream file(path, std::ios::binary);
+  char magic[sizeof(BlobMagic)];
+  uint64_t count;
+  if (!file.read(magic, sizeof(magic)) || memcmp(magic, BlobMagic, sizeof(magic)) != 0 || !read(file, count))
+    return false;
+
+  std::vector<Entry> entries;
+  for (uint64_t i = 0; i < count; ++i)
+  {
+    uint64_t uuidOffset;
+    uint32_t nameSize;
+    if (!read(file, uuidOffset) || !read(file, nameSize))
+      return false;
+    std::string name(nameSize, '\0');
+    if (!file.read(name.data(), nameSize))
+      return false;
+    entries.push_back({static_cast<size_t>(uuidOffset), std::move(name)});
+  }
+
+  uint64_t framesSize;
+  if (!read(file, framesSize))
+    return false;
+  std::string frames(static_cast<size_t>(framesSize), '\0');
+  if (!file.read(frames.data(), static_cast<std::streamsize>(framesSize)))
+    return false;
+  for (const Entry& entry : entries)
+  {
+    if (entry.uuidOffset + UuidSize > frames.size())
+      return false;
+  }
+
+  m_frames = std::move(frames);
+  m_entries = std::move(entries);
+  return true;
+}
+
+} // namespace Sdx
@@ -0,0 +1,66 @@
+#ifndef COMMAND_BLOB_H
+#define COMMAND_BLOB_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "command_base.h"
+
+namespace Sdx
+{
+
+class PrecisionPolicy;
+
+// A sequence of commands serialized and framed ahead of time, ready to be sent in a single write.
+//
+// Every command is stored as the exact message CmdClient would send. Only the location of each command UUID is kept
+// beside the frames: renewUuids() patches new UUIDs in place before every send, so the same blob can be sent any
+// number of times without building or serializing a single command object. Blobs can be saved to a file and loaded
+// by later runs.
+//
+// Use RemoteSimulator::callBlob to send a blob and verify its results.
+class CommandBlob
+{
+public:
+  CommandBlob();
+  // The commands are serialized with the policy if not nullptr, see append.
+  explicit CommandBlob(const std::vector<CommandBasePtr>& commands, const PrecisionPolicy* policy = nullptr);
+
+  // Throws std::runtime_error if the serialized command doesn't fit in a message. The command is serialized with the
+  // policy if not nullptr.
+  void append(const CommandBasePtr& cmd, const PrecisionPolicy* policy = nullptr);
+  void clear();
+
+  inline size_t commandCount() const { return m_entries.size(); }
+  inline bool isEmpty() const { return m_entries.empty(); }
+  inline const std::string& commandName(size_t index) const { return m_entries[index].name; }
+  std::string uuid(size_t index) const;
+  std::vector<std::string> uuids() const;
+
+  // Gives every command a new UUID
+  void renewUuids();
+
+  // All the framed messages, in order
+  inline const char* data() const { return m_frames.data(); }
+  inline size_t size() const { return m_frames.size(); }
+
+  bool save(const std::string& path) const;
+  bool load(const std::string& path);
+
+  static constexpr size_t UuidSize = 36;
+
+private:
+  struct Entry
+  {
+    size_t uuidOffset; // In m_frames
+    std::string name;
+  };
+
+  std::string m_frames;
+  std::vector<Entry> m_entries;
+};
+
+} // namespace Sdx
+
+#endif // COMMAND_BLOB_H
@@ -0,0 +1,335 @@
+#include "command_dispatcher.h"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+
+#include "cancellation_token.h"
+#include "cmd_client.h"
+#include "command_blob.h"
+#include "command_factory.h"
+
+namespace Sdx
+{
+
+struct CommandDispatcher::Pending
+{
+  std::promise<CommandResultPtr> promise;
+};
+
+struct CommandDispatcher::Node
+{
+  std::atomic<Node*> next {nullptr};
+  std::string frames;
+  std::vector<std::pair<std::string, std::shared_ptr<Pending>>> pendings; // By uuid
+};
+
+CommandDispatcher::CommandDispatcher(CmdClient& client) :
+  m_client(client),
+  m_running(true),
+  m_stub(std::make_unique<Node>()),
+  m_signal(0),
+  m_submitting(0),
+  m_failed(false)
+{
+  m_head.store(m_stub.get(), std::memory_order_relaxed);
+  m_tail = m_stub.get();
+  m_writer = std::thread(&CommandDispatcher::writeLoop, this);
+  m_reader = std::thread(&CommandDispatcher::readLoop, this);
+}
+
+CommandDispatcher::~CommandDispatcher()
+{
+  stop();
+}
+
+bool CommandDispatcher::isRunning() const
+{
+  return m_running.load(std::memory_order_acquire);
+}
+
+std::shared_future<CommandResultPtr> CommandDispatcher::submit(CommandBasePtr cmd)
+{
+  CommandBlob blob;
+  blob.append(cmd, m_client.precisionPolicy());
+  return submit(blob).front();
+}
+
+std::vector<std::shared_future<CommandResultPtr>> CommandDispatcher::submit(const CommandBlob& blob)
+{
+  if (!isRunning())
+    throw std::runtime_error("Cannot send commands, the dispatcher is stopped.");
+
+  auto node = std::make_unique<Node>();
+  node->frames.assign(blob.data(), blob.size());
+  std::vector<std::shared_future<CommandResultPtr>> futures;
+  futures.reserve(blob.commandCount());
+  for (size_t i = 0; i < blob.commandCount(); ++i)
+  {
+    auto pending = std::make_shared<Pending>();
+    futures.push_back(pending->promise.get_future().share());
+    node->pendings.emplace_back(blob.uuid(i), std::move(pending));
+  }
+
+  // Counted before checking again that the dispatcher runs (both sequentially consistent): once it stops, the writer
+  // drains the queue only when no submit is in flight, so every node pushed is either sent or failed
+  m_submitting.fetch_add(1);
+  if (!m_running.load())
+  {
+    m_submitting.fetch_sub(1);
+    throw std::runtime_error("Cannot send commands, the dispatcher is stopped.");
+  }
+  push(node.release());
+  m_submitting.fetch_sub(1);
+  m_signal.fetch_add(1, std::memory_order_release);
+  m_signal.notify_one();
+  return futures;
+}
+
+void CommandDispatcher::post(CommandBasePtr cmd)
+{
+  auto future = submit(cmd);
+
+  std::lock_guard lock(m_postedMutex);
+  m_posted[cmd->uuid()] = std::move(future);
+  m_postedOrder.push_back(cmd->uuid());
+  while (m_postedOrder.size() > MaxPostedResults)
+  {
+    m_posted.erase(m_postedOrder.front());
+    m_postedOrder.pop_front();
+  }
+}
+
+CommandResultPtr CommandDispatcher::wait(const CommandBasePtr& cmd)
+{
+  return wait(cmd, std::chrono::steady_clock::time_point::max(), nullptr);
+}
+
+CommandResultPtr CommandDispatcher::wait(const CommandBasePtr& cmd,
+                                         std::chrono::steady_clock::time_point deadline,
+                                         const CancellationToken* token)
+{
+  std::shared_future<CommandResultPtr> future;
+  {
+    std::lock_guard lock(m_postedMutex);
+    auto it = m_posted.find(cmd->uuid());
+    if (it == m_posted.end())
+      throw std::runtime_error("Cannot wait for " + cmd->name() + ", the command was not posted.");
+    future = std::move(it->second);
+    m_posted.erase(it);
+  }
+
+  using Clock = std::chrono::steady_clock;
+  while (deadline != Clock::time_point::max() || token)
+  {
+    const Clock::time_point now = Clock::now();
+    if ((token && token->isCancelled()) || now >= deadline)
+    {
+      // Its entry in m_postedOrder is still there
+      std::lock_guard lock(m_postedMutex);
+      m_posted[cmd->uuid()] = std::move(future);
+      if (token && token->isCancelled())
+        throw std::runtime_error("Wait for " + cmd->name() + " result cancelled.");
+      throw std::runtime_error("Timed out waiting for " + cmd->name() + " result.");
+    }
+    // Polled so that a cancellation is noticed
+    const Clock::duration wait = token ? std::min<Clock::duration>(deadline - now, std::chrono::milliseconds(50))
+                                       : deadline - now;
+    if (future.wait_for(wait) == std::future_status::ready)
+      break;
+  }
+  return future.get();
+}
+
+void CommandDispatcher::push(Node* node)
+{
+  node->next.store(nullptr, std::memory_order_relaxed);
+  Node* previous = m_head.exchange(node, std::memory_order_acq_rel);
+  previous->next.store(node, std::memory_order_release);
+}
+
+// Single consumer: the writer thread, or the thread stopping the dispatcher once the writer is joined.
+CommandDispatcher::Node* CommandDispatcher::pop()
+{
+  Node* tail = m_tail;
+  Node* next = tail->next.load(std::memory_order_acquire);
+  if (tail == m_stub.get())
+  {
+    if (!next)
+      return nullptr;
+    m_tail = next;
+    tail = next;
+    next = next->next.load(std::memory_order_acquire);
+  }
+  if (next)
+  {
+    m_tail = next;
+    return tail;
+  }
+  if (tail != m_head.load(std::memory_order_acquire))
+    return nullptr; // A producer is linking its node, it signals once done
+
+  push(m_stub.get());
+  next = tail->next.load(std::memory_order_acquire);
+  if (next)
+  {
+    m_tail = next;
+    return tail;
+  }
+  return nullptr;
+}
+
+void CommandDispatcher::writeLoop()
+{
+  std::string frames;
+  while (isRunning())
+  {
+    const uint32_t signal = m_signal.load(std::memory_order_acquire);
+
+    frames.clear();
+    std::vector<std::pair<std::string, std::shared_ptr<Pending>>> sent;
+    while (Node* node = pop())
+    {
+      frames += node->frames;
+      for (auto& pending : node->pendings)
+        sent.push_back(std::move(pending));
+      delete node;
+    }
+
+    if (sent.empty())
+    {
+      m_signal.wait(signal, std::memory_order_acquire);
+      continue;
+    }
+
+    {
+      std::lock_guard lock(m_pendingMutex);
+      if (m_failed)
+      {
+        // The reader already failed the pending commands, these would never get a result
+        for (auto& [uuid, pending] : sent)
+          pending->promise.set_exception(std::make_exception_ptr(std::runtime_error(m_error)));
+        break;
+      }
+      for (const auto& [uuid, pending] : sent)
+        m_pending.emplace(uuid, pending);
+    }
+
+    bool written = false;
+    try
+    {
+      written = m_client.sendRawMessage(frames.data(), static_cast<int>(frames.size()));
+    }
+    catch (const std::exception&)
+    {
+    }
+    if (!written)
+    {
+      // Interrupted by stop otherwise, which fails the pending commands
+      if (isRunning())
+        failAll("Error sending message.");
+      break;
+    }
+  }
+  failQueued();
+}
+
+void CommandDispatcher::readLoop()
+{
+  std::string error = "Connection lost with host";
+  try
+  {
+    std::string_view message;
+    while (m_client.receiveRawMessage(message))
+    {
+      if (message.size() < 8 || static_cast<int>(message[2]) != CmdMsgId_Result)
+        continue;
+
+      std::string errorMsg;
+      auto result = CommandFactory::instance()->createCommandResult(&message[7], &errorMsg);
+      if (!result)
+      {
+        std::cout << "Failed to parse " << &message[7] << std::endl;
+        std::cout << errorMsg << std::endl;
+        continue;
+      }
+
+      std::shared_ptr<Pending> pending;
+      {
+        std::lock_guard lock(m_pendingMutex);
+        auto it = m_pending.find(result->relatedCommand()->uuid());
+        if (it == m_pending.end())
+          continue;
+        pending = std::move(it->second);
+        m_pending.erase(it);
+      }
+      pending->promise.set_value(result);
+    }
+  }
+  catch (const std::exception& e)
+  {
+    error = e.what();
+  }
+  failAll(error);
+}
+
+// Called by the reader and writer threads: the queue is drained by the writer once it exits.
+void CommandDispatcher::failAll(const std::string& error)
+{
+  m_running.store(false);
+  m_signal.fetch_add(1, std::memory_order_release);
+  m_signal.notify_one();
+
+  std::unordered_map<std::string, std::shared_ptr<Pending>> pending;
+  {
+    std::lock_guard lock(m_pendingMutex);
+    if (!m_failed)
+    {
+      m_failed = true;
+      m_error = error;
+    }
+    pending.swap(m_pending);
+  }
+  for (auto& [uuid, p] : pending)
+    p->promise.set_exception(std::make_exception_ptr(std::runtime_error(error)));
+}
+
+// Fails the commands still queued, which were never sent. Called by the writer thread once stopped.
+void CommandDispatcher::failQueued()
+{
+  // A submit that passed the running check may still be pushing: pop returns nullptr while a node is being linked
+  while (m_submitting.load() != 0)
+    std::this_thread::yield();
+
+  std::string error = "The dispatcher is stopped.";
+  {
+    std::lock_guard lock(m_pendingMutex);
+    if (m_failed)
+      error = m_error;
+  }
+  while (Node* node = pop())
+  {
+    for (auto& [uuid, pending] : node->pendings)
+      pending->promise.set_exception(std::make_exception_ptr(std::runtime_error(error)));
+    delete node;
+  }
+}
+
+void CommandDispatcher::stop()
+{
+  m_running.store(false);
+  m_signal.fetch_add(1, std::memory_order_release);
+  m_signal.notify_one();
+
+  // Wakes up the writer blocked in send by a simulator that isn't reading, and the reader
+  m_client.interrupt();
+  if (m_writer.joinable())
+    m_writer.join();
+  if (m_reader.joinable())
+    m_reader.join();
+
+  failAll("The dispatcher is stopped.");
+}
+
+} // namespace Sdx
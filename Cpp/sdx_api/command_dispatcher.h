@@ -0,0 +1,97 @@
+#ifndef COMMAND_DISPATCHER_H
+#define COMMAND_DISPATCHER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "command_result.h"
+
+namespace Sdx
+{
+
+class CancellationToken;
+class CmdClient;
+class CommandBlob;
+
+// Shares one CmdClient connection between threads.
+//
+// Any thread can submit commands: they are serialized by the submitting thread and pushed in a lock-free
+// multi-producer queue. A writer thread drains the queue and sends everything queued in a single write, a reader
+// thread decodes the results and fulfills the future of the matching command. The client must not be used directly
+// while the dispatcher runs.
+//
+// If the connection is lost or the dispatcher stopped, the pending futures throw std::runtime_error.
+class CommandDispatcher
+{
+public:
+  explicit CommandDispatcher(CmdClient& client);
+  ~CommandDispatcher();
+
+  // Throws std::runtime_error if the command is too large to be sent or the dispatcher is stopped.
+  std::shared_future<CommandResultPtr> submit(CommandBasePtr cmd);
+  std::vector<std::shared_future<CommandResultPtr>> submit(const CommandBlob& blob);
+
+  // Submits the command and keeps its future for wait, as RemoteSimulator::post and RemoteSimulator::wait.
+  void post(CommandBasePtr cmd);
+  // Throws std::runtime_error if the command wasn't posted or its result was already waited.
+  CommandResultPtr wait(const CommandBasePtr& cmd);
+  // Same as above, also throwing past the deadline or once the token is cancelled. The command can be waited again
+  // then.
+  CommandResultPtr wait(const CommandBasePtr& cmd,
+                        std::chrono::steady_clock::time_point deadline,
+                        const CancellationToken* token);
+
+  // Stops the threads, pending commands fail. The client connection is unusable afterward.
+  void stop();
+  bool isRunning() const;
+
+  // Results of posted commands that are never waited are forgotten past this count
+  static constexpr size_t MaxPostedResults = 10000;
+
+private:
+  struct Pending;
+  struct Node;
+
+  void push(Node* node);
+  Node* pop();
+  void writeLoop();
+  void readLoop();
+  void failAll(const std::string& error);
+  void failQueued();
+
+  CmdClient& m_client;
+  std::atomic<bool> m_running;
+
+  // Vyukov intrusive MPSC queue: producers exchange the head, the writer thread owns the tail
+  std::atomic<Node*> m_head;
+  Node* m_tail;
+  std::unique_ptr<Node> m_stub;
+  std::atomic<uint32_t> m_signal;
+  std::atomic<int> m_submitting; // Submits past the isRunning check that may not have pushed their node yet
+
+  // Commands sent and waiting for their result, by uuid
+  std::mutex m_pendingMutex;
+  std::unordered_map<std::string, std::shared_ptr<Pending>> m_pending;
+  bool m_failed;
+  std::string m_error;
+
+  std::mutex m_postedMutex;
+  std::unordered_map<std::string, std::shared_future<CommandResultPtr>> m_posted;
+  std::deque<std::string> m_postedOrder;
+
+  std::thread m_writer;
+  std::thread m_reader;
+};
+
+} // namespace Sdx
+
+#endif // COMMAND_DISPATCHER_H
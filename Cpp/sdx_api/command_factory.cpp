@@ -2,9 +2,11 @@
 
 #include <rapidjson/document.h>
 
+#include <algorithm>
 #include <iostream>
 #include <unordered_map>
 
+#include "all_command_names_generated_code.h"
 #include "command_base.h"
 #include "command_result.h"
 
@@ -43,11 +45,14 @@ CommandFactory* CommandFactory::instance()
 
 CommandFactory::CommandFactory() : m(std::make_unique<Pimpl>())
 {
+  // Links every generated command with sdx_api as a static library, even those the application doesn't refer to, so
+  // that they are all registered: any result can be decoded and every command created by name.
+  Cmd::allCommandNames();
 }
 
 CommandFactory::~CommandFactory() = default;
 
-CommandBasePtr CommandFactory::createCommand(const std::string& serializedCommand, std::string* errorMsg)
+CommandBasePtr CommandFactory::createCommand(std::string_view serializedCommand, std::string* errorMsg)
 {
   if (errorMsg)
   {
@@ -60,22 +65,27 @@ CommandBasePtr CommandFactory::createCommand(const std::string& serializedComman
     return nullptr;
   }
 
+  return createCommand(std::move(doc), errorMsg);
+}
+
+CommandBasePtr CommandFactory::createCommand(rapidjson::Document&& doc, std::string* errorMsg)
+{
+  if (errorMsg)
+  {
+    errorMsg->clear();
+  }
+
   const auto& factory = m->getFactoryFromJson(doc);
   const std::string cmdName = doc[CommandBase::CmdNameKey.c_str()].GetString();
 
-  if (const auto it = factory.find(cmdName); it != m->factory.end())
+  if (const auto it = factory.find(cmdName); it != factory.end())
   {
+    // The parsed document becomes the command values, its strings being owned by its allocator
     auto cmd = it->second();
-    cmd->m_values.CopyFrom(doc, cmd->m_values.GetAllocator());
+    cmd->m_values.Swap(doc);
 
-    rapidjson::Value& uuidValue = doc[CommandBase::CmdUuidKey.c_str()];
-    cmd->m_cmdUuid = uuidValue.GetString();
-
-    rapidjson::Value newValue;
-    newValue.SetString(cmd->m_cmdUuid.c_str(),
-                       static_cast<rapidjson::SizeType>(cmd->m_cmdUuid.size()),
-                       cmd->m_values.GetAllocator());
-    cmd->setValue(CommandBase::CmdUuidKey, newValue);
+    const rapidjson::Value& uuidValue = cmd->m_values[CommandBase::CmdUuidKey.c_str()];
+    cmd->m_cmdUuid.assign(uuidValue.GetString(), uuidValue.GetStringLength());
 
     if (cmd->isValid())
     {
@@ -84,7 +94,7 @@ CommandBasePtr CommandFactory::createCommand(const std::string& serializedComman
 
     if (errorMsg)
     {
-      *errorMsg = "Invalid command: " + serializedCommand;
+      *errorMsg = "Invalid command: " + cmd->toString();
     }
   }
   else
@@ -97,11 +107,29 @@ CommandBasePtr CommandFactory::createCommand(const std::string& serializedComman
   return nullptr;
 }
 
-CommandResultPtr CommandFactory::createCommandResult(const std::string& serializedCommand, std::string* errorMsg)
+CommandResultPtr CommandFactory::createCommandResult(std::string_view serializedCommand, std::string* errorMsg)
+{
+  if (errorMsg)
+  {
+    errorMsg->clear();
+  }
+
+  rapidjson::Document doc;
+  if (!CommandBase::parse(serializedCommand, doc, errorMsg))
+  {
+    return nullptr;
+  }
+
+  return createCommandResult(std::move(doc), errorMsg);
+}
+
+CommandResultPtr CommandFactory::createCommandResult(rapidjson::Document&& doc, std::string* errorMsg)
 {
-  if (auto result = CommandResult::dynamicCast(createCommand(serializedCommand, errorMsg)))
+  if (auto result = CommandResult::dynamicCast(createCommand(std::move(doc), errorMsg)))
   {
-    result->m_relatedCommand = createCommand(result->value(CommandResult::RelatedCommand).GetString(), errorMsg);
+    const rapidjson::Value& relatedCommand = result->value(CommandResult::RelatedCommand);
+    result->m_relatedCommand =
+      createCommand(std::string_view(relatedCommand.GetString(), relatedCommand.GetStringLength()), errorMsg);
 
     if (result->m_relatedCommand)
     {
@@ -129,4 +157,21 @@ void CommandFactory::registerFactoryFunction(const std::string& targetID,
   }
 }
 
+std::vector<std::string> CommandFactory::registeredNames() const
+{
+  std::vector<std::string> names;
+  names.reserve(m->factory.size());
+  for (const auto& [name, fct] : m->factory)
+    names.push_back(name);
+  std::sort(names.begin(), names.end());
+  return names;
+}
+
+CommandBasePtr CommandFactory::createEmptyCommand(const std::string& cmdName) const
+{
+  if (const auto it = m->factory.find(cmdName); it != m->factory.end())
+    return it->second();
+  return nullptr;
+}
+
 } // namespace Sdx
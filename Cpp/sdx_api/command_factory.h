@@ -5,6 +5,9 @@
 #include <rapidjson/writer.h>
 
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include "command_base.h"
 #include "parse_json.hpp"
@@ -43,11 +46,20 @@ class CommandFactory
 public:
   static CommandFactory* instance();
   ~CommandFactory();
-  CommandBasePtr createCommand(const std::string& serializedCommand, std::string* errorMsg = nullptr);
-  CommandResultPtr createCommandResult(const std::string& serializedCommand, std::string* errorMsg = nullptr);
+  CommandBasePtr createCommand(std::string_view serializedCommand, std::string* errorMsg = nullptr);
+  // Same as above with an already parsed command: the command takes the values of doc, left empty, without a copy
+  CommandBasePtr createCommand(rapidjson::Document&& doc, std::string* errorMsg = nullptr);
+  CommandResultPtr createCommandResult(std::string_view serializedCommand, std::string* errorMsg = nullptr);
+  CommandResultPtr createCommandResult(rapidjson::Document&& doc, std::string* errorMsg = nullptr);
   using FactoryFunction = CommandBasePtr (*)();
   void registerFactoryFunction(const std::string& targetID, const std::string& cmdName, FactoryFunction fct);
 
+  // Names of all the commands and results registered without target id, sorted. Every generated command is registered,
+  // see Cmd::allCommandNames.
+  std::vector<std::string> registeredNames() const;
+  // Default constructed command without any field set, nullptr if cmdName is not registered
+  CommandBasePtr createEmptyCommand(const std::string& cmdName) const;
+
 private:
   CommandFactory();
   struct Pimpl;
@@ -67,10 +79,9 @@ struct parse_json<Sdx::CommandBasePtr>
     if (!is_valid(value))
       throw std::runtime_error("Unexpected value");
     std::string error;
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-    value.Accept(writer);
-    Sdx::CommandBasePtr ret = Sdx::CommandFactory::instance()->createCommand(buffer.GetString(), &error);
+    rapidjson::Document doc;
+    doc.CopyFrom(value, doc.GetAllocator());
+    Sdx::CommandBasePtr ret = Sdx::CommandFactory::instance()->createCommand(std::move(doc), &error);
     if (!error.empty())
       throw std::runtime_error("Unexpected value: " + error);
     return ret;
@@ -79,7 +90,8 @@ struct parse_json<Sdx::CommandBasePtr>
   static rapidjson::Document format(const Sdx::CommandBasePtr& ptr, rapidjson::Value::AllocatorType& alloc)
   {
     rapidjson::Document doc;
-    doc.CopyFrom(ptr->values(), alloc);
+    // The UUID of a renewed command refers to the command, it must be copied
+    doc.CopyFrom(ptr->values(), alloc, true);
     return doc;
   }
 };
@@ -0,0 +1,147 @@
+#include "command_metadata.h"
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "all_command_names_generated_code.h"
+
+namespace Sdx
+{
+
+namespace
+{
+const std::unordered_set<std::string>& commandNames()
+{
+  static const std::unordered_set<std::string> names(Cmd::allCommandNames().begin(), Cmd::allCommandNames().end());
+  return names;
+}
+
+bool isCommand(const std::string& name)
+{
+  return commandNames().count(name) != 0;
+}
+
+// Paired queries by setter name
+const std::unordered_map<std::string, std::string>& pairedQueries()
+{
+  static const std::unordered_map<std::string, std::string> queries = [] {
+    std::unordered_map<std::string, std::string> map;
+    for (const std::string& name : commandNames())
+    {
+      std::string setter = CommandMetadata::pairedSetter(name);
+      if (!setter.empty())
+        map.emplace(std::move(setter), name);
+    }
+    return map;
+  }();
+  return queries;
+}
+
+// Families of the paired setters
+const std::unordered_set<std::string>& pairedFamilies()
+{
+  static const std::unordered_set<std::string> families = [] {
+    std::unordered_set<std::string> set;
+    for (const auto& [setter, query] : pairedQueries())
+      set.insert(CommandMetadata::subjectFamily(CommandMetadata::subject(setter)));
+    return set;
+  }();
+  return families;
+}
+
+void replaceAll(std::string& str, const std::string& from, const std::string& to)
+{
+  for (size_t pos = str.find(from); pos != std::string::npos; pos = str.find(from, pos + to.size()))
+    str.replace(pos, from.size(), to);
+}
+} // namespace
+
+bool CommandMetadata::isQuery(const std::string& cmdName)
+{
+  return isCommand(cmdName) && isCommand(cmdName + "Result");
+}
+
+std::string CommandMetadata::pairedSetter(const std::string& queryName)
+{
+  if (!isQuery(queryName))
+    return {};
+
+  std::string setter;
+  if (queryName.starts_with("Get"))
+    setter = "Set" + subject(queryName);
+  else if (queryName.starts_with("Is") && queryName.find("Enabled") != std::string::npos)
+    setter = "Enable" + subject(queryName);
+
+  return !setter.empty() && isCommand(setter) ? setter : std::string();
+}
+
+std::string CommandMetadata::pairedQuery(const std::string& setterName)
+{
+  const auto& queries = pairedQueries();
+  auto it = queries.find(setterName);
+  return it != queries.end() ? it->second : std::string();
+}
+
+std::string CommandMetadata::subject(const std::string& cmdName)
+{
+  if (cmdName.starts_with("Get") || cmdName.starts_with("Set"))
+    return cmdName.substr(3);
+  if (cmdName.starts_with("Enable"))
+    return cmdName.substr(6);
+  if (cmdName.starts_with("Is"))
+  {
+    const size_t enabled = cmdName.find("Enabled", 2);
+    if (enabled != std::string::npos)
+      return cmdName.substr(2, enabled - 2) + cmdName.substr(enabled + 7);
+  }
+  return {};
+}
+
+std::string CommandMetadata::subjectFamily(const std::string& subject)
+{
+  std::string family = subject;
+  replaceAll(family, "ForEachSV", "");
+  replaceAll(family, "ForSV", "");
+  replaceAll(family, "EachSV", "SV");
+  return family;
+}
+
+bool CommandMetadata::isLinkedFamily(const std::string& family)
+{
+  static const std::unordered_set<std::string> linked = [] {
+    std::unordered_set<std::string> set;
+    for (const std::string& f : pairedFamilies())
+    {
+      // The constellation parameters are the ephemeris parameters of every constellation
+      if (f == "ConstellationParameter" || f.find("EphBoolParam") != std::string::npos ||
+          f.find("EphDoubleParam") != std::string::npos || f.find("EphParams") != std::string::npos)
+        set.insert(f);
+      for (const std::string& other : pairedFamilies())
+      {
+        if (other != f && other.starts_with(f))
+        {
+          set.insert(f);
+          set.insert(other);
+        }
+      }
+    }
+    return set;
+  }();
+  return linked.count(family) != 0;
+}
+
+std::string CommandMetadata::forEachSvVariant(const std::string& forSvName)
+{
+  if (!forSvName.ends_with("ForSV"))
+    return {};
+  std::string variant = forSvName.substr(0, forSvName.size() - 5) + "ForEachSV";
+  return isCommand(variant) ? variant : std::string();
+}
+
+bool CommandMetadata::resetsConfiguration(const std::string& cmdName)
+{
+  return cmdName == "New" || cmdName == "Open" || cmdName == "ResetDefaultConfiguration";
+}
+
+} // namespace Sdx
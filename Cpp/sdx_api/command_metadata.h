@@ -0,0 +1,45 @@
+#ifndef COMMAND_METADATA_H
+#define COMMAND_METADATA_H
+
+#include <string>
+
+namespace Sdx
+{
+
+// Relations between the generated commands, derived from their names (see Cmd::allCommandNames) whatever the
+// commands linked in the application.
+//
+// A command is a query if it has its own result type (GetX and XResult). A query and a setter are paired when they
+// share a subject: GetX and SetX, or IsXEnabledY and EnableXY.
+class CommandMetadata
+{
+public:
+  static bool isQuery(const std::string& cmdName);
+
+  // Setter paired with the query, empty if there is none
+  static std::string pairedSetter(const std::string& queryName);
+
+  // Query paired with the setter, empty if there is none
+  static std::string pairedQuery(const std::string& setterName);
+
+  // Subject of a Get, Set, Is..Enabled or Enable command, empty for the other commands
+  static std::string subject(const std::string& cmdName);
+
+  // Subject without its satellite selection, so that SetXForEachSV and GetXForSV share the same family
+  static std::string subjectFamily(const std::string& subject);
+
+  // True if the setters of the family may change the queries of another family, or the reverse: its subject prefixes
+  // or extends another paired subject (SetVehicleTrajectoryCircular changes GetVehicleTrajectory), or it is one of the
+  // ephemeris parameters also set by SetConstellationParameterForSV.
+  static bool isLinkedFamily(const std::string& family);
+
+  // ForEachSV variant of a ForSV command (EnableSignalForEachSV for EnableSignalForSV), empty if there is none
+  static std::string forEachSvVariant(const std::string& forSvName);
+
+  // Commands replacing the whole configuration: New, Open and ResetDefaultConfiguration
+  static bool resetsConfiguration(const std::string& cmdName);
+};
+
+} // namespace Sdx
+
+#endif // COMMAND_METADATA_H
@@ -0,0 +1,90 @@
+#include "command_scheduler.h"
+
+#include <stdexcept>
+
+#include "all_commands.h"
+#include "command_blob.h"
+#include "remote_simulator.h"
+
+namespace Sdx
+{
+
+CommandScheduler::CommandScheduler(RemoteSimulator& simulator, double horizon) :
+  m_simulator(simulator),
+  m_horizon(horizon),
+  m_nextSequence(0),
+  m_synced(false),
+  m_syncElapsedTime(0.0),
+  m_syncPeriod(1000)
+{
+}
+
+void CommandScheduler::setHorizon(double horizon)
+{
+  m_horizon = horizon;
+}
+
+void CommandScheduler::setSyncPeriod(std::chrono::milliseconds period)
+{
+  m_syncPeriod = period;
+}
+
+void CommandScheduler::schedule(CommandBasePtr cmd, double timestamp)
+{
+  m_queue.push({timestamp, m_nextSequence++, cmd});
+}
+
+void CommandScheduler::clear()
+{
+  m_queue = {};
+}
+
+double CommandScheduler::nextTimestamp() const
+{
+  if (m_queue.empty())
+    throw std::runtime_error("No scheduled command.");
+  return m_queue.top().timestamp;
+}
+
+size_t CommandScheduler::update(double elapsedTime)
+{
+  const double limit = elapsedTime + m_horizon;
+  CommandBlob batch;
+  while (!m_queue.empty() && m_queue.top().timestamp <= limit)
+  {
+    const Entry& entry = m_queue.top();
+    entry.cmd->setTimestamp(entry.timestamp);
+    batch.append(entry.cmd, m_simulator.serializationPolicy());
+    m_queue.pop();
+  }
+
+  if (!batch.isEmpty())
+    m_simulator.postBlob(batch);
+  return batch.commandCount();
+}
+
+size_t CommandScheduler::update()
+{
+  if (m_queue.empty())
+    return 0;
+  return update(elapsedTime());
+}
+
+double CommandScheduler::elapsedTime()
+{
+  const auto now = std::chrono::steady_clock::now();
+  if (!m_synced || now - m_syncTime >= m_syncPeriod)
+  {
+    auto result = Cmd::SimulationElapsedTimeResult::dynamicCast(
+      m_simulator.call(Cmd::GetSimulationElapsedTime::create()));
+    if (!result)
+      throw std::runtime_error("Unable to get the simulation elapsed time.");
+    m_syncElapsedTime = result->milliseconds() / 1000.0;
+    m_syncTime = now;
+    m_synced = true;
+    return m_syncElapsedTime;
+  }
+  return m_syncElapsedTime + std::chrono::duration<double>(now - m_syncTime).count();
+}
+
+} // namespace Sdx
@@ -0,0 +1,78 @@
+#ifndef COMMAND_SCHEDULER_H
+#define COMMAND_SCHEDULER_H
+
+#include <chrono>
+#include <cstdint>
+#include <queue>
+#include <vector>
+
+#include "command_base.h"
+
+namespace Sdx
+{
+
+class RemoteSimulator;
+
+// Holds timestamped commands on the client and posts them shortly before they are due.
+//
+// Commands are kept in a priority queue ordered by timestamp (simulation time in seconds, as for
+// RemoteSimulator::post), commands with the same timestamp keep their scheduling order. Each update posts, as a single
+// write, every command due within the horizon ahead of the simulation elapsed time, so the simulator only ever
+// queues a horizon worth of commands.
+//
+// The elapsed time is estimated on the client from the last GetSimulationElapsedTime answer and the local clock, and
+// resynchronized every sync period.
+class CommandScheduler
+{
+public:
+  explicit CommandScheduler(RemoteSimulator& simulator, double horizon = 5.0);
+
+  void setHorizon(double horizon); // seconds
+  inline double horizon() const { return m_horizon; }
+  void setSyncPeriod(std::chrono::milliseconds period);
+
+  void schedule(CommandBasePtr cmd, double timestamp);
+  void clear();
+
+  inline size_t pendingCount() const { return m_queue.size(); }
+  inline bool isEmpty() const { return m_queue.empty(); }
+  // Timestamp of the next command to post, must not be empty
+  double nextTimestamp() const;
+
+  // Posts the commands due before elapsedTime + horizon, elapsedTime in seconds. Returns the number of posted commands.
+  size_t update(double elapsedTime);
+  // Same as above with the estimated simulation elapsed time
+  size_t update();
+
+  // Estimated simulation elapsed time in seconds, synchronized with the simulator if the last sync is too old
+  double elapsedTime();
+  // Forces the next elapsedTime() to ask the simulator, call after start or stop
+  inline void invalidateElapsedTime() { m_synced = false; }
+
+private:
+  struct Entry
+  {
+    double timestamp;
+    uint64_t sequence;
+    CommandBasePtr cmd;
+
+    inline bool operator>(const Entry& other) const
+    {
+      return timestamp > other.timestamp || (timestamp == other.timestamp && sequence > other.sequence);
+    }
+  };
+
+  RemoteSimulator& m_simulator;
+  double m_horizon;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> m_queue;
+  uint64_t m_nextSequence;
+
+  bool m_synced;
+  double m_syncElapsedTime;
+  std::chrono::steady_clock::time_point m_syncTime;
+  std::chrono::milliseconds m_syncPeriod;
+};
+
+} // namespace Sdx
+
+#endif // COMMAND_SCHEDULER_H
@@ -0,0 +1,156 @@
+#include "command_template.h"
+
+#include <rapidjson/internal/dtoa.h>
+#include <rapidjson/internal/itoa.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+#include "cmd_client.h"
+
+namespace Sdx
+{
+
+namespace
+{
+constexpr size_t MaxMessageSize = 65535;
+constexpr size_t HeaderSize = 3; // [uint16 size][uint8 message id]
+
+std::string toJson(const rapidjson::Value& value, const PrecisionPolicy* policy)
+{
+  if (policy)
+    return policy->write(value);
+  rapidjson::StringBuffer sb;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+  value.Accept(writer);
+  return std::string(sb.GetString(), sb.GetSize());
+}
+} // namespace
+
+CommandTemplate::CommandTemplate(const CommandBasePtr& prototype,
+                                 const std::vector<std::string>& slotFields,
+                                 const PrecisionPolicy* policy) :
+  m_name(prototype->name()),
+  m_uuid()
+{
+  const std::string uuid = prototype->uuid();
+  if (uuid.size() != UuidSize)
+    throw std::runtime_error("Command " + m_name + " has no valid UUID.");
+
+  // The slot values are replaced by markers, strings made unique by the command UUID, located once serialized
+  rapidjson::Document doc;
+  doc.CopyFrom(prototype->values(), doc.GetAllocator());
+  std::vector<std::string> markers;
+  m_slots.reserve(slotFields.size());
+  for (const std::string& field : slotFields)
+  {
+    auto it = doc.FindMember(field.c_str());
+    if (it == doc.MemberEnd() || !it->value.IsNumber())
+      throw std::runtime_error("Command " + m_name + " has no number member " + field + ".");
+
+    Slot slot;
+    slot.isInt = it->value.IsInt();
+    slot.decimals = -1;
+    if (policy && !slot.isInt)
+      slot.decimals = policy->decimals(field) >= 0 ? policy->decimals(field) : policy->defaultDecimals();
+    m_slots.push_back(slot);
+    if (slot.isInt)
+      setInt(m_slots.size() - 1, it->value.GetInt());
+    else
+      setDouble(m_slots.size() - 1, it->value.GetDouble());
+
+    markers.push_back("\"" + uuid + ":" + std::to_string(markers.size()) + "\"");
+    it->value.SetString(markers.back().c_str() + 1, markers.back().size() - 2, doc.GetAllocator());
+  }
+
+  const std::string json = toJson(doc, policy);
+  struct Replaced
+  {
+    size_t position;
+    size_t size;
+    size_t slot;
+  };
+  std::vector<Replaced> replaced;
+  const size_t uuidPosition = json.find("\"" + uuid + "\"");
+  if (uuidPosition == std::string::npos)
+    throw std::runtime_error("Command " + m_name + " has no valid UUID.");
+  replaced.push_back({uuidPosition + 1, UuidSize, UuidHole});
+  for (size_t i = 0; i < markers.size(); ++i)
+    replaced.push_back({json.find(markers[i]), markers[i].size(), i});
+  std::sort(replaced.begin(), replaced.end(), [](const Replaced& a, const Replaced& b) {
+    return a.position < b.position;
+  });
+
+  size_t position = 0;
+  for (const Replaced& r : replaced)
+  {
+    m_literals.append(json, position, r.position - position);
+    m_holes.push_back({m_literals.size(), r.slot});
+    position = r.position + r.size;
+  }
+  m_literals.append(json, position, std::string::npos);
+
+  if (HeaderSize + m_literals.size() + UuidSize + m_slots.size() * PrecisionPolicy::FormatBufferSize + 1 >
+      MaxMessageSize)
+    throw std::runtime_error("Command " + m_name + " is too large to be sent in a message.");
+  m_message.reserve(MaxMessageSize);
+  memcpy(m_uuid, uuid.data(), UuidSize);
+}
+
+void CommandTemplate::setDouble(size_t slot, double value)
+{
+  if (!std::isfinite(value))
+    throw std::runtime_error("Cannot send a value that is not finite in " + m_name + ".");
+
+  Slot& s = m_slots[slot];
+  if (s.isInt)
+  {
+    setInt(slot, static_cast<int>(value));
+    return;
+  }
+  s.size = PrecisionPolicy::formatDouble(value, s.decimals, s.text);
+  if (s.size == 0)
+    s.size = static_cast<size_t>(rapidjson::internal::dtoa(value, s.text) - s.text);
+}
+
+void CommandTemplate::setInt(size_t slot, int value)
+{
+  Slot& s = m_slots[slot];
+  if (!s.isInt)
+  {
+    setDouble(slot, value);
+    return;
+  }
+  s.size = static_cast<size_t>(rapidjson::internal::i32toa(value, s.text) - s.text);
+}
+
+std::string_view CommandTemplate::render()
+{
+  CommandBase::writeRandomUuid(m_uuid);
+
+  m_message.resize(HeaderSize);
+  size_t position = 0;
+  for (const Hole& hole : m_holes)
+  {
+    m_message.append(m_literals, position, hole.literalEnd - position);
+    position = hole.literalEnd;
+    if (hole.slot == UuidHole)
+      m_message.append(m_uuid, UuidSize);
+    else
+      m_message.append(m_slots[hole.slot].text, m_slots[hole.slot].size);
+  }
+  m_message.append(m_literals, position, std::string::npos);
+  m_message.push_back('\0');
+
+  // Same framing as CmdClient::sendCommand
+  const uint16_t framedSize = static_cast<uint16_t>(m_message.size() - 2);
+  memcpy(m_message.data(), &framedSize, sizeof(framedSize));
+  m_message[2] = static_cast<char>(CmdMsgId_Command);
+  return m_message;
+}
+
+} // namespace Sdx
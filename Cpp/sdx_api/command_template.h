@@ -0,0 +1,75 @@
+#ifndef COMMAND_TEMPLATE_H
+#define COMMAND_TEMPLATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "command_base.h"
+#include "precision_policy.h"
+
+namespace Sdx
+{
+
+// Framed message of a command whose shape never changes, for commands sent in bulk such as PushTrackEcef.
+//
+// The prototype command is serialized once and split around its UUID and the values of the slot fields. Each render()
+// concatenates the literal segments with the slot values and a new UUID, so sending another node formats a few
+// numbers and copies a few bytes instead of building, serializing and framing a command object. The message is the
+// one CmdClient::sendCommand would send for the prototype with the slot values set.
+class CommandTemplate
+{
+public:
+  // The slot fields must be top level number members of the prototype: the int members are int slots, the others
+  // double slots. The double slots are formatted with the policy if not nullptr.
+  // Throws std::runtime_error if a slot field is not a number member or the message is too large.
+  CommandTemplate(const CommandBasePtr& prototype,
+                  const std::vector<std::string>& slotFields,
+                  const PrecisionPolicy* policy = nullptr);
+
+  inline const std::string& name() const { return m_name; }
+  inline size_t slotCount() const { return m_slots.size(); }
+
+  // Slots are indexed in the order of slotFields and keep their value between renders.
+  // Throws std::runtime_error if the value is not finite, as JSON has no representation for it.
+  void setDouble(size_t slot, double value);
+  void setInt(size_t slot, int value);
+
+  // Framed message with the current slot values and a new UUID, valid until the next render
+  std::string_view render();
+  // UUID of the last rendered message
+  inline std::string_view uuid() const { return std::string_view(m_uuid, UuidSize); }
+
+  static constexpr size_t UuidSize = CommandBase::UuidSize;
+
+private:
+  struct Slot
+  {
+    bool isInt;
+    int decimals; // -1 for the shortest round trip representation
+    size_t size;
+    char text[PrecisionPolicy::FormatBufferSize];
+  };
+
+  // Where a slot value or the UUID is written: after the literal ending at literalEnd in m_literals
+  struct Hole
+  {
+    size_t literalEnd;
+    size_t slot; // UuidHole for the UUID
+  };
+
+  static constexpr size_t UuidHole = SIZE_MAX;
+
+  std::string m_name;
+  std::string m_literals; // One literal before each hole, then the closing one
+  std::vector<Hole> m_holes;
+  std::vector<Slot> m_slots;
+  std::string m_message;
+  char m_uuid[UuidSize];
+};
+
+} // namespace Sdx
+
+#endif // COMMAND_TEMPLATE_H
@@ -92,7 +92,7 @@ namespace Sdx
 
     void AddDataSet::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -104,7 +104,7 @@ namespace Sdx
 
     void AddDataSet::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
@@ -116,7 +116,7 @@ namespace Sdx
 
     void AddDataSet::setRollover(const std::optional<int>& rollover)
     {
-      m_values.AddMember("Rollover", parse_json<std::optional<int>>::format(rollover, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Rollover", parse_json<std::optional<int>>::format(rollover, m_values.GetAllocator()));
     }
 
 
@@ -128,7 +128,7 @@ namespace Sdx
 
     void AddDataSet::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -140,7 +140,7 @@ namespace Sdx
 
     void AddDataSet::setNavMsgFamily(const std::optional<std::string>& navMsgFamily)
     {
-      m_values.AddMember("NavMsgFamily", parse_json<std::optional<std::string>>::format(navMsgFamily, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("NavMsgFamily", parse_json<std::optional<std::string>>::format(navMsgFamily, m_values.GetAllocator()));
     }
 
 
@@ -79,7 +79,7 @@ namespace Sdx
 
     void AddEmptySVAntennaModel::setName(const std::string& name)
     {
-      m_values.AddMember("Name", parse_json<std::string>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Name", parse_json<std::string>::format(name, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void AddEmptySVAntennaModel::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -85,7 +85,7 @@ namespace Sdx
 
     void AddSVGainPatternOffset::setBand(const Sdx::GNSSBand& band)
     {
-      m_values.AddMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()));
     }
 
 
@@ -97,7 +97,7 @@ namespace Sdx
 
     void AddSVGainPatternOffset::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -109,7 +109,7 @@ namespace Sdx
 
     void AddSVGainPatternOffset::setOffset(double offset)
     {
-      m_values.AddMember("Offset", parse_json<double>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Offset", parse_json<double>::format(offset, m_values.GetAllocator()));
     }
 
 
@@ -121,7 +121,7 @@ namespace Sdx
 
     void AddSVGainPatternOffset::setAntennaName(const std::optional<std::string>& antennaName)
     {
-      m_values.AddMember("AntennaName", parse_json<std::optional<std::string>>::format(antennaName, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("AntennaName", parse_json<std::optional<std::string>>::format(antennaName, m_values.GetAllocator()));
     }
 
 
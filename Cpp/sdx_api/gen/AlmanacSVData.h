@@ -39,17 +39,27 @@ struct parse_json<Sdx::AlmanacSVData>
 
     }
 
-    static Sdx::AlmanacSVData parse(const rapidjson::Value& value)
+    static std::optional<Sdx::AlmanacSVData> try_parse(const rapidjson::Value& value)
     {
-      if (!is_valid(value))
-        throw std::runtime_error("Unexpected value");
+      if (!value.IsObject())
+        return std::nullopt;
       Sdx::AlmanacSVData sent;
 
-      sent.SvId = parse_json<int>::parse(value["SvId"]);
-      sent.ParametersDict = parse_json<std::map<std::string, double>>::parse(value["ParametersDict"]);
+      if (!try_parse_json(value["SvId"], sent.SvId))
+        return std::nullopt;
+      if (!try_parse_json(value["ParametersDict"], sent.ParametersDict))
+        return std::nullopt;
       return sent;
     }
 
+    static Sdx::AlmanacSVData parse(const rapidjson::Value& value)
+    {
+      std::optional<Sdx::AlmanacSVData> sent = try_parse(value);
+      if (!sent)
+        throw std::runtime_error("Unexpected value");
+      return std::move(*sent);
+    }
+
     static rapidjson::Value format(const Sdx::AlmanacSVData& value, rapidjson::Value::AllocatorType& alloc)
     {
       rapidjson::Value sent(rapidjson::kObjectType);
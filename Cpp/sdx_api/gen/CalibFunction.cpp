@@ -91,7 +91,7 @@ namespace Sdx
 
     void CalibFunction::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -103,7 +103,7 @@ namespace Sdx
 
     void CalibFunction::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
@@ -115,7 +115,7 @@ namespace Sdx
 
     void CalibFunction::setEnableSV(bool enableSV)
     {
-      m_values.AddMember("EnableSV", parse_json<bool>::format(enableSV, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("EnableSV", parse_json<bool>::format(enableSV, m_values.GetAllocator()));
     }
 
 
@@ -127,7 +127,7 @@ namespace Sdx
 
     void CalibFunction::setEnableDoppler(bool enableDoppler)
     {
-      m_values.AddMember("EnableDoppler", parse_json<bool>::format(enableDoppler, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("EnableDoppler", parse_json<bool>::format(enableDoppler, m_values.GetAllocator()));
     }
 
 
@@ -139,7 +139,7 @@ namespace Sdx
 
     void CalibFunction::setPhaseOffet(double phaseOffet)
     {
-      m_values.AddMember("PhaseOffet", parse_json<double>::format(phaseOffet, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffet", parse_json<double>::format(phaseOffet, m_values.GetAllocator()));
     }
 
 
@@ -79,7 +79,7 @@ namespace Sdx
 
     void ChangeCustomSignalColor::setColor(const std::string& color)
     {
-      m_values.AddMember("Color", parse_json<std::string>::format(color, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Color", parse_json<std::string>::format(color, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void ChangeCustomSignalColor::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
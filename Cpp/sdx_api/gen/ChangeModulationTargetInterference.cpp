@@ -100,7 +100,7 @@ namespace Sdx
 
     void ChangeModulationTargetInterference::setOutput(int output)
     {
-      m_values.AddMember("Output", parse_json<int>::format(output, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Output", parse_json<int>::format(output, m_values.GetAllocator()));
     }
 
 
@@ -112,7 +112,7 @@ namespace Sdx
 
     void ChangeModulationTargetInterference::setMinRate(int minRate)
     {
-      m_values.AddMember("MinRate", parse_json<int>::format(minRate, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("MinRate", parse_json<int>::format(minRate, m_values.GetAllocator()));
     }
 
 
@@ -124,7 +124,7 @@ namespace Sdx
 
     void ChangeModulationTargetInterference::setMaxRate(int maxRate)
     {
-      m_values.AddMember("MaxRate", parse_json<int>::format(maxRate, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("MaxRate", parse_json<int>::format(maxRate, m_values.GetAllocator()));
     }
 
 
@@ -136,7 +136,7 @@ namespace Sdx
 
     void ChangeModulationTargetInterference::setGroup(int group)
     {
-      m_values.AddMember("Group", parse_json<int>::format(group, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Group", parse_json<int>::format(group, m_values.GetAllocator()));
     }
 
 
@@ -148,7 +148,7 @@ namespace Sdx
 
     void ChangeModulationTargetInterference::setCentralFreq(double centralFreq)
     {
-      m_values.AddMember("CentralFreq", parse_json<double>::format(centralFreq, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("CentralFreq", parse_json<double>::format(centralFreq, m_values.GetAllocator()));
     }
 
 
@@ -160,7 +160,7 @@ namespace Sdx
 
     void ChangeModulationTargetInterference::setGain(int gain)
     {
-      m_values.AddMember("Gain", parse_json<int>::format(gain, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Gain", parse_json<int>::format(gain, m_values.GetAllocator()));
     }
 
 
@@ -172,7 +172,7 @@ namespace Sdx
 
     void ChangeModulationTargetInterference::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -184,7 +184,7 @@ namespace Sdx
 
     void ChangeModulationTargetInterference::setSignal(const std::optional<std::string>& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::optional<std::string>>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Signal", parse_json<std::optional<std::string>>::format(signal, m_values.GetAllocator()));
     }
 
 
@@ -102,7 +102,7 @@ namespace Sdx
 
     void ChangeModulationTargetSignals::setOutput(int output)
     {
-      m_values.AddMember("Output", parse_json<int>::format(output, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Output", parse_json<int>::format(output, m_values.GetAllocator()));
     }
 
 
@@ -114,7 +114,7 @@ namespace Sdx
 
     void ChangeModulationTargetSignals::setMinRate(int minRate)
     {
-      m_values.AddMember("MinRate", parse_json<int>::format(minRate, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("MinRate", parse_json<int>::format(minRate, m_values.GetAllocator()));
     }
 
 
@@ -126,7 +126,7 @@ namespace Sdx
 
     void ChangeModulationTargetSignals::setMaxRate(int maxRate)
     {
-      m_values.AddMember("MaxRate", parse_json<int>::format(maxRate, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("MaxRate", parse_json<int>::format(maxRate, m_values.GetAllocator()));
     }
 
 
@@ -138,7 +138,7 @@ namespace Sdx
 
     void ChangeModulationTargetSignals::setBand(const std::string& band)
     {
-      m_values.AddMember("Band", parse_json<std::string>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Band", parse_json<std::string>::format(band, m_values.GetAllocator()));
     }
 
 
@@ -150,7 +150,7 @@ namespace Sdx
 
     void ChangeModulationTargetSignals::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
@@ -162,7 +162,7 @@ namespace Sdx
 
     void ChangeModulationTargetSignals::setGain(int gain)
     {
-      m_values.AddMember("Gain", parse_json<int>::format(gain, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Gain", parse_json<int>::format(gain, m_values.GetAllocator()));
     }
 
 
@@ -174,7 +174,7 @@ namespace Sdx
 
     void ChangeModulationTargetSignals::setGaussianNoise(bool gaussianNoise)
     {
-      m_values.AddMember("GaussianNoise", parse_json<bool>::format(gaussianNoise, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GaussianNoise", parse_json<bool>::format(gaussianNoise, m_values.GetAllocator()));
     }
 
 
@@ -186,7 +186,7 @@ namespace Sdx
 
     void ChangeModulationTargetSignals::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -198,7 +198,7 @@ namespace Sdx
 
     void ChangeModulationTargetSignals::setCentralFrequency(const std::optional<double>& centralFrequency)
     {
-      m_values.AddMember("CentralFrequency", parse_json<std::optional<double>>::format(centralFrequency, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("CentralFrequency", parse_json<std::optional<double>>::format(centralFrequency, m_values.GetAllocator()));
     }
 
 
@@ -76,7 +76,7 @@ namespace Sdx
 
     void ClearAllLOSForSystem::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -81,7 +81,7 @@ namespace Sdx
 
     void ClearAllMessageModifications::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
@@ -76,7 +76,7 @@ namespace Sdx
 
     void ClearAllMessageModificationsForNavMsgFamily::setNavMsgFamily(const std::string& navMsgFamily)
     {
-      m_values.AddMember("NavMsgFamily", parse_json<std::string>::format(navMsgFamily, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("NavMsgFamily", parse_json<std::string>::format(navMsgFamily, m_values.GetAllocator()));
     }
 
 
@@ -79,7 +79,7 @@ namespace Sdx
 
     void ClearSpoofTxGpuIdx::setSignalId(int signalId)
     {
-      m_values.AddMember("SignalId", parse_json<int>::format(signalId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SignalId", parse_json<int>::format(signalId, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void ClearSpoofTxGpuIdx::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -34,17 +34,27 @@ struct parse_json<Sdx::ElevationAzimuth>
 
     }
 
-    static Sdx::ElevationAzimuth parse(const rapidjson::Value& value)
+    static std::optional<Sdx::ElevationAzimuth> try_parse(const rapidjson::Value& value)
     {
-      if (!is_valid(value))
-        throw std::runtime_error("Unexpected value");
+      if (!value.IsObject())
+        return std::nullopt;
       Sdx::ElevationAzimuth sent;
 
-      sent.Elevation = parse_json<double>::parse(value["Elevation"]);
-      sent.Azimuth = parse_json<double>::parse(value["Azimuth"]);
+      if (!try_parse_json(value["Elevation"], sent.Elevation))
+        return std::nullopt;
+      if (!try_parse_json(value["Azimuth"], sent.Azimuth))
+        return std::nullopt;
       return sent;
     }
 
+    static Sdx::ElevationAzimuth parse(const rapidjson::Value& value)
+    {
+      std::optional<Sdx::ElevationAzimuth> sent = try_parse(value);
+      if (!sent)
+        throw std::runtime_error("Unexpected value");
+      return std::move(*sent);
+    }
+
     static rapidjson::Value format(const Sdx::ElevationAzimuth& value, rapidjson::Value::AllocatorType& alloc)
     {
       rapidjson::Value sent(rapidjson::kObjectType);
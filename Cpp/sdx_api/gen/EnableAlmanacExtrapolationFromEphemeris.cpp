@@ -77,7 +77,7 @@ namespace Sdx
 
     void EnableAlmanacExtrapolationFromEphemeris::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -79,7 +79,7 @@ namespace Sdx
 
     void EnableEachSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void EnableEachSV::setEnabled(const std::vector<bool>& enabled)
     {
-      m_values.AddMember("Enabled", parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Enabled", parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -76,7 +76,7 @@ namespace Sdx
 
     void EnableEarthMask::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -76,7 +76,7 @@ namespace Sdx
 
     void EnableIonoOffset::setIsEnabled(bool isEnabled)
     {
-      m_values.AddMember("IsEnabled", parse_json<bool>::format(isEnabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("IsEnabled", parse_json<bool>::format(isEnabled, m_values.GetAllocator()));
     }
 
 
@@ -80,7 +80,7 @@ namespace Sdx
 
     void EnableLogNmea::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -92,7 +92,7 @@ namespace Sdx
 
     void EnableLogNmea::setSerialPortEnabled(const std::optional<bool>& serialPortEnabled)
     {
-      m_values.AddMember("SerialPortEnabled", parse_json<std::optional<bool>>::format(serialPortEnabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SerialPortEnabled", parse_json<std::optional<bool>>::format(serialPortEnabled, m_values.GetAllocator()));
     }
 
 
@@ -83,7 +83,7 @@ namespace Sdx
 
     void EnableSbasFastCorrectionsFor::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -95,7 +95,7 @@ namespace Sdx
 
     void EnableSbasFastCorrectionsFor::setIsEnabled(bool isEnabled)
     {
-      m_values.AddMember("IsEnabled", parse_json<bool>::format(isEnabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("IsEnabled", parse_json<bool>::format(isEnabled, m_values.GetAllocator()));
     }
 
 
@@ -107,7 +107,7 @@ namespace Sdx
 
     void EnableSbasFastCorrectionsFor::setErrorType(const std::optional<std::string>& errorType)
     {
-      m_values.AddMember("ErrorType", parse_json<std::optional<std::string>>::format(errorType, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("ErrorType", parse_json<std::optional<std::string>>::format(errorType, m_values.GetAllocator()));
     }
 
 
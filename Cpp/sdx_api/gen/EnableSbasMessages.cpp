@@ -76,7 +76,7 @@ namespace Sdx
 
     void EnableSbasMessages::setMessages(const std::vector<int>& messages)
     {
-      m_values.AddMember("Messages", parse_json<std::vector<int>>::format(messages, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Messages", parse_json<std::vector<int>>::format(messages, m_values.GetAllocator()));
     }
 
 
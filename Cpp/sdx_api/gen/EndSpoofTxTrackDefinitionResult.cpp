@@ -86,7 +86,7 @@ namespace Sdx
 
     void EndSpoofTxTrackDefinitionResult::setCount(int count)
     {
-      m_values.AddMember("Count", parse_json<int>::format(count, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Count", parse_json<int>::format(count, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +98,7 @@ namespace Sdx
 
     void EndSpoofTxTrackDefinitionResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
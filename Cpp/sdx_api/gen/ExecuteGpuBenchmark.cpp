@@ -84,7 +84,7 @@ namespace Sdx
 
     void ExecuteGpuBenchmark::setDurationMs(int durationMs)
     {
-      m_values.AddMember("DurationMs", parse_json<int>::format(durationMs, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("DurationMs", parse_json<int>::format(durationMs, m_values.GetAllocator()));
     }
 
 
@@ -96,7 +96,7 @@ namespace Sdx
 
     void ExecuteGpuBenchmark::setSystemSvCountDict(const std::map<std::string, int>& systemSvCountDict)
     {
-      m_values.AddMember("SystemSvCountDict", parse_json<std::map<std::string, int>>::format(systemSvCountDict, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SystemSvCountDict", parse_json<std::map<std::string, int>>::format(systemSvCountDict, m_values.GetAllocator()));
     }
 
 
@@ -108,7 +108,7 @@ namespace Sdx
 
     void ExecuteGpuBenchmark::setEchoCount(int echoCount)
     {
-      m_values.AddMember("EchoCount", parse_json<int>::format(echoCount, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("EchoCount", parse_json<int>::format(echoCount, m_values.GetAllocator()));
     }
 
 
@@ -79,7 +79,7 @@ namespace Sdx
 
     void ExportHilGraphDataToCSV::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void ExportHilGraphDataToCSV::setOverwriting(bool overwriting)
     {
-      m_values.AddMember("Overwriting", parse_json<bool>::format(overwriting, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Overwriting", parse_json<bool>::format(overwriting, m_values.GetAllocator()));
     }
 
 
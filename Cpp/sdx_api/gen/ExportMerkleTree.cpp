@@ -85,7 +85,7 @@ namespace Sdx
 
     void ExportMerkleTree::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -97,7 +97,7 @@ namespace Sdx
 
     void ExportMerkleTree::setPublicKeyIndexes(const std::vector<int>& publicKeyIndexes)
     {
-      m_values.AddMember("PublicKeyIndexes", parse_json<std::vector<int>>::format(publicKeyIndexes, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PublicKeyIndexes", parse_json<std::vector<int>>::format(publicKeyIndexes, m_values.GetAllocator()));
     }
 
 
@@ -109,7 +109,7 @@ namespace Sdx
 
     void ExportMerkleTree::setFilePath(const std::string& filePath)
     {
-      m_values.AddMember("FilePath", parse_json<std::string>::format(filePath, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("FilePath", parse_json<std::string>::format(filePath, m_values.GetAllocator()));
     }
 
 
@@ -121,7 +121,7 @@ namespace Sdx
 
     void ExportMerkleTree::setOverwriteFile(bool overwriteFile)
     {
-      m_values.AddMember("OverwriteFile", parse_json<bool>::format(overwriteFile, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("OverwriteFile", parse_json<bool>::format(overwriteFile, m_values.GetAllocator()));
     }
 
 
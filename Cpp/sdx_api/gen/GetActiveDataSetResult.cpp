@@ -86,7 +86,7 @@ namespace Sdx
 
     void GetActiveDataSetResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +98,7 @@ namespace Sdx
 
     void GetActiveDataSetResult::setDataSetName(const std::string& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::string>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("DataSetName", parse_json<std::string>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
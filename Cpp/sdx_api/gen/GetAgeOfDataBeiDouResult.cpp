@@ -90,7 +90,7 @@ namespace Sdx
 
     void GetAgeOfDataBeiDouResult::setClock(int clock)
     {
-      m_values.AddMember("Clock", parse_json<int>::format(clock, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Clock", parse_json<int>::format(clock, m_values.GetAllocator()));
     }
 
 
@@ -102,7 +102,7 @@ namespace Sdx
 
     void GetAgeOfDataBeiDouResult::setEphemeris(int ephemeris)
     {
-      m_values.AddMember("Ephemeris", parse_json<int>::format(ephemeris, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Ephemeris", parse_json<int>::format(ephemeris, m_values.GetAllocator()));
     }
 
 
@@ -114,7 +114,7 @@ namespace Sdx
 
     void GetAgeOfDataBeiDouResult::setOverrideRinex(const std::optional<bool>& overrideRinex)
     {
-      m_values.AddMember("OverrideRinex", parse_json<std::optional<bool>>::format(overrideRinex, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("OverrideRinex", parse_json<std::optional<bool>>::format(overrideRinex, m_values.GetAllocator()));
     }
 
 
@@ -81,7 +81,7 @@ namespace Sdx
 
     void GetAllSatellitesPseudorangeNoiseSineWave::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -93,7 +93,7 @@ namespace Sdx
 
     void GetAllSatellitesPseudorangeNoiseSineWave::setSineWave(int sineWave)
     {
-      m_values.AddMember("SineWave", parse_json<int>::format(sineWave, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SineWave", parse_json<int>::format(sineWave, m_values.GetAllocator()));
     }
 
 
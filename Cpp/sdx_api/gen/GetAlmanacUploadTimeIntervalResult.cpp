@@ -86,7 +86,7 @@ namespace Sdx
 
     void GetAlmanacUploadTimeIntervalResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +98,7 @@ namespace Sdx
 
     void GetAlmanacUploadTimeIntervalResult::setInterval(int interval)
     {
-      m_values.AddMember("Interval", parse_json<int>::format(interval, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Interval", parse_json<int>::format(interval, m_values.GetAllocator()));
     }
 
 
@@ -90,7 +90,7 @@ namespace Sdx
 
     void GetAntennaChangeResult::setStartTime(double startTime)
     {
-      m_values.AddMember("StartTime", parse_json<double>::format(startTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("StartTime", parse_json<double>::format(startTime, m_values.GetAllocator()));
     }
 
 
@@ -102,7 +102,7 @@ namespace Sdx
 
     void GetAntennaChangeResult::setAntenna(const std::string& antenna)
     {
-      m_values.AddMember("Antenna", parse_json<std::string>::format(antenna, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Antenna", parse_json<std::string>::format(antenna, m_values.GetAllocator()));
     }
 
 
@@ -114,7 +114,7 @@ namespace Sdx
 
     void GetAntennaChangeResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
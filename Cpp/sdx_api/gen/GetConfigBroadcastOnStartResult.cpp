@@ -82,7 +82,7 @@ namespace Sdx
 
     void GetConfigBroadcastOnStartResult::setBroadcastOnStart(bool broadcastOnStart)
     {
-      m_values.AddMember("BroadcastOnStart", parse_json<bool>::format(broadcastOnStart, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("BroadcastOnStart", parse_json<bool>::format(broadcastOnStart, m_values.GetAllocator()));
     }
 
 
@@ -86,7 +86,7 @@ namespace Sdx
 
     void GetCrossAuthenticatedSatellitesForSVResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +98,7 @@ namespace Sdx
 
     void GetCrossAuthenticatedSatellitesForSVResult::setSvIdList(const std::vector<int>& svIdList)
     {
-      m_values.AddMember("SvIdList", parse_json<std::vector<int>>::format(svIdList, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvIdList", parse_json<std::vector<int>>::format(svIdList, m_values.GetAllocator()));
     }
 
 
@@ -82,7 +82,7 @@ namespace Sdx
 
     void GetCurrentPropagationModelResult::setModel(const Sdx::PropagationModelType& model)
     {
-      m_values.AddMember("Model", parse_json<Sdx::PropagationModelType>::format(model, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Model", parse_json<Sdx::PropagationModelType>::format(model, m_values.GetAllocator()));
     }
 
 
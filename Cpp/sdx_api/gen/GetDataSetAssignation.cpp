@@ -79,7 +79,7 @@ namespace Sdx
 
     void GetDataSetAssignation::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void GetDataSetAssignation::setDataSetType(const std::string& dataSetType)
     {
-      m_values.AddMember("DataSetType", parse_json<std::string>::format(dataSetType, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("DataSetType", parse_json<std::string>::format(dataSetType, m_values.GetAllocator()));
     }
 
 
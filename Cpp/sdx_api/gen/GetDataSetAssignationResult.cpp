@@ -90,7 +90,7 @@ namespace Sdx
 
     void GetDataSetAssignationResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -102,7 +102,7 @@ namespace Sdx
 
     void GetDataSetAssignationResult::setDataSetType(const std::string& dataSetType)
     {
-      m_values.AddMember("DataSetType", parse_json<std::string>::format(dataSetType, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("DataSetType", parse_json<std::string>::format(dataSetType, m_values.GetAllocator()));
     }
 
 
@@ -114,7 +114,7 @@ namespace Sdx
 
     void GetDataSetAssignationResult::setDataSetName(const std::string& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::string>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("DataSetName", parse_json<std::string>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
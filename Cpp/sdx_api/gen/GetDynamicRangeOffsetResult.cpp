@@ -82,7 +82,7 @@ namespace Sdx
 
     void GetDynamicRangeOffsetResult::setOffset(double offset)
     {
-      m_values.AddMember("Offset", parse_json<double>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Offset", parse_json<double>::format(offset, m_values.GetAllocator()));
     }
 
 
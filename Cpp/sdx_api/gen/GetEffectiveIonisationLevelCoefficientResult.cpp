@@ -86,7 +86,7 @@ namespace Sdx
 
     void GetEffectiveIonisationLevelCoefficientResult::setIndex(int index)
     {
-      m_values.AddMember("Index", parse_json<int>::format(index, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Index", parse_json<int>::format(index, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +98,7 @@ namespace Sdx
 
     void GetEffectiveIonisationLevelCoefficientResult::setVal(double val)
     {
-      m_values.AddMember("Val", parse_json<double>::format(val, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Val", parse_json<double>::format(val, m_values.GetAllocator()));
     }
 
 
@@ -90,7 +90,7 @@ namespace Sdx
 
     void GetElevationAzimuthForSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -102,7 +102,7 @@ namespace Sdx
 
     void GetElevationAzimuthForSVResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -114,7 +114,7 @@ namespace Sdx
 
     void GetElevationAzimuthForSVResult::setElevationAzimuth(const std::optional<Sdx::ElevationAzimuth>& elevationAzimuth)
     {
-      m_values.AddMember("ElevationAzimuth", parse_json<std::optional<Sdx::ElevationAzimuth>>::format(elevationAzimuth, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("ElevationAzimuth", parse_json<std::optional<Sdx::ElevationAzimuth>>::format(elevationAzimuth, m_values.GetAllocator()));
     }
 
 
@@ -82,7 +82,7 @@ namespace Sdx
 
     void GetElevationMaskAboveResult::setAngle(double angle)
     {
-      m_values.AddMember("Angle", parse_json<double>::format(angle, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Angle", parse_json<double>::format(angle, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +98,7 @@ namespace Sdx
 
     void GetEphemerisErrorForSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -110,7 +110,7 @@ namespace Sdx
 
     void GetEphemerisErrorForSVResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -122,7 +122,7 @@ namespace Sdx
 
     void GetEphemerisErrorForSVResult::setOrbit(const Sdx::RIC& orbit)
     {
-      m_values.AddMember("Orbit", parse_json<Sdx::RIC>::format(orbit, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Orbit", parse_json<Sdx::RIC>::format(orbit, m_values.GetAllocator()));
     }
 
 
@@ -134,7 +134,7 @@ namespace Sdx
 
     void GetEphemerisErrorForSVResult::setDeltaAf0(double deltaAf0)
     {
-      m_values.AddMember("DeltaAf0", parse_json<double>::format(deltaAf0, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("DeltaAf0", parse_json<double>::format(deltaAf0, m_values.GetAllocator()));
     }
 
 
@@ -146,7 +146,7 @@ namespace Sdx
 
     void GetEphemerisErrorForSVResult::setDeltaAf1(double deltaAf1)
     {
-      m_values.AddMember("DeltaAf1", parse_json<double>::format(deltaAf1, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("DeltaAf1", parse_json<double>::format(deltaAf1, m_values.GetAllocator()));
     }
 
 
@@ -86,7 +86,7 @@ namespace Sdx
 
     void GetGalileoFnavSatelliteKResult::setPrn(int prn)
     {
-      m_values.AddMember("Prn", parse_json<int>::format(prn, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Prn", parse_json<int>::format(prn, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +98,7 @@ namespace Sdx
 
     void GetGalileoFnavSatelliteKResult::setK(int k)
     {
-      m_values.AddMember("K", parse_json<int>::format(k, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("K", parse_json<int>::format(k, m_values.GetAllocator()));
     }
 
 
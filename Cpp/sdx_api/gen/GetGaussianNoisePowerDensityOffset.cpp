@@ -79,7 +79,7 @@ namespace Sdx
 
     void GetGaussianNoisePowerDensityOffset::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void GetGaussianNoisePowerDensityOffset::setOutputIdx(int outputIdx)
     {
-      m_values.AddMember("OutputIdx", parse_json<int>::format(outputIdx, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("OutputIdx", parse_json<int>::format(outputIdx, m_values.GetAllocator()));
     }
 
 
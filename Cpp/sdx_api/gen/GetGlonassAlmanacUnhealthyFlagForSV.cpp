@@ -76,7 +76,7 @@ namespace Sdx
 
     void GetGlonassAlmanacUnhealthyFlagForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
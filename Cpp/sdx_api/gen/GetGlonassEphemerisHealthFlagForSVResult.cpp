@@ -86,7 +86,7 @@ namespace Sdx
 
     void GetGlonassEphemerisHealthFlagForSVResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +98,7 @@ namespace Sdx
 
     void GetGlonassEphemerisHealthFlagForSVResult::setHealth(bool health)
     {
-      m_values.AddMember("Health", parse_json<bool>::format(health, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Health", parse_json<bool>::format(health, m_values.GetAllocator()));
     }
 
 
@@ -86,7 +86,7 @@ namespace Sdx
 
     void GetGpsStartTimeResult::setStartTime(const Sdx::DateTime& startTime)
     {
-      m_values.AddMember("StartTime", parse_json<Sdx::DateTime>::format(startTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("StartTime", parse_json<Sdx::DateTime>::format(startTime, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +98,7 @@ namespace Sdx
 
     void GetGpsStartTimeResult::setLeapSecond(int leapSecond)
     {
-      m_values.AddMember("LeapSecond", parse_json<int>::format(leapSecond, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("LeapSecond", parse_json<int>::format(leapSecond, m_values.GetAllocator()));
     }
 
 
@@ -102,7 +102,7 @@ namespace Sdx
 
     void GetGpsTimingReceiverResult::setPort(const std::string& port)
     {
-      m_values.AddMember("Port", parse_json<std::string>::format(port, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Port", parse_json<std::string>::format(port, m_values.GetAllocator()));
     }
 
 
@@ -114,7 +114,7 @@ namespace Sdx
 
     void GetGpsTimingReceiverResult::setBaudRate(const std::optional<int>& baudRate)
     {
-      m_values.AddMember("BaudRate", parse_json<std::optional<int>>::format(baudRate, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("BaudRate", parse_json<std::optional<int>>::format(baudRate, m_values.GetAllocator()));
     }
 
 
@@ -126,7 +126,7 @@ namespace Sdx
 
     void GetGpsTimingReceiverResult::setDataBits(const std::optional<int>& dataBits)
     {
-      m_values.AddMember("DataBits", parse_json<std::optional<int>>::format(dataBits, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("DataBits", parse_json<std::optional<int>>::format(dataBits, m_values.GetAllocator()));
     }
 
 
@@ -138,7 +138,7 @@ namespace Sdx
 
     void GetGpsTimingReceiverResult::setParity(const std::optional<Sdx::SerialPortParity>& parity)
     {
-      m_values.AddMember("Parity", parse_json<std::optional<Sdx::SerialPortParity>>::format(parity, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Parity", parse_json<std::optional<Sdx::SerialPortParity>>::format(parity, m_values.GetAllocator()));
     }
 
 
@@ -150,7 +150,7 @@ namespace Sdx
 
     void GetGpsTimingReceiverResult::setStopBits(const std::optional<int>& stopBits)
     {
-      m_values.AddMember("StopBits", parse_json<std::optional<int>>::format(stopBits, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("StopBits", parse_json<std::optional<int>>::format(stopBits, m_values.GetAllocator()));
     }
 
 
@@ -162,7 +162,7 @@ namespace Sdx
 
     void GetGpsTimingReceiverResult::setFlowControl(const std::optional<Sdx::SerialPortFlowControl>& flowControl)
     {
-      m_values.AddMember("FlowControl", parse_json<std::optional<Sdx::SerialPortFlowControl>>::format(flowControl, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("FlowControl", parse_json<std::optional<Sdx::SerialPortFlowControl>>::format(flowControl, m_values.GetAllocator()));
     }
 
 
@@ -114,7 +114,7 @@ namespace Sdx
 
     void GetIntTxBPSKResult::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -126,7 +126,7 @@ namespace Sdx
 
     void GetIntTxBPSKResult::setCentralFreq(double centralFreq)
     {
-      m_values.AddMember("CentralFreq", parse_json<double>::format(centralFreq, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("CentralFreq", parse_json<double>::format(centralFreq, m_values.GetAllocator()));
     }
 
 
@@ -138,7 +138,7 @@ namespace Sdx
 
     void GetIntTxBPSKResult::setPower(double power)
     {
-      m_values.AddMember("Power", parse_json<double>::format(power, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Power", parse_json<double>::format(power, m_values.GetAllocator()));
     }
 
 
@@ -150,7 +150,7 @@ namespace Sdx
 
     void GetIntTxBPSKResult::setCodeRate(int codeRate)
     {
-      m_values.AddMember("CodeRate", parse_json<int>::format(codeRate, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("CodeRate", parse_json<int>::format(codeRate, m_values.GetAllocator()));
     }
 
 
@@ -162,7 +162,7 @@ namespace Sdx
 
     void GetIntTxBPSKResult::setCodeLengthMs(int codeLengthMs)
     {
-      m_values.AddMember("CodeLengthMs", parse_json<int>::format(codeLengthMs, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("CodeLengthMs", parse_json<int>::format(codeLengthMs, m_values.GetAllocator()));
     }
 
 
@@ -174,7 +174,7 @@ namespace Sdx
 
     void GetIntTxBPSKResult::setTransmitterId(const std::string& transmitterId)
     {
-      m_values.AddMember("TransmitterId", parse_json<std::string>::format(transmitterId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("TransmitterId", parse_json<std::string>::format(transmitterId, m_values.GetAllocator()));
     }
 
 
@@ -186,7 +186,7 @@ namespace Sdx
 
     void GetIntTxBPSKResult::setSignalId(const std::string& signalId)
     {
-      m_values.AddMember("SignalId", parse_json<std::string>::format(signalId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SignalId", parse_json<std::string>::format(signalId, m_values.GetAllocator()));
     }
 
 
@@ -198,7 +198,7 @@ namespace Sdx
 
     void GetIntTxBPSKResult::setGroup(const std::optional<int>& group)
     {
-      m_values.AddMember("Group", parse_json<std::optional<int>>::format(group, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Group", parse_json<std::optional<int>>::format(group, m_values.GetAllocator()));
     }
 
 
@@ -210,7 +210,7 @@ namespace Sdx
 
     void GetIntTxBPSKResult::setPrn(const std::optional<int>& prn)
     {
-      m_values.AddMember("Prn", parse_json<std::optional<int>>::format(prn, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Prn", parse_json<std::optional<int>>::format(prn, m_values.GetAllocator()));
     }
 
 
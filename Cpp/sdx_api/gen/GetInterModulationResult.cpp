@@ -86,7 +86,7 @@ namespace Sdx
 
     void GetInterModulationResult::setSignalArray(const std::vector<Sdx::SignalWithComponent>& signalArray)
     {
-      m_values.AddMember("SignalArray", parse_json<std::vector<Sdx::SignalWithComponent>>::format(signalArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SignalArray", parse_json<std::vector<Sdx::SignalWithComponent>>::format(signalArray, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +98,7 @@ namespace Sdx
 
     void GetInterModulationResult::setCoefficient(double coefficient)
     {
-      m_values.AddMember("Coefficient", parse_json<double>::format(coefficient, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Coefficient", parse_json<double>::format(coefficient, m_values.GetAllocator()));
     }
 
 
@@ -79,7 +79,7 @@ namespace Sdx
 
     void GetIonoGridError::setBand(int band)
     {
-      m_values.AddMember("Band", parse_json<int>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Band", parse_json<int>::format(band, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void GetIonoGridError::setPoint(int point)
     {
-      m_values.AddMember("Point", parse_json<int>::format(point, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Point", parse_json<int>::format(point, m_values.GetAllocator()));
     }
 
 
@@ -82,7 +82,17 @@ namespace Sdx
 
     void GetIonoGridErrorAllResult::setGrid(const std::vector<std::vector<double>>& grid)
     {
-      m_values.AddMember("Grid", parse_json<std::vector<std::vector<double>>>::format(grid, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Grid", parse_json<std::vector<std::vector<double>>>::format(grid, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> GetIonoGridErrorAllResult::gridMatrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["Grid"]);
+    }
+
+    void GetIonoGridErrorAllResult::setGridMatrix(const Sdx::Matrix<double>& grid)
+    {
+      setMember("Grid", parse_json<Sdx::Matrix<double>>::format(grid, m_values.GetAllocator()));
     }
 
 
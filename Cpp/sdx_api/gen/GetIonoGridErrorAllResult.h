@@ -3,6 +3,7 @@
 #include <memory>
 #include "command_result.h"
 #include "command_factory.h"
+#include "matrix.h"
 #include <vector>
 
 namespace Sdx
@@ -47,6 +48,8 @@ namespace Sdx
       // **** grid ****
       std::vector<std::vector<double>> grid() const;
       void setGrid(const std::vector<std::vector<double>>& grid);
+      Sdx::Matrix<double> gridMatrix() const;
+      void setGridMatrix(const Sdx::Matrix<double>& grid);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetIonoGridErrorAllResult);
   }
@@ -90,7 +90,7 @@ namespace Sdx
 
     void GetIonoGridErrorResult::setBand(int band)
     {
-      m_values.AddMember("Band", parse_json<int>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Band", parse_json<int>::format(band, m_values.GetAllocator()));
     }
 
 
@@ -102,7 +102,7 @@ namespace Sdx
 
     void GetIonoGridErrorResult::setPoint(int point)
     {
-      m_values.AddMember("Point", parse_json<int>::format(point, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Point", parse_json<int>::format(point, m_values.GetAllocator()));
     }
 
 
@@ -114,7 +114,7 @@ namespace Sdx
 
     void GetIonoGridErrorResult::setError(double error)
     {
-      m_values.AddMember("Error", parse_json<double>::format(error, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Error", parse_json<double>::format(error, m_values.GetAllocator()));
     }
 
 
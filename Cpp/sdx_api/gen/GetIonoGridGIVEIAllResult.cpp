@@ -86,7 +86,17 @@ namespace Sdx
 
     void GetIonoGridGIVEIAllResult::setGrid(const std::vector<std::vector<int>>& grid)
     {
-      m_values.AddMember("Grid", parse_json<std::vector<std::vector<int>>>::format(grid, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Grid", parse_json<std::vector<std::vector<int>>>::format(grid, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<int> GetIonoGridGIVEIAllResult::gridMatrix() const
+    {
+      return parse_json<Sdx::Matrix<int>>::parse(m_values["Grid"]);
+    }
+
+    void GetIonoGridGIVEIAllResult::setGridMatrix(const Sdx::Matrix<int>& grid)
+    {
+      setMember("Grid", parse_json<Sdx::Matrix<int>>::format(grid, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +108,7 @@ namespace Sdx
 
     void GetIonoGridGIVEIAllResult::setServiceProvider(const std::optional<std::string>& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::optional<std::string>>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("ServiceProvider", parse_json<std::optional<std::string>>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
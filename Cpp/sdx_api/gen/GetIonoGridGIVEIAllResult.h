@@ -3,6 +3,7 @@
 #include <memory>
 #include "command_result.h"
 #include "command_factory.h"
+#include "matrix.h"
 #include <optional>
 #include <string>
 #include <vector>
@@ -50,6 +51,8 @@ namespace Sdx
       // **** grid ****
       std::vector<std::vector<int>> grid() const;
       void setGrid(const std::vector<std::vector<int>>& grid);
+      Sdx::Matrix<int> gridMatrix() const;
+      void setGridMatrix(const Sdx::Matrix<int>& grid);
 
 
       // **** serviceProvider ****
@@ -86,7 +86,7 @@ namespace Sdx
 
     void GetIonoGridMaskAllResult::setServiceProvider(const std::string& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +98,17 @@ namespace Sdx
 
     void GetIonoGridMaskAllResult::setGrid(const std::vector<std::vector<bool>>& grid)
     {
-      m_values.AddMember("Grid", parse_json<std::vector<std::vector<bool>>>::format(grid, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Grid", parse_json<std::vector<std::vector<bool>>>::format(grid, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<bool> GetIonoGridMaskAllResult::gridMatrix() const
+    {
+      return parse_json<Sdx::Matrix<bool>>::parse(m_values["Grid"]);
+    }
+
+    void GetIonoGridMaskAllResult::setGridMatrix(const Sdx::Matrix<bool>& grid)
+    {
+      setMember("Grid", parse_json<Sdx::Matrix<bool>>::format(grid, m_values.GetAllocator()));
     }
 
 
@@ -3,6 +3,7 @@
 #include <memory>
 #include "command_result.h"
 #include "command_factory.h"
+#include "matrix.h"
 #include <string>
 #include <vector>
 
@@ -54,6 +55,8 @@ namespace Sdx
       // **** grid ****
       std::vector<std::vector<bool>> grid() const;
       void setGrid(const std::vector<std::vector<bool>>& grid);
+      Sdx::Matrix<bool> gridMatrix() const;
+      void setGridMatrix(const Sdx::Matrix<bool>& grid);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetIonoGridMaskAllResult);
   }
@@ -82,7 +82,7 @@ namespace Sdx
 
     void GetIonoModelResult::setModel(const std::string& model)
     {
-      m_values.AddMember("Model", parse_json<std::string>::format(model, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Model", parse_json<std::string>::format(model, m_values.GetAllocator()));
     }
 
 
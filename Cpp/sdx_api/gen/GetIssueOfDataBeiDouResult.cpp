@@ -86,7 +86,7 @@ namespace Sdx
 
     void GetIssueOfDataBeiDouResult::setClock(int clock)
     {
-      m_values.AddMember("Clock", parse_json<int>::format(clock, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Clock", parse_json<int>::format(clock, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +98,7 @@ namespace Sdx
 
     void GetIssueOfDataBeiDouResult::setEphemeris(int ephemeris)
     {
-      m_values.AddMember("Ephemeris", parse_json<int>::format(ephemeris, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Ephemeris", parse_json<int>::format(ephemeris, m_values.GetAllocator()));
     }
 
 
@@ -90,7 +90,7 @@ namespace Sdx
 
     void GetMerkleTreeXMLResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -102,7 +102,7 @@ namespace Sdx
 
     void GetMerkleTreeXMLResult::setPublicKeyIndexes(const std::vector<int>& publicKeyIndexes)
     {
-      m_values.AddMember("PublicKeyIndexes", parse_json<std::vector<int>>::format(publicKeyIndexes, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PublicKeyIndexes", parse_json<std::vector<int>>::format(publicKeyIndexes, m_values.GetAllocator()));
     }
 
 
@@ -114,7 +114,7 @@ namespace Sdx
 
     void GetMerkleTreeXMLResult::setMerkleTreeXML(const std::string& merkleTreeXML)
     {
-      m_values.AddMember("MerkleTreeXML", parse_json<std::string>::format(merkleTreeXML, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("MerkleTreeXML", parse_json<std::string>::format(merkleTreeXML, m_values.GetAllocator()));
     }
 
 
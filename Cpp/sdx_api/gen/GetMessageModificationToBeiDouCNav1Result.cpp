@@ -114,7 +114,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouCNav1Result::setSignalArray(const std::vector<std::string>& signalArray)
     {
-      m_values.AddMember("SignalArray", parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SignalArray", parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()));
     }
 
 
@@ -126,7 +126,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouCNav1Result::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -138,7 +138,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouCNav1Result::setStartTime(int startTime)
     {
-      m_values.AddMember("StartTime", parse_json<int>::format(startTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("StartTime", parse_json<int>::format(startTime, m_values.GetAllocator()));
     }
 
 
@@ -150,7 +150,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouCNav1Result::setStopTime(int stopTime)
     {
-      m_values.AddMember("StopTime", parse_json<int>::format(stopTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("StopTime", parse_json<int>::format(stopTime, m_values.GetAllocator()));
     }
 
 
@@ -162,7 +162,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouCNav1Result::setPage(int page)
     {
-      m_values.AddMember("Page", parse_json<int>::format(page, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Page", parse_json<int>::format(page, m_values.GetAllocator()));
     }
 
 
@@ -174,7 +174,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouCNav1Result::setCondition(const std::string& condition)
     {
-      m_values.AddMember("Condition", parse_json<std::string>::format(condition, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Condition", parse_json<std::string>::format(condition, m_values.GetAllocator()));
     }
 
 
@@ -186,7 +186,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouCNav1Result::setUpdateCRC(bool updateCRC)
     {
-      m_values.AddMember("UpdateCRC", parse_json<bool>::format(updateCRC, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("UpdateCRC", parse_json<bool>::format(updateCRC, m_values.GetAllocator()));
     }
 
 
@@ -198,7 +198,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouCNav1Result::setBitModifications(const std::string& bitModifications)
     {
-      m_values.AddMember("BitModifications", parse_json<std::string>::format(bitModifications, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("BitModifications", parse_json<std::string>::format(bitModifications, m_values.GetAllocator()));
     }
 
 
@@ -210,7 +210,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouCNav1Result::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
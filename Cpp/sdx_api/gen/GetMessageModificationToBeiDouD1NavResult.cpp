@@ -118,7 +118,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouD1NavResult::setSignalArray(const std::vector<std::string>& signalArray)
     {
-      m_values.AddMember("SignalArray", parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SignalArray", parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()));
     }
 
 
@@ -130,7 +130,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouD1NavResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -142,7 +142,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouD1NavResult::setStartTime(int startTime)
     {
-      m_values.AddMember("StartTime", parse_json<int>::format(startTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("StartTime", parse_json<int>::format(startTime, m_values.GetAllocator()));
     }
 
 
@@ -154,7 +154,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouD1NavResult::setStopTime(int stopTime)
     {
-      m_values.AddMember("StopTime", parse_json<int>::format(stopTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("StopTime", parse_json<int>::format(stopTime, m_values.GetAllocator()));
     }
 
 
@@ -166,7 +166,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouD1NavResult::setSubframe(int subframe)
     {
-      m_values.AddMember("Subframe", parse_json<int>::format(subframe, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Subframe", parse_json<int>::format(subframe, m_values.GetAllocator()));
     }
 
 
@@ -178,7 +178,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouD1NavResult::setPage(int page)
     {
-      m_values.AddMember("Page", parse_json<int>::format(page, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Page", parse_json<int>::format(page, m_values.GetAllocator()));
     }
 
 
@@ -190,7 +190,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouD1NavResult::setWord(int word)
     {
-      m_values.AddMember("Word", parse_json<int>::format(word, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Word", parse_json<int>::format(word, m_values.GetAllocator()));
     }
 
 
@@ -202,7 +202,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouD1NavResult::setUpdateParity(bool updateParity)
     {
-      m_values.AddMember("UpdateParity", parse_json<bool>::format(updateParity, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("UpdateParity", parse_json<bool>::format(updateParity, m_values.GetAllocator()));
     }
 
 
@@ -214,7 +214,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouD1NavResult::setWordModification(const std::string& wordModification)
     {
-      m_values.AddMember("WordModification", parse_json<std::string>::format(wordModification, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("WordModification", parse_json<std::string>::format(wordModification, m_values.GetAllocator()));
     }
 
 
@@ -226,7 +226,7 @@ namespace Sdx
 
     void GetMessageModificationToBeiDouD1NavResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -117,7 +117,7 @@ namespace Sdx
 
     void GetMultipathForIDResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -129,7 +129,7 @@ namespace Sdx
 
     void GetMultipathForIDResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -141,7 +141,7 @@ namespace Sdx
 
     void GetMultipathForIDResult::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
@@ -153,7 +153,7 @@ namespace Sdx
 
     void GetMultipathForIDResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -165,7 +165,7 @@ namespace Sdx
 
     void GetMultipathForIDResult::setPowerLoss(double powerLoss)
     {
-      m_values.AddMember("PowerLoss", parse_json<double>::format(powerLoss, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PowerLoss", parse_json<double>::format(powerLoss, m_values.GetAllocator()));
     }
 
 
@@ -177,7 +177,7 @@ namespace Sdx
 
     void GetMultipathForIDResult::setPseudorange(double pseudorange)
     {
-      m_values.AddMember("Pseudorange", parse_json<double>::format(pseudorange, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Pseudorange", parse_json<double>::format(pseudorange, m_values.GetAllocator()));
     }
 
 
@@ -189,7 +189,7 @@ namespace Sdx
 
     void GetMultipathForIDResult::setDoppler(double doppler)
     {
-      m_values.AddMember("Doppler", parse_json<double>::format(doppler, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Doppler", parse_json<double>::format(doppler, m_values.GetAllocator()));
     }
 
 
@@ -201,7 +201,7 @@ namespace Sdx
 
     void GetMultipathForIDResult::setCarrierPhase(double carrierPhase)
     {
-      m_values.AddMember("CarrierPhase", parse_json<double>::format(carrierPhase, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("CarrierPhase", parse_json<double>::format(carrierPhase, m_values.GetAllocator()));
     }
 
 
@@ -213,7 +213,7 @@ namespace Sdx
 
     void GetMultipathForIDResult::setEcho(int echo)
     {
-      m_values.AddMember("Echo", parse_json<int>::format(echo, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Echo", parse_json<int>::format(echo, m_values.GetAllocator()));
     }
 
 
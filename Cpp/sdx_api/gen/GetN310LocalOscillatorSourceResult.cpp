@@ -86,7 +86,7 @@ namespace Sdx
 
     void GetN310LocalOscillatorSourceResult::setIsExternal(bool isExternal)
     {
-      m_values.AddMember("IsExternal", parse_json<bool>::format(isExternal, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("IsExternal", parse_json<bool>::format(isExternal, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +98,7 @@ namespace Sdx
 
     void GetN310LocalOscillatorSourceResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -82,7 +82,7 @@ namespace Sdx
 
     void GetNmeaLoggerSerialPortDelayResult::setDelay(int delay)
     {
-      m_values.AddMember("Delay", parse_json<int>::format(delay, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Delay", parse_json<int>::format(delay, m_values.GetAllocator()));
     }
 
 
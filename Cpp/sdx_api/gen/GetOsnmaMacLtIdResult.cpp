@@ -83,7 +83,7 @@ namespace Sdx
 
     void GetOsnmaMacLtIdResult::setMacLtId(int macLtId)
     {
-      m_values.AddMember("MacLtId", parse_json<int>::format(macLtId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("MacLtId", parse_json<int>::format(macLtId, m_values.GetAllocator()));
     }
 
 
@@ -82,7 +82,7 @@ namespace Sdx
 
     void GetOsnmaTagSizeResult::setTagSize(int tagSize)
     {
-      m_values.AddMember("TagSize", parse_json<int>::format(tagSize, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("TagSize", parse_json<int>::format(tagSize, m_values.GetAllocator()));
     }
 
 
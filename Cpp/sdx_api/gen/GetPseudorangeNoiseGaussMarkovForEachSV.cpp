@@ -79,7 +79,7 @@ namespace Sdx
 
     void GetPseudorangeNoiseGaussMarkovForEachSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void GetPseudorangeNoiseGaussMarkovForEachSV::setProcess(int process)
     {
-      m_values.AddMember("Process", parse_json<int>::format(process, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Process", parse_json<int>::format(process, m_values.GetAllocator()));
     }
 
 
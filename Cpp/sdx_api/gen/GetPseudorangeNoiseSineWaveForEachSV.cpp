@@ -79,7 +79,7 @@ namespace Sdx
 
     void GetPseudorangeNoiseSineWaveForEachSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void GetPseudorangeNoiseSineWaveForEachSV::setSineWave(int sineWave)
     {
-      m_values.AddMember("SineWave", parse_json<int>::format(sineWave, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SineWave", parse_json<int>::format(sineWave, m_values.GetAllocator()));
     }
 
 
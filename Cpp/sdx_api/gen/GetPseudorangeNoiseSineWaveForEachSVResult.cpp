@@ -102,7 +102,7 @@ namespace Sdx
 
     void GetPseudorangeNoiseSineWaveForEachSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -114,7 +114,7 @@ namespace Sdx
 
     void GetPseudorangeNoiseSineWaveForEachSVResult::setSineWave(int sineWave)
     {
-      m_values.AddMember("SineWave", parse_json<int>::format(sineWave, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SineWave", parse_json<int>::format(sineWave, m_values.GetAllocator()));
     }
 
 
@@ -126,7 +126,7 @@ namespace Sdx
 
     void GetPseudorangeNoiseSineWaveForEachSVResult::setEnabled(const std::vector<bool>& enabled)
     {
-      m_values.AddMember("Enabled", parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Enabled", parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -138,7 +138,7 @@ namespace Sdx
 
     void GetPseudorangeNoiseSineWaveForEachSVResult::setAmplitude(const std::vector<double>& amplitude)
     {
-      m_values.AddMember("Amplitude", parse_json<std::vector<double>>::format(amplitude, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Amplitude", parse_json<std::vector<double>>::format(amplitude, m_values.GetAllocator()));
     }
 
 
@@ -150,7 +150,7 @@ namespace Sdx
 
     void GetPseudorangeNoiseSineWaveForEachSVResult::setPeriod(const std::vector<int>& period)
     {
-      m_values.AddMember("Period", parse_json<std::vector<int>>::format(period, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Period", parse_json<std::vector<int>>::format(period, m_values.GetAllocator()));
     }
 
 
@@ -162,7 +162,7 @@ namespace Sdx
 
     void GetPseudorangeNoiseSineWaveForEachSVResult::setOffset(const std::vector<double>& offset)
     {
-      m_values.AddMember("Offset", parse_json<std::vector<double>>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Offset", parse_json<std::vector<double>>::format(offset, m_values.GetAllocator()));
     }
 
 
@@ -3,6 +3,7 @@
 #include <memory>
 #include "command_result.h"
 #include "command_factory.h"
+#include "matrix.h"
 #include "gen/AntennaPatternType.h"
 #include "gen/GNSSBand.h"
 #include <optional>
@@ -55,6 +56,8 @@ namespace Sdx
       // **** phaseOffset ****
       std::vector<std::vector<double>> phaseOffset() const;
       void setPhaseOffset(const std::vector<std::vector<double>>& phaseOffset);
+      Sdx::Matrix<double> phaseOffsetMatrix() const;
+      void setPhaseOffsetMatrix(const Sdx::Matrix<double>& phaseOffset);
 
 
       // **** type ****
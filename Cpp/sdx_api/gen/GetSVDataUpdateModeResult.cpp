@@ -84,7 +84,7 @@ namespace Sdx
 
     void GetSVDataUpdateModeResult::setMode(const Sdx::SVDataUpdateMode& mode)
     {
-      m_values.AddMember("Mode", parse_json<Sdx::SVDataUpdateMode>::format(mode, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Mode", parse_json<Sdx::SVDataUpdateMode>::format(mode, m_values.GetAllocator()));
     }
 
 
@@ -83,7 +83,7 @@ namespace Sdx
 
     void GetSbasEphParamsForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -95,7 +95,7 @@ namespace Sdx
 
     void GetSbasEphParamsForSV::setParamArray(const std::vector<std::string>& paramArray)
     {
-      m_values.AddMember("ParamArray", parse_json<std::vector<std::string>>::format(paramArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("ParamArray", parse_json<std::vector<std::string>>::format(paramArray, m_values.GetAllocator()));
     }
 
 
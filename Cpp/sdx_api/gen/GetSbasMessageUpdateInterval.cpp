@@ -76,7 +76,7 @@ namespace Sdx
 
     void GetSbasMessageUpdateInterval::setMessage(int message)
     {
-      m_values.AddMember("Message", parse_json<int>::format(message, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Message", parse_json<int>::format(message, m_values.GetAllocator()));
     }
 
 
@@ -86,7 +86,7 @@ namespace Sdx
 
     void GetSbasMessageUpdateIntervalResult::setMessage(int message)
     {
-      m_values.AddMember("Message", parse_json<int>::format(message, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Message", parse_json<int>::format(message, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +98,7 @@ namespace Sdx
 
     void GetSbasMessageUpdateIntervalResult::setUpdateInterval(int updateInterval)
     {
-      m_values.AddMember("UpdateInterval", parse_json<int>::format(updateInterval, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("UpdateInterval", parse_json<int>::format(updateInterval, m_values.GetAllocator()));
     }
 
 
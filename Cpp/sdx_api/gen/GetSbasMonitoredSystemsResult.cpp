@@ -82,7 +82,7 @@ namespace Sdx
 
     void GetSbasMonitoredSystemsResult::setSystems(const std::vector<std::string>& systems)
     {
-      m_values.AddMember("Systems", parse_json<std::vector<std::string>>::format(systems, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Systems", parse_json<std::vector<std::string>>::format(systems, m_values.GetAllocator()));
     }
 
 
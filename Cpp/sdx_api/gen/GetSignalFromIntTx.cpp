@@ -79,7 +79,7 @@ namespace Sdx
 
     void GetSignalFromIntTx::setIdTransmitter(const std::string& idTransmitter)
     {
-      m_values.AddMember("IdTransmitter", parse_json<std::string>::format(idTransmitter, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("IdTransmitter", parse_json<std::string>::format(idTransmitter, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void GetSignalFromIntTx::setSignalType(const std::string& signalType)
     {
-      m_values.AddMember("SignalType", parse_json<std::string>::format(signalType, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SignalType", parse_json<std::string>::format(signalType, m_values.GetAllocator()));
     }
 
 
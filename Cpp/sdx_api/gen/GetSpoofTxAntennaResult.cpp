@@ -90,7 +90,17 @@ namespace Sdx
 
     void GetSpoofTxAntennaResult::setGain(const std::vector<std::vector<double>>& gain)
     {
-      m_values.AddMember("Gain", parse_json<std::vector<std::vector<double>>>::format(gain, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Gain", parse_json<std::vector<std::vector<double>>>::format(gain, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> GetSpoofTxAntennaResult::gainMatrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["Gain"]);
+    }
+
+    void GetSpoofTxAntennaResult::setGainMatrix(const Sdx::Matrix<double>& gain)
+    {
+      setMember("Gain", parse_json<Sdx::Matrix<double>>::format(gain, m_values.GetAllocator()));
     }
 
 
@@ -102,7 +112,7 @@ namespace Sdx
 
     void GetSpoofTxAntennaResult::setType(const Sdx::AntennaPatternType& type)
     {
-      m_values.AddMember("Type", parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Type", parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()));
     }
 
 
@@ -114,7 +124,7 @@ namespace Sdx
 
     void GetSpoofTxAntennaResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -82,7 +82,7 @@ namespace Sdx
 
     void GetStartTimeOffsetResult::setOffset(int offset)
     {
-      m_values.AddMember("Offset", parse_json<int>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Offset", parse_json<int>::format(offset, m_values.GetAllocator()));
     }
 
 
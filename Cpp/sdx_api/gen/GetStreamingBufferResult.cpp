@@ -82,7 +82,7 @@ namespace Sdx
 
     void GetStreamingBufferResult::setSize(int size)
     {
-      m_values.AddMember("Size", parse_json<int>::format(size, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Size", parse_json<int>::format(size, m_values.GetAllocator()));
     }
 
 
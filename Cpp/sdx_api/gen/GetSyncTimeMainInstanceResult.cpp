@@ -82,7 +82,7 @@ namespace Sdx
 
     void GetSyncTimeMainInstanceResult::setTime(double time)
     {
-      m_values.AddMember("Time", parse_json<double>::format(time, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Time", parse_json<double>::format(time, m_values.GetAllocator()));
     }
 
 
@@ -94,7 +94,17 @@ namespace Sdx
 
     void GetVehicleAntennaGainResult::setGain(const std::vector<std::vector<double>>& gain)
     {
-      m_values.AddMember("Gain", parse_json<std::vector<std::vector<double>>>::format(gain, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Gain", parse_json<std::vector<std::vector<double>>>::format(gain, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> GetVehicleAntennaGainResult::gainMatrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["Gain"]);
+    }
+
+    void GetVehicleAntennaGainResult::setGainMatrix(const Sdx::Matrix<double>& gain)
+    {
+      setMember("Gain", parse_json<Sdx::Matrix<double>>::format(gain, m_values.GetAllocator()));
     }
 
 
@@ -106,7 +116,7 @@ namespace Sdx
 
     void GetVehicleAntennaGainResult::setType(const Sdx::AntennaPatternType& type)
     {
-      m_values.AddMember("Type", parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Type", parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()));
     }
 
 
@@ -118,7 +128,7 @@ namespace Sdx
 
     void GetVehicleAntennaGainResult::setBand(const Sdx::GNSSBand& band)
     {
-      m_values.AddMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()));
     }
 
 
@@ -130,7 +140,7 @@ namespace Sdx
 
     void GetVehicleAntennaGainResult::setName(const std::optional<std::string>& name)
     {
-      m_values.AddMember("Name", parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Name", parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()));
     }
 
 
@@ -3,6 +3,7 @@
 #include <memory>
 #include "command_result.h"
 #include "command_factory.h"
+#include "matrix.h"
 #include "gen/AntennaPatternType.h"
 #include "gen/GNSSBand.h"
 #include <optional>
@@ -54,6 +55,8 @@ namespace Sdx
       // **** gain ****
       std::vector<std::vector<double>> gain() const;
       void setGain(const std::vector<std::vector<double>>& gain);
+      Sdx::Matrix<double> gainMatrix() const;
+      void setGainMatrix(const Sdx::Matrix<double>& gain);
 
 
       // **** type ****
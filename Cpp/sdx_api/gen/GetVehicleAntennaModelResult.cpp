@@ -250,7 +250,17 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainL1(const std::vector<std::vector<double>>& gainL1)
     {
-      m_values.AddMember("GainL1", parse_json<std::vector<std::vector<double>>>::format(gainL1, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainL1", parse_json<std::vector<std::vector<double>>>::format(gainL1, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> GetVehicleAntennaModelResult::gainL1Matrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["GainL1"]);
+    }
+
+    void GetVehicleAntennaModelResult::setGainL1Matrix(const Sdx::Matrix<double>& gainL1)
+    {
+      setMember("GainL1", parse_json<Sdx::Matrix<double>>::format(gainL1, m_values.GetAllocator()));
     }
 
 
@@ -262,7 +272,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainTypeL1(const Sdx::AntennaPatternType& gainTypeL1)
     {
-      m_values.AddMember("GainTypeL1", parse_json<Sdx::AntennaPatternType>::format(gainTypeL1, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainTypeL1", parse_json<Sdx::AntennaPatternType>::format(gainTypeL1, m_values.GetAllocator()));
     }
 
 
@@ -274,7 +284,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainOffsetL1(double gainOffsetL1)
     {
-      m_values.AddMember("GainOffsetL1", parse_json<double>::format(gainOffsetL1, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainOffsetL1", parse_json<double>::format(gainOffsetL1, m_values.GetAllocator()));
     }
 
 
@@ -286,7 +296,17 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainL2(const std::vector<std::vector<double>>& gainL2)
     {
-      m_values.AddMember("GainL2", parse_json<std::vector<std::vector<double>>>::format(gainL2, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainL2", parse_json<std::vector<std::vector<double>>>::format(gainL2, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> GetVehicleAntennaModelResult::gainL2Matrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["GainL2"]);
+    }
+
+    void GetVehicleAntennaModelResult::setGainL2Matrix(const Sdx::Matrix<double>& gainL2)
+    {
+      setMember("GainL2", parse_json<Sdx::Matrix<double>>::format(gainL2, m_values.GetAllocator()));
     }
 
 
@@ -298,7 +318,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainTypeL2(const Sdx::AntennaPatternType& gainTypeL2)
     {
-      m_values.AddMember("GainTypeL2", parse_json<Sdx::AntennaPatternType>::format(gainTypeL2, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainTypeL2", parse_json<Sdx::AntennaPatternType>::format(gainTypeL2, m_values.GetAllocator()));
     }
 
 
@@ -310,7 +330,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainOffsetL2(double gainOffsetL2)
     {
-      m_values.AddMember("GainOffsetL2", parse_json<double>::format(gainOffsetL2, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainOffsetL2", parse_json<double>::format(gainOffsetL2, m_values.GetAllocator()));
     }
 
 
@@ -322,7 +342,17 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainL5(const std::vector<std::vector<double>>& gainL5)
     {
-      m_values.AddMember("GainL5", parse_json<std::vector<std::vector<double>>>::format(gainL5, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainL5", parse_json<std::vector<std::vector<double>>>::format(gainL5, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> GetVehicleAntennaModelResult::gainL5Matrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["GainL5"]);
+    }
+
+    void GetVehicleAntennaModelResult::setGainL5Matrix(const Sdx::Matrix<double>& gainL5)
+    {
+      setMember("GainL5", parse_json<Sdx::Matrix<double>>::format(gainL5, m_values.GetAllocator()));
     }
 
 
@@ -334,7 +364,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainTypeL5(const Sdx::AntennaPatternType& gainTypeL5)
     {
-      m_values.AddMember("GainTypeL5", parse_json<Sdx::AntennaPatternType>::format(gainTypeL5, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainTypeL5", parse_json<Sdx::AntennaPatternType>::format(gainTypeL5, m_values.GetAllocator()));
     }
 
 
@@ -346,7 +376,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainOffsetL5(double gainOffsetL5)
     {
-      m_values.AddMember("GainOffsetL5", parse_json<double>::format(gainOffsetL5, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainOffsetL5", parse_json<double>::format(gainOffsetL5, m_values.GetAllocator()));
     }
 
 
@@ -358,7 +388,17 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainE6(const std::vector<std::vector<double>>& gainE6)
     {
-      m_values.AddMember("GainE6", parse_json<std::vector<std::vector<double>>>::format(gainE6, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainE6", parse_json<std::vector<std::vector<double>>>::format(gainE6, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> GetVehicleAntennaModelResult::gainE6Matrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["GainE6"]);
+    }
+
+    void GetVehicleAntennaModelResult::setGainE6Matrix(const Sdx::Matrix<double>& gainE6)
+    {
+      setMember("GainE6", parse_json<Sdx::Matrix<double>>::format(gainE6, m_values.GetAllocator()));
     }
 
 
@@ -370,7 +410,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainTypeE6(const Sdx::AntennaPatternType& gainTypeE6)
     {
-      m_values.AddMember("GainTypeE6", parse_json<Sdx::AntennaPatternType>::format(gainTypeE6, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainTypeE6", parse_json<Sdx::AntennaPatternType>::format(gainTypeE6, m_values.GetAllocator()));
     }
 
 
@@ -382,7 +422,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainOffsetE6(double gainOffsetE6)
     {
-      m_values.AddMember("GainOffsetE6", parse_json<double>::format(gainOffsetE6, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainOffsetE6", parse_json<double>::format(gainOffsetE6, m_values.GetAllocator()));
     }
 
 
@@ -394,7 +434,17 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainS(const std::vector<std::vector<double>>& gainS)
     {
-      m_values.AddMember("GainS", parse_json<std::vector<std::vector<double>>>::format(gainS, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainS", parse_json<std::vector<std::vector<double>>>::format(gainS, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> GetVehicleAntennaModelResult::gainSMatrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["GainS"]);
+    }
+
+    void GetVehicleAntennaModelResult::setGainSMatrix(const Sdx::Matrix<double>& gainS)
+    {
+      setMember("GainS", parse_json<Sdx::Matrix<double>>::format(gainS, m_values.GetAllocator()));
     }
 
 
@@ -406,7 +456,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainTypeS(const Sdx::AntennaPatternType& gainTypeS)
     {
-      m_values.AddMember("GainTypeS", parse_json<Sdx::AntennaPatternType>::format(gainTypeS, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainTypeS", parse_json<Sdx::AntennaPatternType>::format(gainTypeS, m_values.GetAllocator()));
     }
 
 
@@ -418,7 +468,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainOffsetS(double gainOffsetS)
     {
-      m_values.AddMember("GainOffsetS", parse_json<double>::format(gainOffsetS, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainOffsetS", parse_json<double>::format(gainOffsetS, m_values.GetAllocator()));
     }
 
 
@@ -430,7 +480,17 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainC(const std::vector<std::vector<double>>& gainC)
     {
-      m_values.AddMember("GainC", parse_json<std::vector<std::vector<double>>>::format(gainC, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainC", parse_json<std::vector<std::vector<double>>>::format(gainC, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> GetVehicleAntennaModelResult::gainCMatrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["GainC"]);
+    }
+
+    void GetVehicleAntennaModelResult::setGainCMatrix(const Sdx::Matrix<double>& gainC)
+    {
+      setMember("GainC", parse_json<Sdx::Matrix<double>>::format(gainC, m_values.GetAllocator()));
     }
 
 
@@ -442,7 +502,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainTypeC(const Sdx::AntennaPatternType& gainTypeC)
     {
-      m_values.AddMember("GainTypeC", parse_json<Sdx::AntennaPatternType>::format(gainTypeC, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainTypeC", parse_json<Sdx::AntennaPatternType>::format(gainTypeC, m_values.GetAllocator()));
     }
 
 
@@ -454,7 +514,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setGainOffsetC(double gainOffsetC)
     {
-      m_values.AddMember("GainOffsetC", parse_json<double>::format(gainOffsetC, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GainOffsetC", parse_json<double>::format(gainOffsetC, m_values.GetAllocator()));
     }
 
 
@@ -466,7 +526,17 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhaseOffsetL1(const std::vector<std::vector<double>>& phaseOffsetL1)
     {
-      m_values.AddMember("PhaseOffsetL1", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetL1, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffsetL1", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetL1, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> GetVehicleAntennaModelResult::phaseOffsetL1Matrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["PhaseOffsetL1"]);
+    }
+
+    void GetVehicleAntennaModelResult::setPhaseOffsetL1Matrix(const Sdx::Matrix<double>& phaseOffsetL1)
+    {
+      setMember("PhaseOffsetL1", parse_json<Sdx::Matrix<double>>::format(phaseOffsetL1, m_values.GetAllocator()));
     }
 
 
@@ -478,7 +548,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhaseOffsetTypeL1(const Sdx::AntennaPatternType& phaseOffsetTypeL1)
     {
-      m_values.AddMember("PhaseOffsetTypeL1", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeL1, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffsetTypeL1", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeL1, m_values.GetAllocator()));
     }
 
 
@@ -490,7 +560,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhasePatternOffsetL1(double phasePatternOffsetL1)
     {
-      m_values.AddMember("PhasePatternOffsetL1", parse_json<double>::format(phasePatternOffsetL1, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhasePatternOffsetL1", parse_json<double>::format(phasePatternOffsetL1, m_values.GetAllocator()));
     }
 
 
@@ -502,7 +572,17 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhaseOffsetL2(const std::vector<std::vector<double>>& phaseOffsetL2)
     {
-      m_values.AddMember("PhaseOffsetL2", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetL2, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffsetL2", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetL2, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> GetVehicleAntennaModelResult::phaseOffsetL2Matrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["PhaseOffsetL2"]);
+    }
+
+    void GetVehicleAntennaModelResult::setPhaseOffsetL2Matrix(const Sdx::Matrix<double>& phaseOffsetL2)
+    {
+      setMember("PhaseOffsetL2", parse_json<Sdx::Matrix<double>>::format(phaseOffsetL2, m_values.GetAllocator()));
     }
 
 
@@ -514,7 +594,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhaseOffsetTypeL2(const Sdx::AntennaPatternType& phaseOffsetTypeL2)
     {
-      m_values.AddMember("PhaseOffsetTypeL2", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeL2, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffsetTypeL2", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeL2, m_values.GetAllocator()));
     }
 
 
@@ -526,7 +606,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhasePatternOffsetL2(double phasePatternOffsetL2)
     {
-      m_values.AddMember("PhasePatternOffsetL2", parse_json<double>::format(phasePatternOffsetL2, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhasePatternOffsetL2", parse_json<double>::format(phasePatternOffsetL2, m_values.GetAllocator()));
     }
 
 
@@ -538,7 +618,17 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhaseOffsetL5(const std::vector<std::vector<double>>& phaseOffsetL5)
     {
-      m_values.AddMember("PhaseOffsetL5", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetL5, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffsetL5", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetL5, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> GetVehicleAntennaModelResult::phaseOffsetL5Matrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["PhaseOffsetL5"]);
+    }
+
+    void GetVehicleAntennaModelResult::setPhaseOffsetL5Matrix(const Sdx::Matrix<double>& phaseOffsetL5)
+    {
+      setMember("PhaseOffsetL5", parse_json<Sdx::Matrix<double>>::format(phaseOffsetL5, m_values.GetAllocator()));
     }
 
 
@@ -550,7 +640,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhaseOffsetTypeL5(const Sdx::AntennaPatternType& phaseOffsetTypeL5)
     {
-      m_values.AddMember("PhaseOffsetTypeL5", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeL5, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffsetTypeL5", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeL5, m_values.GetAllocator()));
     }
 
 
@@ -562,7 +652,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhasePatternOffsetL5(double phasePatternOffsetL5)
     {
-      m_values.AddMember("PhasePatternOffsetL5", parse_json<double>::format(phasePatternOffsetL5, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhasePatternOffsetL5", parse_json<double>::format(phasePatternOffsetL5, m_values.GetAllocator()));
     }
 
 
@@ -574,7 +664,17 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhaseOffsetE6(const std::vector<std::vector<double>>& phaseOffsetE6)
     {
-      m_values.AddMember("PhaseOffsetE6", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetE6, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffsetE6", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetE6, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> GetVehicleAntennaModelResult::phaseOffsetE6Matrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["PhaseOffsetE6"]);
+    }
+
+    void GetVehicleAntennaModelResult::setPhaseOffsetE6Matrix(const Sdx::Matrix<double>& phaseOffsetE6)
+    {
+      setMember("PhaseOffsetE6", parse_json<Sdx::Matrix<double>>::format(phaseOffsetE6, m_values.GetAllocator()));
     }
 
 
@@ -586,7 +686,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhaseOffsetTypeE6(const Sdx::AntennaPatternType& phaseOffsetTypeE6)
     {
-      m_values.AddMember("PhaseOffsetTypeE6", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeE6, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffsetTypeE6", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeE6, m_values.GetAllocator()));
     }
 
 
@@ -598,7 +698,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhasePatternOffsetE6(double phasePatternOffsetE6)
     {
-      m_values.AddMember("PhasePatternOffsetE6", parse_json<double>::format(phasePatternOffsetE6, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhasePatternOffsetE6", parse_json<double>::format(phasePatternOffsetE6, m_values.GetAllocator()));
     }
 
 
@@ -610,7 +710,17 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhaseOffsetS(const std::vector<std::vector<double>>& phaseOffsetS)
     {
-      m_values.AddMember("PhaseOffsetS", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetS, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffsetS", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetS, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> GetVehicleAntennaModelResult::phaseOffsetSMatrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["PhaseOffsetS"]);
+    }
+
+    void GetVehicleAntennaModelResult::setPhaseOffsetSMatrix(const Sdx::Matrix<double>& phaseOffsetS)
+    {
+      setMember("PhaseOffsetS", parse_json<Sdx::Matrix<double>>::format(phaseOffsetS, m_values.GetAllocator()));
     }
 
 
@@ -622,7 +732,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhaseOffsetTypeS(const Sdx::AntennaPatternType& phaseOffsetTypeS)
     {
-      m_values.AddMember("PhaseOffsetTypeS", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeS, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffsetTypeS", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeS, m_values.GetAllocator()));
     }
 
 
@@ -634,7 +744,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhasePatternOffsetS(double phasePatternOffsetS)
     {
-      m_values.AddMember("PhasePatternOffsetS", parse_json<double>::format(phasePatternOffsetS, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhasePatternOffsetS", parse_json<double>::format(phasePatternOffsetS, m_values.GetAllocator()));
     }
 
 
@@ -646,7 +756,17 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhaseOffsetC(const std::vector<std::vector<double>>& phaseOffsetC)
     {
-      m_values.AddMember("PhaseOffsetC", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetC, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffsetC", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetC, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> GetVehicleAntennaModelResult::phaseOffsetCMatrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["PhaseOffsetC"]);
+    }
+
+    void GetVehicleAntennaModelResult::setPhaseOffsetCMatrix(const Sdx::Matrix<double>& phaseOffsetC)
+    {
+      setMember("PhaseOffsetC", parse_json<Sdx::Matrix<double>>::format(phaseOffsetC, m_values.GetAllocator()));
     }
 
 
@@ -658,7 +778,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhaseOffsetTypeC(const Sdx::AntennaPatternType& phaseOffsetTypeC)
     {
-      m_values.AddMember("PhaseOffsetTypeC", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeC, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffsetTypeC", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeC, m_values.GetAllocator()));
     }
 
 
@@ -670,7 +790,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPhasePatternOffsetC(double phasePatternOffsetC)
     {
-      m_values.AddMember("PhasePatternOffsetC", parse_json<double>::format(phasePatternOffsetC, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhasePatternOffsetC", parse_json<double>::format(phasePatternOffsetC, m_values.GetAllocator()));
     }
 
 
@@ -682,7 +802,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setX(double x)
     {
-      m_values.AddMember("X", parse_json<double>::format(x, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("X", parse_json<double>::format(x, m_values.GetAllocator()));
     }
 
 
@@ -694,7 +814,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setY(double y)
     {
-      m_values.AddMember("Y", parse_json<double>::format(y, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Y", parse_json<double>::format(y, m_values.GetAllocator()));
     }
 
 
@@ -706,7 +826,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setZ(double z)
     {
-      m_values.AddMember("Z", parse_json<double>::format(z, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Z", parse_json<double>::format(z, m_values.GetAllocator()));
     }
 
 
@@ -718,7 +838,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setYaw(double yaw)
     {
-      m_values.AddMember("Yaw", parse_json<double>::format(yaw, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Yaw", parse_json<double>::format(yaw, m_values.GetAllocator()));
     }
 
 
@@ -730,7 +850,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setPitch(double pitch)
     {
-      m_values.AddMember("Pitch", parse_json<double>::format(pitch, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Pitch", parse_json<double>::format(pitch, m_values.GetAllocator()));
     }
 
 
@@ -742,7 +862,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setRoll(double roll)
     {
-      m_values.AddMember("Roll", parse_json<double>::format(roll, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Roll", parse_json<double>::format(roll, m_values.GetAllocator()));
     }
 
 
@@ -754,7 +874,7 @@ namespace Sdx
 
     void GetVehicleAntennaModelResult::setName(const std::string& name)
     {
-      m_values.AddMember("Name", parse_json<std::string>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Name", parse_json<std::string>::format(name, m_values.GetAllocator()));
     }
 
 
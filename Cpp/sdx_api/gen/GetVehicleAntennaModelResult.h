@@ -3,6 +3,7 @@
 #include <memory>
 #include "command_result.h"
 #include "command_factory.h"
+#include "matrix.h"
 #include "gen/AntennaPatternType.h"
 #include <string>
 #include <vector>
@@ -91,6 +92,8 @@ namespace Sdx
       // **** gainL1 ****
       std::vector<std::vector<double>> gainL1() const;
       void setGainL1(const std::vector<std::vector<double>>& gainL1);
+      Sdx::Matrix<double> gainL1Matrix() const;
+      void setGainL1Matrix(const Sdx::Matrix<double>& gainL1);
 
 
       // **** gainTypeL1 ****
@@ -106,6 +109,8 @@ namespace Sdx
       // **** gainL2 ****
       std::vector<std::vector<double>> gainL2() const;
       void setGainL2(const std::vector<std::vector<double>>& gainL2);
+      Sdx::Matrix<double> gainL2Matrix() const;
+      void setGainL2Matrix(const Sdx::Matrix<double>& gainL2);
 
 
       // **** gainTypeL2 ****
@@ -121,6 +126,8 @@ namespace Sdx
       // **** gainL5 ****
       std::vector<std::vector<double>> gainL5() const;
       void setGainL5(const std::vector<std::vector<double>>& gainL5);
+      Sdx::Matrix<double> gainL5Matrix() const;
+      void setGainL5Matrix(const Sdx::Matrix<double>& gainL5);
 
 
       // **** gainTypeL5 ****
@@ -136,6 +143,8 @@ namespace Sdx
       // **** gainE6 ****
       std::vector<std::vector<double>> gainE6() const;
       void setGainE6(const std::vector<std::vector<double>>& gainE6);
+      Sdx::Matrix<double> gainE6Matrix() const;
+      void setGainE6Matrix(const Sdx::Matrix<double>& gainE6);
 
 
       // **** gainTypeE6 ****
@@ -151,6 +160,8 @@ namespace Sdx
       // **** gainS ****
       std::vector<std::vector<double>> gainS() const;
       void setGainS(const std::vector<std::vector<double>>& gainS);
+      Sdx::Matrix<double> gainSMatrix() const;
+      void setGainSMatrix(const Sdx::Matrix<double>& gainS);
 
 
       // **** gainTypeS ****
@@ -166,6 +177,8 @@ namespace Sdx
       // **** gainC ****
       std::vector<std::vector<double>> gainC() const;
       void setGainC(const std::vector<std::vector<double>>& gainC);
+      Sdx::Matrix<double> gainCMatrix() const;
+      void setGainCMatrix(const Sdx::Matrix<double>& gainC);
 
 
       // **** gainTypeC ****
@@ -181,6 +194,8 @@ namespace Sdx
       // **** phaseOffsetL1 ****
       std::vector<std::vector<double>> phaseOffsetL1() const;
       void setPhaseOffsetL1(const std::vector<std::vector<double>>& phaseOffsetL1);
+      Sdx::Matrix<double> phaseOffsetL1Matrix() const;
+      void setPhaseOffsetL1Matrix(const Sdx::Matrix<double>& phaseOffsetL1);
 
 
       // **** phaseOffsetTypeL1 ****
@@ -196,6 +211,8 @@ namespace Sdx
       // **** phaseOffsetL2 ****
       std::vector<std::vector<double>> phaseOffsetL2() const;
       void setPhaseOffsetL2(const std::vector<std::vector<double>>& phaseOffsetL2);
+      Sdx::Matrix<double> phaseOffsetL2Matrix() const;
+      void setPhaseOffsetL2Matrix(const Sdx::Matrix<double>& phaseOffsetL2);
 
 
       // **** phaseOffsetTypeL2 ****
@@ -211,6 +228,8 @@ namespace Sdx
       // **** phaseOffsetL5 ****
       std::vector<std::vector<double>> phaseOffsetL5() const;
       void setPhaseOffsetL5(const std::vector<std::vector<double>>& phaseOffsetL5);
+      Sdx::Matrix<double> phaseOffsetL5Matrix() const;
+      void setPhaseOffsetL5Matrix(const Sdx::Matrix<double>& phaseOffsetL5);
 
 
       // **** phaseOffsetTypeL5 ****
@@ -226,6 +245,8 @@ namespace Sdx
       // **** phaseOffsetE6 ****
       std::vector<std::vector<double>> phaseOffsetE6() const;
       void setPhaseOffsetE6(const std::vector<std::vector<double>>& phaseOffsetE6);
+      Sdx::Matrix<double> phaseOffsetE6Matrix() const;
+      void setPhaseOffsetE6Matrix(const Sdx::Matrix<double>& phaseOffsetE6);
 
 
       // **** phaseOffsetTypeE6 ****
@@ -241,6 +262,8 @@ namespace Sdx
       // **** phaseOffsetS ****
       std::vector<std::vector<double>> phaseOffsetS() const;
       void setPhaseOffsetS(const std::vector<std::vector<double>>& phaseOffsetS);
+      Sdx::Matrix<double> phaseOffsetSMatrix() const;
+      void setPhaseOffsetSMatrix(const Sdx::Matrix<double>& phaseOffsetS);
 
 
       // **** phaseOffsetTypeS ****
@@ -256,6 +279,8 @@ namespace Sdx
       // **** phaseOffsetC ****
       std::vector<std::vector<double>> phaseOffsetC() const;
       void setPhaseOffsetC(const std::vector<std::vector<double>>& phaseOffsetC);
+      Sdx::Matrix<double> phaseOffsetCMatrix() const;
+      void setPhaseOffsetCMatrix(const Sdx::Matrix<double>& phaseOffsetC);
 
 
       // **** phaseOffsetTypeC ****
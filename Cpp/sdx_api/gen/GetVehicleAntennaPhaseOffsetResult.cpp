@@ -94,7 +94,17 @@ namespace Sdx
 
     void GetVehicleAntennaPhaseOffsetResult::setPhaseOffset(const std::vector<std::vector<double>>& phaseOffset)
     {
-      m_values.AddMember("PhaseOffset", parse_json<std::vector<std::vector<double>>>::format(phaseOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffset", parse_json<std::vector<std::vector<double>>>::format(phaseOffset, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> GetVehicleAntennaPhaseOffsetResult::phaseOffsetMatrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["PhaseOffset"]);
+    }
+
+    void GetVehicleAntennaPhaseOffsetResult::setPhaseOffsetMatrix(const Sdx::Matrix<double>& phaseOffset)
+    {
+      setMember("PhaseOffset", parse_json<Sdx::Matrix<double>>::format(phaseOffset, m_values.GetAllocator()));
     }
 
 
@@ -106,7 +116,7 @@ namespace Sdx
 
     void GetVehicleAntennaPhaseOffsetResult::setType(const Sdx::AntennaPatternType& type)
     {
-      m_values.AddMember("Type", parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Type", parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()));
     }
 
 
@@ -118,7 +128,7 @@ namespace Sdx
 
     void GetVehicleAntennaPhaseOffsetResult::setBand(const Sdx::GNSSBand& band)
     {
-      m_values.AddMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()));
     }
 
 
@@ -130,7 +140,7 @@ namespace Sdx
 
     void GetVehicleAntennaPhaseOffsetResult::setName(const std::optional<std::string>& name)
     {
-      m_values.AddMember("Name", parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Name", parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()));
     }
 
 
@@ -86,7 +86,7 @@ namespace Sdx
 
     void GetVisibleSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +98,7 @@ namespace Sdx
 
     void GetVisibleSVResult::setSvId(const std::vector<int>& svId)
     {
-      m_values.AddMember("SvId", parse_json<std::vector<int>>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvId", parse_json<std::vector<int>>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -102,7 +102,7 @@ namespace Sdx
 
     void GetWFElementResult::setElement(int element)
     {
-      m_values.AddMember("Element", parse_json<int>::format(element, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Element", parse_json<int>::format(element, m_values.GetAllocator()));
     }
 
 
@@ -114,7 +114,7 @@ namespace Sdx
 
     void GetWFElementResult::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -126,7 +126,7 @@ namespace Sdx
 
     void GetWFElementResult::setAntennaModelName(const std::string& antennaModelName)
     {
-      m_values.AddMember("AntennaModelName", parse_json<std::string>::format(antennaModelName, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("AntennaModelName", parse_json<std::string>::format(antennaModelName, m_values.GetAllocator()));
     }
 
 
@@ -138,7 +138,7 @@ namespace Sdx
 
     void GetWFElementResult::setLnaGain(const std::optional<int>& lnaGain)
     {
-      m_values.AddMember("LnaGain", parse_json<std::optional<int>>::format(lnaGain, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("LnaGain", parse_json<std::optional<int>>::format(lnaGain, m_values.GetAllocator()));
     }
 
 
@@ -150,7 +150,7 @@ namespace Sdx
 
     void GetWFElementResult::setIsGaussianNoiseEnabled(const std::optional<bool>& isGaussianNoiseEnabled)
     {
-      m_values.AddMember("IsGaussianNoiseEnabled", parse_json<std::optional<bool>>::format(isGaussianNoiseEnabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("IsGaussianNoiseEnabled", parse_json<std::optional<bool>>::format(isGaussianNoiseEnabled, m_values.GetAllocator()));
     }
 
 
@@ -162,7 +162,7 @@ namespace Sdx
 
     void GetWFElementResult::setGaussianNoisePowerDensityOffset(const std::optional<double>& gaussianNoisePowerDensityOffset)
     {
-      m_values.AddMember("GaussianNoisePowerDensityOffset", parse_json<std::optional<double>>::format(gaussianNoisePowerDensityOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("GaussianNoisePowerDensityOffset", parse_json<std::optional<double>>::format(gaussianNoisePowerDensityOffset, m_values.GetAllocator()));
     }
 
 
@@ -93,7 +93,7 @@ namespace Sdx
 
     void ImportConstellationParameters::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -105,7 +105,7 @@ namespace Sdx
 
     void ImportConstellationParameters::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
@@ -117,7 +117,7 @@ namespace Sdx
 
     void ImportConstellationParameters::setRollover(const std::optional<int>& rollover)
     {
-      m_values.AddMember("Rollover", parse_json<std::optional<int>>::format(rollover, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Rollover", parse_json<std::optional<int>>::format(rollover, m_values.GetAllocator()));
     }
 
 
@@ -129,7 +129,7 @@ namespace Sdx
 
     void ImportConstellationParameters::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -141,7 +141,7 @@ namespace Sdx
 
     void ImportConstellationParameters::setNavMsgFamily(const std::optional<std::string>& navMsgFamily)
     {
-      m_values.AddMember("NavMsgFamily", parse_json<std::optional<std::string>>::format(navMsgFamily, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("NavMsgFamily", parse_json<std::optional<std::string>>::format(navMsgFamily, m_values.GetAllocator()));
     }
 
 
@@ -82,7 +82,7 @@ namespace Sdx
 
     void IsDektecAdjustedNoiseEnabledResult::setEnable(bool enable)
     {
-      m_values.AddMember("Enable", parse_json<bool>::format(enable, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Enable", parse_json<bool>::format(enable, m_values.GetAllocator()));
     }
 
 
@@ -86,7 +86,7 @@ namespace Sdx
 
     void IsIntTxIgnoreRxAntennaPhasePatternResult::setIgnore(bool ignore)
     {
-      m_values.AddMember("Ignore", parse_json<bool>::format(ignore, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Ignore", parse_json<bool>::format(ignore, m_values.GetAllocator()));
     }
 
 
@@ -98,7 +98,7 @@ namespace Sdx
 
     void IsIntTxIgnoreRxAntennaPhasePatternResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
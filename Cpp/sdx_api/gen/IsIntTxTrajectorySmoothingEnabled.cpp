@@ -76,7 +76,7 @@ namespace Sdx
 
     void IsIntTxTrajectorySmoothingEnabled::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
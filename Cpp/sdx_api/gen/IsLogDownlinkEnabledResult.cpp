@@ -90,7 +90,7 @@ namespace Sdx
 
     void IsLogDownlinkEnabledResult::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -102,7 +102,7 @@ namespace Sdx
 
     void IsLogDownlinkEnabledResult::setBeforeEncoding(const std::optional<bool>& beforeEncoding)
     {
-      m_values.AddMember("BeforeEncoding", parse_json<std::optional<bool>>::format(beforeEncoding, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("BeforeEncoding", parse_json<std::optional<bool>>::format(beforeEncoding, m_values.GetAllocator()));
     }
 
 
@@ -114,7 +114,7 @@ namespace Sdx
 
     void IsLogDownlinkEnabledResult::setAfterEncoding(const std::optional<bool>& afterEncoding)
     {
-      m_values.AddMember("AfterEncoding", parse_json<std::optional<bool>>::format(afterEncoding, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("AfterEncoding", parse_json<std::optional<bool>>::format(afterEncoding, m_values.GetAllocator()));
     }
 
 
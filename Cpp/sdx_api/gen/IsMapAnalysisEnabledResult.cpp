@@ -82,7 +82,7 @@ namespace Sdx
 
     void IsMapAnalysisEnabledResult::setShow(bool show)
     {
-      m_values.AddMember("Show", parse_json<bool>::format(show, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Show", parse_json<bool>::format(show, m_values.GetAllocator()));
     }
 
 
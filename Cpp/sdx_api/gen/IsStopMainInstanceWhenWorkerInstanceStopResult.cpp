@@ -82,7 +82,7 @@ namespace Sdx
 
     void IsStopMainInstanceWhenWorkerInstanceStopResult::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -82,7 +82,7 @@ namespace Sdx
 
     void IsTransmitMessage2InSbasMessage0Result::setTransmitMessage2(bool transmitMessage2)
     {
-      m_values.AddMember("TransmitMessage2", parse_json<bool>::format(transmitMessage2, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("TransmitMessage2", parse_json<bool>::format(transmitMessage2, m_values.GetAllocator()));
     }
 
 
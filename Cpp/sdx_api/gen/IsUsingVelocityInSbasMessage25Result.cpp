@@ -82,7 +82,7 @@ namespace Sdx
 
     void IsUsingVelocityInSbasMessage25Result::setUseVelocity(bool useVelocity)
     {
-      m_values.AddMember("UseVelocity", parse_json<bool>::format(useVelocity, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("UseVelocity", parse_json<bool>::format(useVelocity, m_values.GetAllocator()));
     }
 
 
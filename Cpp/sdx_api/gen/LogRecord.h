@@ -47,20 +47,33 @@ struct parse_json<Sdx::LogRecord>
 
     }
 
-    static Sdx::LogRecord parse(const rapidjson::Value& value)
+    static std::optional<Sdx::LogRecord> try_parse(const rapidjson::Value& value)
     {
-      if (!is_valid(value))
-        throw std::runtime_error("Unexpected value");
+      if (!value.IsObject())
+        return std::nullopt;
       Sdx::LogRecord sent;
 
-      sent.TimeStamp = parse_json<Sdx::DateTime>::parse(value["TimeStamp"]);
-      sent.State = parse_json<Sdx::SimulatorState>::parse(value["State"]);
-      sent.SubState = parse_json<Sdx::SimulatorSubState>::parse(value["SubState"]);
-      sent.Level = parse_json<Sdx::LogLevel>::parse(value["Level"]);
-      sent.Message = parse_json<std::string>::parse(value["Message"]);
+      if (!try_parse_json(value["TimeStamp"], sent.TimeStamp))
+        return std::nullopt;
+      if (!try_parse_json(value["State"], sent.State))
+        return std::nullopt;
+      if (!try_parse_json(value["SubState"], sent.SubState))
+        return std::nullopt;
+      if (!try_parse_json(value["Level"], sent.Level))
+        return std::nullopt;
+      if (!try_parse_json(value["Message"], sent.Message))
+        return std::nullopt;
       return sent;
     }
 
+    static Sdx::LogRecord parse(const rapidjson::Value& value)
+    {
+      std::optional<Sdx::LogRecord> sent = try_parse(value);
+      if (!sent)
+        throw std::runtime_error("Unexpected value");
+      return std::move(*sent);
+    }
+
     static rapidjson::Value format(const Sdx::LogRecord& value, rapidjson::Value::AllocatorType& alloc)
     {
       rapidjson::Value sent(rapidjson::kObjectType);
@@ -60,6 +60,15 @@ namespace Sdx
       return std::make_shared<PushDynamicAlmanacData>(system, toa, almanac);
     }
 
+    PushDynamicAlmanacDataPtr PushDynamicAlmanacData::createWithAlmanacParameters(const std::string& system, const Sdx::DateTime& toa, const std::vector<Sdx::AlmanacSVParameters>& almanac)
+    {
+      auto cmd = std::make_shared<PushDynamicAlmanacData>();
+      cmd->setSystem(system);
+      cmd->setToa(toa);
+      cmd->setAlmanacParameters(almanac);
+      return cmd;
+    }
+
     PushDynamicAlmanacDataPtr PushDynamicAlmanacData::dynamicCast(CommandBasePtr ptr)
     {
       return std::dynamic_pointer_cast<PushDynamicAlmanacData>(ptr);
@@ -98,7 +107,7 @@ namespace Sdx
 
     void PushDynamicAlmanacData::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -110,7 +119,7 @@ namespace Sdx
 
     void PushDynamicAlmanacData::setToa(const Sdx::DateTime& toa)
     {
-      m_values.AddMember("Toa", parse_json<Sdx::DateTime>::format(toa, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Toa", parse_json<Sdx::DateTime>::format(toa, m_values.GetAllocator()));
     }
 
 
@@ -122,7 +131,17 @@ namespace Sdx
 
     void PushDynamicAlmanacData::setAlmanac(const std::vector<Sdx::AlmanacSVData>& almanac)
     {
-      m_values.AddMember("Almanac", parse_json<std::vector<Sdx::AlmanacSVData>>::format(almanac, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Almanac", parse_json<std::vector<Sdx::AlmanacSVData>>::format(almanac, m_values.GetAllocator()));
+    }
+
+    std::vector<Sdx::AlmanacSVParameters> PushDynamicAlmanacData::almanacParameters() const
+    {
+      return parse_json<std::vector<Sdx::AlmanacSVParameters>>::parse(m_values["Almanac"]);
+    }
+
+    void PushDynamicAlmanacData::setAlmanacParameters(const std::vector<Sdx::AlmanacSVParameters>& almanac)
+    {
+      setMember("Almanac", parse_json<std::vector<Sdx::AlmanacSVParameters>>::format(almanac, m_values.GetAllocator()));
     }
 
 
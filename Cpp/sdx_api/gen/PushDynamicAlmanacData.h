@@ -5,6 +5,7 @@
 
 #include "date_time.h"
 #include "gen/AlmanacSVData.h"
+#include "sv_parameters.h"
 #include <string>
 #include <vector>
 
@@ -55,6 +56,8 @@ namespace Sdx
       PushDynamicAlmanacData(const std::string& system, const Sdx::DateTime& toa, const std::vector<Sdx::AlmanacSVData>& almanac);
 
       static PushDynamicAlmanacDataPtr create(const std::string& system, const Sdx::DateTime& toa, const std::vector<Sdx::AlmanacSVData>& almanac);
+
+      static PushDynamicAlmanacDataPtr createWithAlmanacParameters(const std::string& system, const Sdx::DateTime& toa, const std::vector<Sdx::AlmanacSVParameters>& almanac);
       static PushDynamicAlmanacDataPtr dynamicCast(CommandBasePtr ptr);
       virtual bool isValid() const override;
       virtual std::string documentation() const override;
@@ -76,6 +79,9 @@ namespace Sdx
       // **** almanac ****
       std::vector<Sdx::AlmanacSVData> almanac() const;
       void setAlmanac(const std::vector<Sdx::AlmanacSVData>& almanac);
+      // Same field with fixed layout parameter blocks, without a tree node and a key string per parameter
+      std::vector<Sdx::AlmanacSVParameters> almanacParameters() const;
+      void setAlmanacParameters(const std::vector<Sdx::AlmanacSVParameters>& almanac);
     };
     
   }
@@ -91,6 +91,17 @@ namespace Sdx
       return std::make_shared<PushDynamicSVData>(system, svId, toc, parametersDict, dataSetTypes);
     }
 
+    PushDynamicSVDataPtr PushDynamicSVData::createWithParameters(const std::string& system, int svId, const Sdx::DateTime& toc, const Sdx::SvParameters& parameters, const std::optional<std::vector<std::string>>& dataSetTypes)
+    {
+      auto cmd = std::make_shared<PushDynamicSVData>();
+      cmd->setSystem(system);
+      cmd->setSvId(svId);
+      cmd->setToc(toc);
+      cmd->setParameters(parameters);
+      cmd->setDataSetTypes(dataSetTypes);
+      return cmd;
+    }
+
     PushDynamicSVDataPtr PushDynamicSVData::dynamicCast(CommandBasePtr ptr)
     {
       return std::dynamic_pointer_cast<PushDynamicSVData>(ptr);
@@ -131,7 +142,7 @@ namespace Sdx
 
     void PushDynamicSVData::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -143,7 +154,7 @@ namespace Sdx
 
     void PushDynamicSVData::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -155,7 +166,7 @@ namespace Sdx
 
     void PushDynamicSVData::setToc(const Sdx::DateTime& toc)
     {
-      m_values.AddMember("Toc", parse_json<Sdx::DateTime>::format(toc, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Toc", parse_json<Sdx::DateTime>::format(toc, m_values.GetAllocator()));
     }
 
 
@@ -167,7 +178,17 @@ namespace Sdx
 
     void PushDynamicSVData::setParametersDict(const std::map<std::string, double>& parametersDict)
     {
-      m_values.AddMember("ParametersDict", parse_json<std::map<std::string, double>>::format(parametersDict, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("ParametersDict", parse_json<std::map<std::string, double>>::format(parametersDict, m_values.GetAllocator()));
+    }
+
+    Sdx::SvParameters PushDynamicSVData::parameters() const
+    {
+      return parse_json<Sdx::SvParameters>::parse(m_values["ParametersDict"]);
+    }
+
+    void PushDynamicSVData::setParameters(const Sdx::SvParameters& parameters)
+    {
+      setMember("ParametersDict", parse_json<Sdx::SvParameters>::format(parameters, m_values.GetAllocator()));
     }
 
 
@@ -179,7 +200,7 @@ namespace Sdx
 
     void PushDynamicSVData::setDataSetTypes(const std::optional<std::vector<std::string>>& dataSetTypes)
     {
-      m_values.AddMember("DataSetTypes", parse_json<std::optional<std::vector<std::string>>>::format(dataSetTypes, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("DataSetTypes", parse_json<std::optional<std::vector<std::string>>>::format(dataSetTypes, m_values.GetAllocator()));
     }
 
 
@@ -4,6 +4,7 @@
 #include "command_base.h"
 
 #include "date_time.h"
+#include "sv_parameters.h"
 #include <map>
 #include <optional>
 #include <string>
@@ -85,6 +86,8 @@ namespace Sdx
       PushDynamicSVData(const std::string& system, int svId, const Sdx::DateTime& toc, const std::map<std::string, double>& parametersDict, const std::optional<std::vector<std::string>>& dataSetTypes = {});
 
       static PushDynamicSVDataPtr create(const std::string& system, int svId, const Sdx::DateTime& toc, const std::map<std::string, double>& parametersDict, const std::optional<std::vector<std::string>>& dataSetTypes = {});
+
+      static PushDynamicSVDataPtr createWithParameters(const std::string& system, int svId, const Sdx::DateTime& toc, const Sdx::SvParameters& parameters, const std::optional<std::vector<std::string>>& dataSetTypes = {});
       static PushDynamicSVDataPtr dynamicCast(CommandBasePtr ptr);
       virtual bool isValid() const override;
       virtual std::string documentation() const override;
@@ -111,6 +114,9 @@ namespace Sdx
       // **** parametersDict ****
       std::map<std::string, double> parametersDict() const;
       void setParametersDict(const std::map<std::string, double>& parametersDict);
+      // Same field as a fixed layout block, without a tree node and a key string per parameter
+      Sdx::SvParameters parameters() const;
+      void setParameters(const Sdx::SvParameters& parameters);
 
 
       // **** dataSetTypes ****
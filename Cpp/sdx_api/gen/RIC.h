@@ -37,18 +37,29 @@ struct parse_json<Sdx::RIC>
 
     }
 
-    static Sdx::RIC parse(const rapidjson::Value& value)
+    static std::optional<Sdx::RIC> try_parse(const rapidjson::Value& value)
     {
-      if (!is_valid(value))
-        throw std::runtime_error("Unexpected value");
+      if (!value.IsObject())
+        return std::nullopt;
       Sdx::RIC sent;
 
-      sent.R = parse_json<double>::parse(value["R"]);
-      sent.I = parse_json<double>::parse(value["I"]);
-      sent.C = parse_json<double>::parse(value["C"]);
+      if (!try_parse_json(value["R"], sent.R))
+        return std::nullopt;
+      if (!try_parse_json(value["I"], sent.I))
+        return std::nullopt;
+      if (!try_parse_json(value["C"], sent.C))
+        return std::nullopt;
       return sent;
     }
 
+    static Sdx::RIC parse(const rapidjson::Value& value)
+    {
+      std::optional<Sdx::RIC> sent = try_parse(value);
+      if (!sent)
+        throw std::runtime_error("Unexpected value");
+      return std::move(*sent);
+    }
+
     static rapidjson::Value format(const Sdx::RIC& value, rapidjson::Value::AllocatorType& alloc)
     {
       rapidjson::Value sent(rapidjson::kObjectType);
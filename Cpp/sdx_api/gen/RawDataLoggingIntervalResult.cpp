@@ -98,7 +98,7 @@ namespace Sdx
 
     void RawDataLoggingIntervalResult::setDays(int days)
     {
-      m_values.AddMember("Days", parse_json<int>::format(days, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Days", parse_json<int>::format(days, m_values.GetAllocator()));
     }
 
 
@@ -110,7 +110,7 @@ namespace Sdx
 
     void RawDataLoggingIntervalResult::setHours(int hours)
     {
-      m_values.AddMember("Hours", parse_json<int>::format(hours, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Hours", parse_json<int>::format(hours, m_values.GetAllocator()));
     }
 
 
@@ -122,7 +122,7 @@ namespace Sdx
 
     void RawDataLoggingIntervalResult::setMinutes(int minutes)
     {
-      m_values.AddMember("Minutes", parse_json<int>::format(minutes, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Minutes", parse_json<int>::format(minutes, m_values.GetAllocator()));
     }
 
 
@@ -134,7 +134,7 @@ namespace Sdx
 
     void RawDataLoggingIntervalResult::setSeconds(int seconds)
     {
-      m_values.AddMember("Seconds", parse_json<int>::format(seconds, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Seconds", parse_json<int>::format(seconds, m_values.GetAllocator()));
     }
 
 
@@ -146,7 +146,7 @@ namespace Sdx
 
     void RawDataLoggingIntervalResult::setMilliseconds(int milliseconds)
     {
-      m_values.AddMember("Milliseconds", parse_json<int>::format(milliseconds, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Milliseconds", parse_json<int>::format(milliseconds, m_values.GetAllocator()));
     }
 
 
@@ -82,7 +82,7 @@ namespace Sdx
 
     void RemoveAllMultipathForSignal::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
@@ -94,7 +94,7 @@ namespace Sdx
 
     void RemoveAllMultipathForSignal::setReset(bool reset)
     {
-      m_values.AddMember("Reset", parse_json<bool>::format(reset, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Reset", parse_json<bool>::format(reset, m_values.GetAllocator()));
     }
 
 
@@ -82,7 +82,7 @@ namespace Sdx
 
     void RenameDataSet::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -94,7 +94,7 @@ namespace Sdx
 
     void RenameDataSet::setDataSetName(const std::string& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::string>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("DataSetName", parse_json<std::string>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -106,7 +106,7 @@ namespace Sdx
 
     void RenameDataSet::setNewDataSetName(const std::string& newDataSetName)
     {
-      m_values.AddMember("NewDataSetName", parse_json<std::string>::format(newDataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("NewDataSetName", parse_json<std::string>::format(newDataSetName, m_values.GetAllocator()));
     }
 
 
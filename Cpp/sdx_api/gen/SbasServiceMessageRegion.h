@@ -43,20 +43,33 @@ struct parse_json<Sdx::SbasServiceMessageRegion>
 
     }
 
-    static Sdx::SbasServiceMessageRegion parse(const rapidjson::Value& value)
+    static std::optional<Sdx::SbasServiceMessageRegion> try_parse(const rapidjson::Value& value)
     {
-      if (!is_valid(value))
-        throw std::runtime_error("Unexpected value");
+      if (!value.IsObject())
+        return std::nullopt;
       Sdx::SbasServiceMessageRegion sent;
 
-      sent.FirstLatitude = parse_json<int>::parse(value["FirstLatitude"]);
-      sent.FirstLongitude = parse_json<int>::parse(value["FirstLongitude"]);
-      sent.SecondLatitude = parse_json<int>::parse(value["SecondLatitude"]);
-      sent.SecondLongitude = parse_json<int>::parse(value["SecondLongitude"]);
-      sent.Shape = parse_json<std::string>::parse(value["Shape"]);
+      if (!try_parse_json(value["FirstLatitude"], sent.FirstLatitude))
+        return std::nullopt;
+      if (!try_parse_json(value["FirstLongitude"], sent.FirstLongitude))
+        return std::nullopt;
+      if (!try_parse_json(value["SecondLatitude"], sent.SecondLatitude))
+        return std::nullopt;
+      if (!try_parse_json(value["SecondLongitude"], sent.SecondLongitude))
+        return std::nullopt;
+      if (!try_parse_json(value["Shape"], sent.Shape))
+        return std::nullopt;
       return sent;
     }
 
+    static Sdx::SbasServiceMessageRegion parse(const rapidjson::Value& value)
+    {
+      std::optional<Sdx::SbasServiceMessageRegion> sent = try_parse(value);
+      if (!sent)
+        throw std::runtime_error("Unexpected value");
+      return std::move(*sent);
+    }
+
     static rapidjson::Value format(const Sdx::SbasServiceMessageRegion& value, rapidjson::Value::AllocatorType& alloc)
     {
       rapidjson::Value sent(rapidjson::kObjectType);
@@ -93,7 +93,7 @@ namespace Sdx
 
     void SetAllSatellitesPseudorangeNoiseGaussMarkov::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -105,7 +105,7 @@ namespace Sdx
 
     void SetAllSatellitesPseudorangeNoiseGaussMarkov::setProcess(int process)
     {
-      m_values.AddMember("Process", parse_json<int>::format(process, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Process", parse_json<int>::format(process, m_values.GetAllocator()));
     }
 
 
@@ -117,7 +117,7 @@ namespace Sdx
 
     void SetAllSatellitesPseudorangeNoiseGaussMarkov::setEnabled(const std::vector<bool>& enabled)
     {
-      m_values.AddMember("Enabled", parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Enabled", parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -129,7 +129,7 @@ namespace Sdx
 
     void SetAllSatellitesPseudorangeNoiseGaussMarkov::setSigma(const std::vector<double>& sigma)
     {
-      m_values.AddMember("Sigma", parse_json<std::vector<double>>::format(sigma, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Sigma", parse_json<std::vector<double>>::format(sigma, m_values.GetAllocator()));
     }
 
 
@@ -141,7 +141,7 @@ namespace Sdx
 
     void SetAllSatellitesPseudorangeNoiseGaussMarkov::setTime(const std::vector<double>& time)
     {
-      m_values.AddMember("Time", parse_json<std::vector<double>>::format(time, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Time", parse_json<std::vector<double>>::format(time, m_values.GetAllocator()));
     }
 
 
@@ -153,7 +153,7 @@ namespace Sdx
 
     void SetAllSatellitesPseudorangeNoiseGaussMarkov::setSeed(const std::vector<int>& seed)
     {
-      m_values.AddMember("Seed", parse_json<std::vector<int>>::format(seed, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Seed", parse_json<std::vector<int>>::format(seed, m_values.GetAllocator()));
     }
 
 
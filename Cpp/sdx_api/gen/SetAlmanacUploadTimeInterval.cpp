@@ -80,7 +80,7 @@ namespace Sdx
 
     void SetAlmanacUploadTimeInterval::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -92,7 +92,7 @@ namespace Sdx
 
     void SetAlmanacUploadTimeInterval::setInterval(int interval)
     {
-      m_values.AddMember("Interval", parse_json<int>::format(interval, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Interval", parse_json<int>::format(interval, m_values.GetAllocator()));
     }
 
 
@@ -76,7 +76,7 @@ namespace Sdx
 
     void SetEngineLatency::setLatency(int latency)
     {
-      m_values.AddMember("Latency", parse_json<int>::format(latency, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Latency", parse_json<int>::format(latency, m_values.GetAllocator()));
     }
 
 
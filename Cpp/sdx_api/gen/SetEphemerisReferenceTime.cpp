@@ -87,7 +87,7 @@ namespace Sdx
 
     void SetEphemerisReferenceTime::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -99,7 +99,7 @@ namespace Sdx
 
     void SetEphemerisReferenceTime::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -111,7 +111,7 @@ namespace Sdx
 
     void SetEphemerisReferenceTime::setTime(const Sdx::DateTime& time)
     {
-      m_values.AddMember("Time", parse_json<Sdx::DateTime>::format(time, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Time", parse_json<Sdx::DateTime>::format(time, m_values.GetAllocator()));
     }
 
 
@@ -123,7 +123,7 @@ namespace Sdx
 
     void SetEphemerisReferenceTime::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
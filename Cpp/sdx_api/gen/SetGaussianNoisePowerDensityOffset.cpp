@@ -82,7 +82,7 @@ namespace Sdx
 
     void SetGaussianNoisePowerDensityOffset::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -94,7 +94,7 @@ namespace Sdx
 
     void SetGaussianNoisePowerDensityOffset::setOutputIdx(int outputIdx)
     {
-      m_values.AddMember("OutputIdx", parse_json<int>::format(outputIdx, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("OutputIdx", parse_json<int>::format(outputIdx, m_values.GetAllocator()));
     }
 
 
@@ -106,7 +106,7 @@ namespace Sdx
 
     void SetGaussianNoisePowerDensityOffset::setPowerDensityOffset(double powerDensityOffset)
     {
-      m_values.AddMember("PowerDensityOffset", parse_json<double>::format(powerDensityOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PowerDensityOffset", parse_json<double>::format(powerDensityOffset, m_values.GetAllocator()));
     }
 
 
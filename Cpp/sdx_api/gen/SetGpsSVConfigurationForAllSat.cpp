@@ -81,7 +81,7 @@ namespace Sdx
 
     void SetGpsSVConfigurationForAllSat::setSvConfigs(const std::vector<int>& svConfigs)
     {
-      m_values.AddMember("SvConfigs", parse_json<std::vector<int>>::format(svConfigs, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvConfigs", parse_json<std::vector<int>>::format(svConfigs, m_values.GetAllocator()));
     }
 
 
@@ -93,7 +93,7 @@ namespace Sdx
 
     void SetGpsSVConfigurationForAllSat::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -82,7 +82,17 @@ namespace Sdx
 
     void SetIntTxAntenna::setGain(const std::vector<std::vector<double>>& gain)
     {
-      m_values.AddMember("Gain", parse_json<std::vector<std::vector<double>>>::format(gain, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Gain", parse_json<std::vector<std::vector<double>>>::format(gain, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> SetIntTxAntenna::gainMatrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["Gain"]);
+    }
+
+    void SetIntTxAntenna::setGainMatrix(const Sdx::Matrix<double>& gain)
+    {
+      setMember("Gain", parse_json<Sdx::Matrix<double>>::format(gain, m_values.GetAllocator()));
     }
 
 
@@ -94,7 +104,7 @@ namespace Sdx
 
     void SetIntTxAntenna::setType(const Sdx::AntennaPatternType& type)
     {
-      m_values.AddMember("Type", parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Type", parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()));
     }
 
 
@@ -106,7 +116,7 @@ namespace Sdx
 
     void SetIntTxAntenna::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
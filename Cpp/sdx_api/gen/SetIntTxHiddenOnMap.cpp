@@ -79,7 +79,7 @@ namespace Sdx
 
     void SetIntTxHiddenOnMap::setHiddenOnMap(bool hiddenOnMap)
     {
-      m_values.AddMember("HiddenOnMap", parse_json<bool>::format(hiddenOnMap, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("HiddenOnMap", parse_json<bool>::format(hiddenOnMap, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void SetIntTxHiddenOnMap::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
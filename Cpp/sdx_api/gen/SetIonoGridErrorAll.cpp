@@ -76,7 +76,17 @@ namespace Sdx
 
     void SetIonoGridErrorAll::setGrid(const std::vector<std::vector<double>>& grid)
     {
-      m_values.AddMember("Grid", parse_json<std::vector<std::vector<double>>>::format(grid, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Grid", parse_json<std::vector<std::vector<double>>>::format(grid, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> SetIonoGridErrorAll::gridMatrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["Grid"]);
+    }
+
+    void SetIonoGridErrorAll::setGridMatrix(const Sdx::Matrix<double>& grid)
+    {
+      setMember("Grid", parse_json<Sdx::Matrix<double>>::format(grid, m_values.GetAllocator()));
     }
 
 
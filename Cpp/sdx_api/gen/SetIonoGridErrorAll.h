@@ -2,6 +2,7 @@
 
 #include <memory>
 #include "command_base.h"
+#include "matrix.h"
 
 #include <vector>
 
@@ -45,6 +46,8 @@ namespace Sdx
       // **** grid ****
       std::vector<std::vector<double>> grid() const;
       void setGrid(const std::vector<std::vector<double>>& grid);
+      Sdx::Matrix<double> gridMatrix() const;
+      void setGridMatrix(const Sdx::Matrix<double>& grid);
     };
     
   }
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include "command_base.h"
+#include "matrix.h"
 
 #include <optional>
 #include <string>
@@ -48,6 +49,8 @@ namespace Sdx
       // **** grid ****
       std::vector<std::vector<int>> grid() const;
       void setGrid(const std::vector<std::vector<int>>& grid);
+      Sdx::Matrix<int> gridMatrix() const;
+      void setGridMatrix(const Sdx::Matrix<int>& grid);
 
 
       // **** serviceProvider ****
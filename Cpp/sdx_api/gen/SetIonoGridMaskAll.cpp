@@ -79,7 +79,7 @@ namespace Sdx
 
     void SetIonoGridMaskAll::setServiceProvider(const std::string& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,17 @@ namespace Sdx
 
     void SetIonoGridMaskAll::setGrid(const std::vector<std::vector<bool>>& grid)
     {
-      m_values.AddMember("Grid", parse_json<std::vector<std::vector<bool>>>::format(grid, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Grid", parse_json<std::vector<std::vector<bool>>>::format(grid, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<bool> SetIonoGridMaskAll::gridMatrix() const
+    {
+      return parse_json<Sdx::Matrix<bool>>::parse(m_values["Grid"]);
+    }
+
+    void SetIonoGridMaskAll::setGridMatrix(const Sdx::Matrix<bool>& grid)
+    {
+      setMember("Grid", parse_json<Sdx::Matrix<bool>>::format(grid, m_values.GetAllocator()));
     }
 
 
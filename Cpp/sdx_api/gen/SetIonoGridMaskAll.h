@@ -2,6 +2,7 @@
 
 #include <memory>
 #include "command_base.h"
+#include "matrix.h"
 
 #include <string>
 #include <vector>
@@ -52,6 +53,8 @@ namespace Sdx
       // **** grid ****
       std::vector<std::vector<bool>> grid() const;
       void setGrid(const std::vector<std::vector<bool>>& grid);
+      Sdx::Matrix<bool> gridMatrix() const;
+      void setGridMatrix(const Sdx::Matrix<bool>& grid);
     };
     
   }
@@ -76,7 +76,7 @@ namespace Sdx
 
     void SetLeapSecond::setLeapSecond(int leapSecond)
     {
-      m_values.AddMember("LeapSecond", parse_json<int>::format(leapSecond, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("LeapSecond", parse_json<int>::format(leapSecond, m_values.GetAllocator()));
     }
 
 
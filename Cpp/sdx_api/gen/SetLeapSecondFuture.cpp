@@ -82,7 +82,7 @@ namespace Sdx
 
     void SetLeapSecondFuture::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -94,7 +94,7 @@ namespace Sdx
 
     void SetLeapSecondFuture::setSeconds(int seconds)
     {
-      m_values.AddMember("Seconds", parse_json<int>::format(seconds, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Seconds", parse_json<int>::format(seconds, m_values.GetAllocator()));
     }
 
 
@@ -106,7 +106,7 @@ namespace Sdx
 
     void SetLeapSecondFuture::setDate(const Sdx::Date& date)
     {
-      m_values.AddMember("Date", parse_json<Sdx::Date>::format(date, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Date", parse_json<Sdx::Date>::format(date, m_values.GetAllocator()));
     }
 
 
@@ -76,7 +76,7 @@ namespace Sdx
 
     void SetLogNmeaRate::setRate(int rate)
     {
-      m_values.AddMember("Rate", parse_json<int>::format(rate, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Rate", parse_json<int>::format(rate, m_values.GetAllocator()));
     }
 
 
@@ -90,7 +90,7 @@ namespace Sdx
 
     void SetMerkleTreeParameters::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -102,7 +102,7 @@ namespace Sdx
 
     void SetMerkleTreeParameters::setKeyType(const std::string& keyType)
     {
-      m_values.AddMember("KeyType", parse_json<std::string>::format(keyType, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("KeyType", parse_json<std::string>::format(keyType, m_values.GetAllocator()));
     }
 
 
@@ -114,7 +114,7 @@ namespace Sdx
 
     void SetMerkleTreeParameters::setHashFunction(const std::string& hashFunction)
     {
-      m_values.AddMember("HashFunction", parse_json<std::string>::format(hashFunction, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("HashFunction", parse_json<std::string>::format(hashFunction, m_values.GetAllocator()));
     }
 
 
@@ -126,7 +126,7 @@ namespace Sdx
 
     void SetMerkleTreeParameters::setBeginApplicability(const Sdx::DateTime& beginApplicability)
     {
-      m_values.AddMember("BeginApplicability", parse_json<Sdx::DateTime>::format(beginApplicability, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("BeginApplicability", parse_json<Sdx::DateTime>::format(beginApplicability, m_values.GetAllocator()));
     }
 
 
@@ -138,7 +138,7 @@ namespace Sdx
 
     void SetMerkleTreeParameters::setEndApplicability(const std::optional<Sdx::DateTime>& endApplicability)
     {
-      m_values.AddMember("EndApplicability", parse_json<std::optional<Sdx::DateTime>>::format(endApplicability, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("EndApplicability", parse_json<std::optional<Sdx::DateTime>>::format(endApplicability, m_values.GetAllocator()));
     }
 
 
@@ -125,7 +125,7 @@ namespace Sdx
 
     void SetMessageModificationToGlonassNav::setSignalArray(const std::vector<std::string>& signalArray)
     {
-      m_values.AddMember("SignalArray", parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SignalArray", parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()));
     }
 
 
@@ -137,7 +137,7 @@ namespace Sdx
 
     void SetMessageModificationToGlonassNav::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -149,7 +149,7 @@ namespace Sdx
 
     void SetMessageModificationToGlonassNav::setStartTime(int startTime)
     {
-      m_values.AddMember("StartTime", parse_json<int>::format(startTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("StartTime", parse_json<int>::format(startTime, m_values.GetAllocator()));
     }
 
 
@@ -161,7 +161,7 @@ namespace Sdx
 
     void SetMessageModificationToGlonassNav::setStopTime(int stopTime)
     {
-      m_values.AddMember("StopTime", parse_json<int>::format(stopTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("StopTime", parse_json<int>::format(stopTime, m_values.GetAllocator()));
     }
 
 
@@ -173,7 +173,7 @@ namespace Sdx
 
     void SetMessageModificationToGlonassNav::setFrame(int frame)
     {
-      m_values.AddMember("Frame", parse_json<int>::format(frame, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Frame", parse_json<int>::format(frame, m_values.GetAllocator()));
     }
 
 
@@ -185,7 +185,7 @@ namespace Sdx
 
     void SetMessageModificationToGlonassNav::setStringNumber(int stringNumber)
     {
-      m_values.AddMember("StringNumber", parse_json<int>::format(stringNumber, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("StringNumber", parse_json<int>::format(stringNumber, m_values.GetAllocator()));
     }
 
 
@@ -197,7 +197,7 @@ namespace Sdx
 
     void SetMessageModificationToGlonassNav::setUpdateHammingCode(bool updateHammingCode)
     {
-      m_values.AddMember("UpdateHammingCode", parse_json<bool>::format(updateHammingCode, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("UpdateHammingCode", parse_json<bool>::format(updateHammingCode, m_values.GetAllocator()));
     }
 
 
@@ -209,7 +209,7 @@ namespace Sdx
 
     void SetMessageModificationToGlonassNav::setStringModification(const std::string& stringModification)
     {
-      m_values.AddMember("StringModification", parse_json<std::string>::format(stringModification, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("StringModification", parse_json<std::string>::format(stringModification, m_values.GetAllocator()));
     }
 
 
@@ -221,7 +221,7 @@ namespace Sdx
 
     void SetMessageModificationToGlonassNav::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -101,7 +101,7 @@ namespace Sdx
 
     void SetMultipathForSV::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
@@ -113,7 +113,7 @@ namespace Sdx
 
     void SetMultipathForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -125,7 +125,7 @@ namespace Sdx
 
     void SetMultipathForSV::setPowerLoss(double powerLoss)
     {
-      m_values.AddMember("PowerLoss", parse_json<double>::format(powerLoss, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PowerLoss", parse_json<double>::format(powerLoss, m_values.GetAllocator()));
     }
 
 
@@ -137,7 +137,7 @@ namespace Sdx
 
     void SetMultipathForSV::setPseudorange(double pseudorange)
     {
-      m_values.AddMember("Pseudorange", parse_json<double>::format(pseudorange, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Pseudorange", parse_json<double>::format(pseudorange, m_values.GetAllocator()));
     }
 
 
@@ -149,7 +149,7 @@ namespace Sdx
 
     void SetMultipathForSV::setDoppler(double doppler)
     {
-      m_values.AddMember("Doppler", parse_json<double>::format(doppler, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Doppler", parse_json<double>::format(doppler, m_values.GetAllocator()));
     }
 
 
@@ -161,7 +161,7 @@ namespace Sdx
 
     void SetMultipathForSV::setCarrierPhase(double carrierPhase)
     {
-      m_values.AddMember("CarrierPhase", parse_json<double>::format(carrierPhase, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("CarrierPhase", parse_json<double>::format(carrierPhase, m_values.GetAllocator()));
     }
 
 
@@ -173,7 +173,7 @@ namespace Sdx
 
     void SetMultipathForSV::setEcho(int echo)
     {
-      m_values.AddMember("Echo", parse_json<int>::format(echo, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Echo", parse_json<int>::format(echo, m_values.GetAllocator()));
     }
 
 
@@ -185,7 +185,7 @@ namespace Sdx
 
     void SetMultipathForSV::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -79,7 +79,7 @@ namespace Sdx
 
     void SetN310LocalOscillatorSource::setIsExternal(bool isExternal)
     {
-      m_values.AddMember("IsExternal", parse_json<bool>::format(isExternal, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("IsExternal", parse_json<bool>::format(isExternal, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void SetN310LocalOscillatorSource::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
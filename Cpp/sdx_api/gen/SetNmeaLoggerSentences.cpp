@@ -76,7 +76,7 @@ namespace Sdx
 
     void SetNmeaLoggerSentences::setSentences(const std::vector<std::string>& sentences)
     {
-      m_values.AddMember("Sentences", parse_json<std::vector<std::string>>::format(sentences, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Sentences", parse_json<std::vector<std::string>>::format(sentences, m_values.GetAllocator()));
     }
 
 
@@ -77,7 +77,7 @@ namespace Sdx
 
     void SetOsnmaMacFunction::setMacFunction(const std::string& macFunction)
     {
-      m_values.AddMember("MacFunction", parse_json<std::string>::format(macFunction, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("MacFunction", parse_json<std::string>::format(macFunction, m_values.GetAllocator()));
     }
 
 
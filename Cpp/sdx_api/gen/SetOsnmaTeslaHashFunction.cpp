@@ -76,7 +76,7 @@ namespace Sdx
 
     void SetOsnmaTeslaHashFunction::setHashFunction(const std::string& hashFunction)
     {
-      m_values.AddMember("HashFunction", parse_json<std::string>::format(hashFunction, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("HashFunction", parse_json<std::string>::format(hashFunction, m_values.GetAllocator()));
     }
 
 
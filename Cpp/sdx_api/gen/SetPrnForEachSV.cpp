@@ -79,7 +79,7 @@ namespace Sdx
 
     void SetPrnForEachSV::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void SetPrnForEachSV::setPrn(const std::vector<int>& prn)
     {
-      m_values.AddMember("Prn", parse_json<std::vector<int>>::format(prn, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Prn", parse_json<std::vector<int>>::format(prn, m_values.GetAllocator()));
     }
 
 
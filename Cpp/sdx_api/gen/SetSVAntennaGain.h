@@ -2,6 +2,7 @@
 
 #include <memory>
 #include "command_base.h"
+#include "matrix.h"
 
 #include "gen/AntennaPatternType.h"
 #include "gen/GNSSBand.h"
@@ -53,6 +54,8 @@ namespace Sdx
       // **** gain ****
       std::vector<std::vector<double>> gain() const;
       void setGain(const std::vector<std::vector<double>>& gain);
+      Sdx::Matrix<double> gainMatrix() const;
+      void setGainMatrix(const Sdx::Matrix<double>& gain);
 
 
       // **** type ****
@@ -88,7 +88,17 @@ namespace Sdx
 
     void SetSVAntennaPhaseOffset::setPhaseOffset(const std::vector<std::vector<double>>& phaseOffset)
     {
-      m_values.AddMember("PhaseOffset", parse_json<std::vector<std::vector<double>>>::format(phaseOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffset", parse_json<std::vector<std::vector<double>>>::format(phaseOffset, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> SetSVAntennaPhaseOffset::phaseOffsetMatrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["PhaseOffset"]);
+    }
+
+    void SetSVAntennaPhaseOffset::setPhaseOffsetMatrix(const Sdx::Matrix<double>& phaseOffset)
+    {
+      setMember("PhaseOffset", parse_json<Sdx::Matrix<double>>::format(phaseOffset, m_values.GetAllocator()));
     }
 
 
@@ -100,7 +110,7 @@ namespace Sdx
 
     void SetSVAntennaPhaseOffset::setType(const Sdx::AntennaPatternType& type)
     {
-      m_values.AddMember("Type", parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Type", parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()));
     }
 
 
@@ -112,7 +122,7 @@ namespace Sdx
 
     void SetSVAntennaPhaseOffset::setBand(const Sdx::GNSSBand& band)
     {
-      m_values.AddMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()));
     }
 
 
@@ -124,7 +134,7 @@ namespace Sdx
 
     void SetSVAntennaPhaseOffset::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -136,7 +146,7 @@ namespace Sdx
 
     void SetSVAntennaPhaseOffset::setName(const std::optional<std::string>& name)
     {
-      m_values.AddMember("Name", parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Name", parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()));
     }
 
 
@@ -79,7 +79,7 @@ namespace Sdx
 
     void SetSbasEphemerisReferenceTimeForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void SetSbasEphemerisReferenceTimeForSV::setTime(const Sdx::DateTime& time)
     {
-      m_values.AddMember("Time", parse_json<Sdx::DateTime>::format(time, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Time", parse_json<Sdx::DateTime>::format(time, m_values.GetAllocator()));
     }
 
 
@@ -79,7 +79,7 @@ namespace Sdx
 
     void SetSbasMessageUpdateInterval::setMessage(int message)
     {
-      m_values.AddMember("Message", parse_json<int>::format(message, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Message", parse_json<int>::format(message, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void SetSbasMessageUpdateInterval::setUpdateInterval(int updateInterval)
     {
-      m_values.AddMember("UpdateInterval", parse_json<int>::format(updateInterval, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("UpdateInterval", parse_json<int>::format(updateInterval, m_values.GetAllocator()));
     }
 
 
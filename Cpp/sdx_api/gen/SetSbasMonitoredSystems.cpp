@@ -76,7 +76,7 @@ namespace Sdx
 
     void SetSbasMonitoredSystems::setSystems(const std::vector<std::string>& systems)
     {
-      m_values.AddMember("Systems", parse_json<std::vector<std::string>>::format(systems, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Systems", parse_json<std::vector<std::string>>::format(systems, m_values.GetAllocator()));
     }
 
 
@@ -83,7 +83,7 @@ namespace Sdx
 
     void SetSignalFilterAssignation::setSignalFilterDict(const std::map<std::string, std::string>& signalFilterDict)
     {
-      m_values.AddMember("SignalFilterDict", parse_json<std::map<std::string, std::string>>::format(signalFilterDict, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SignalFilterDict", parse_json<std::map<std::string, std::string>>::format(signalFilterDict, m_values.GetAllocator()));
     }
 
 
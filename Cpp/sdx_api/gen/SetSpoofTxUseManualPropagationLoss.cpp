@@ -79,7 +79,7 @@ namespace Sdx
 
     void SetSpoofTxUseManualPropagationLoss::setManual(bool manual)
     {
-      m_values.AddMember("Manual", parse_json<bool>::format(manual, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Manual", parse_json<bool>::format(manual, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void SetSpoofTxUseManualPropagationLoss::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
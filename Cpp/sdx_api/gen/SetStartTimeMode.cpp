@@ -76,7 +76,7 @@ namespace Sdx
 
     void SetStartTimeMode::setMode(const std::string& mode)
     {
-      m_values.AddMember("Mode", parse_json<std::string>::format(mode, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Mode", parse_json<std::string>::format(mode, m_values.GetAllocator()));
     }
 
 
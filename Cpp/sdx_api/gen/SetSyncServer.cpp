@@ -76,7 +76,7 @@ namespace Sdx
 
     void SetSyncServer::setPort(int port)
     {
-      m_values.AddMember("Port", parse_json<int>::format(port, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Port", parse_json<int>::format(port, m_values.GetAllocator()));
     }
 
 
@@ -76,7 +76,7 @@ namespace Sdx
 
     void SetTransmitMessage2InSbasMessage0::setTransmitMessage2(bool transmitMessage2)
     {
-      m_values.AddMember("TransmitMessage2", parse_json<bool>::format(transmitMessage2, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("TransmitMessage2", parse_json<bool>::format(transmitMessage2, m_values.GetAllocator()));
     }
 
 
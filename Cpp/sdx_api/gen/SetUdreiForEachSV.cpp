@@ -79,7 +79,7 @@ namespace Sdx
 
     void SetUdreiForEachSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -91,7 +91,7 @@ namespace Sdx
 
     void SetUdreiForEachSV::setUdreis(const std::vector<int>& udreis)
     {
-      m_values.AddMember("Udreis", parse_json<std::vector<int>>::format(udreis, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Udreis", parse_json<std::vector<int>>::format(udreis, m_values.GetAllocator()));
     }
 
 
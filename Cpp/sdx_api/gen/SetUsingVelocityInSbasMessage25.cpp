@@ -76,7 +76,7 @@ namespace Sdx
 
     void SetUsingVelocityInSbasMessage25::setUseVelocity(bool useVelocity)
     {
-      m_values.AddMember("UseVelocity", parse_json<bool>::format(useVelocity, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("UseVelocity", parse_json<bool>::format(useVelocity, m_values.GetAllocator()));
     }
 
 
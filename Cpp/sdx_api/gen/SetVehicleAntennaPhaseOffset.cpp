@@ -85,7 +85,17 @@ namespace Sdx
 
     void SetVehicleAntennaPhaseOffset::setPhaseOffset(const std::vector<std::vector<double>>& phaseOffset)
     {
-      m_values.AddMember("PhaseOffset", parse_json<std::vector<std::vector<double>>>::format(phaseOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffset", parse_json<std::vector<std::vector<double>>>::format(phaseOffset, m_values.GetAllocator()));
+    }
+
+    Sdx::Matrix<double> SetVehicleAntennaPhaseOffset::phaseOffsetMatrix() const
+    {
+      return parse_json<Sdx::Matrix<double>>::parse(m_values["PhaseOffset"]);
+    }
+
+    void SetVehicleAntennaPhaseOffset::setPhaseOffsetMatrix(const Sdx::Matrix<double>& phaseOffset)
+    {
+      setMember("PhaseOffset", parse_json<Sdx::Matrix<double>>::format(phaseOffset, m_values.GetAllocator()));
     }
 
 
@@ -97,7 +107,7 @@ namespace Sdx
 
     void SetVehicleAntennaPhaseOffset::setType(const Sdx::AntennaPatternType& type)
     {
-      m_values.AddMember("Type", parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Type", parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()));
     }
 
 
@@ -109,7 +119,7 @@ namespace Sdx
 
     void SetVehicleAntennaPhaseOffset::setBand(const Sdx::GNSSBand& band)
     {
-      m_values.AddMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()));
     }
 
 
@@ -121,7 +131,7 @@ namespace Sdx
 
     void SetVehicleAntennaPhaseOffset::setName(const std::optional<std::string>& name)
     {
-      m_values.AddMember("Name", parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Name", parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()));
     }
 
 
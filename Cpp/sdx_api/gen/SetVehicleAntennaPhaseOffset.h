@@ -2,6 +2,7 @@
 
 #include <memory>
 #include "command_base.h"
+#include "matrix.h"
 
 #include "gen/AntennaPatternType.h"
 #include "gen/GNSSBand.h"
@@ -52,6 +53,8 @@ namespace Sdx
       // **** phaseOffset ****
       std::vector<std::vector<double>> phaseOffset() const;
       void setPhaseOffset(const std::vector<std::vector<double>>& phaseOffset);
+      Sdx::Matrix<double> phaseOffsetMatrix() const;
+      void setPhaseOffsetMatrix(const Sdx::Matrix<double>& phaseOffset);
 
 
       // **** type ****
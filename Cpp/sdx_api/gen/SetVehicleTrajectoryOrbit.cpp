@@ -97,7 +97,7 @@ namespace Sdx
 
     void SetVehicleTrajectoryOrbit::setType(const std::string& type)
     {
-      m_values.AddMember("Type", parse_json<std::string>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Type", parse_json<std::string>::format(type, m_values.GetAllocator()));
     }
 
 
@@ -109,7 +109,7 @@ namespace Sdx
 
     void SetVehicleTrajectoryOrbit::setReference(const Sdx::DateTime& reference)
     {
-      m_values.AddMember("Reference", parse_json<Sdx::DateTime>::format(reference, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Reference", parse_json<Sdx::DateTime>::format(reference, m_values.GetAllocator()));
     }
 
 
@@ -121,7 +121,7 @@ namespace Sdx
 
     void SetVehicleTrajectoryOrbit::setSemiMajorAxis(double semiMajorAxis)
     {
-      m_values.AddMember("SemiMajorAxis", parse_json<double>::format(semiMajorAxis, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SemiMajorAxis", parse_json<double>::format(semiMajorAxis, m_values.GetAllocator()));
     }
 
 
@@ -133,7 +133,7 @@ namespace Sdx
 
     void SetVehicleTrajectoryOrbit::setInclination(double inclination)
     {
-      m_values.AddMember("Inclination", parse_json<double>::format(inclination, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Inclination", parse_json<double>::format(inclination, m_values.GetAllocator()));
     }
 
 
@@ -145,7 +145,7 @@ namespace Sdx
 
     void SetVehicleTrajectoryOrbit::setRightAscension(double rightAscension)
     {
-      m_values.AddMember("RightAscension", parse_json<double>::format(rightAscension, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("RightAscension", parse_json<double>::format(rightAscension, m_values.GetAllocator()));
     }
 
 
@@ -157,7 +157,7 @@ namespace Sdx
 
     void SetVehicleTrajectoryOrbit::setEccentricity(double eccentricity)
     {
-      m_values.AddMember("Eccentricity", parse_json<double>::format(eccentricity, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Eccentricity", parse_json<double>::format(eccentricity, m_values.GetAllocator()));
     }
 
 
@@ -169,7 +169,7 @@ namespace Sdx
 
     void SetVehicleTrajectoryOrbit::setMeanAnomaly(double meanAnomaly)
     {
-      m_values.AddMember("MeanAnomaly", parse_json<double>::format(meanAnomaly, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("MeanAnomaly", parse_json<double>::format(meanAnomaly, m_values.GetAllocator()));
     }
 
 
@@ -181,7 +181,7 @@ namespace Sdx
 
     void SetVehicleTrajectoryOrbit::setArgumentOfPerigee(double argumentOfPerigee)
     {
-      m_values.AddMember("ArgumentOfPerigee", parse_json<double>::format(argumentOfPerigee, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("ArgumentOfPerigee", parse_json<double>::format(argumentOfPerigee, m_values.GetAllocator()));
     }
 
 
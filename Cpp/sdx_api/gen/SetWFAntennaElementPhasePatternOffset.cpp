@@ -85,7 +85,7 @@ namespace Sdx
 
     void SetWFAntennaElementPhasePatternOffset::setPhaseOffset(double phaseOffset)
     {
-      m_values.AddMember("PhaseOffset", parse_json<double>::format(phaseOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("PhaseOffset", parse_json<double>::format(phaseOffset, m_values.GetAllocator()));
     }
 
 
@@ -97,7 +97,7 @@ namespace Sdx
 
     void SetWFAntennaElementPhasePatternOffset::setElement(int element)
     {
-      m_values.AddMember("Element", parse_json<int>::format(element, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Element", parse_json<int>::format(element, m_values.GetAllocator()));
     }
 
 
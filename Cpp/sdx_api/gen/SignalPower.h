@@ -43,20 +43,33 @@ struct parse_json<Sdx::SignalPower>
 
     }
 
-    static Sdx::SignalPower parse(const rapidjson::Value& value)
+    static std::optional<Sdx::SignalPower> try_parse(const rapidjson::Value& value)
     {
-      if (!is_valid(value))
-        throw std::runtime_error("Unexpected value");
+      if (!value.IsObject())
+        return std::nullopt;
       Sdx::SignalPower sent;
 
-      sent.AntennaOffset = parse_json<double>::parse(value["AntennaOffset"]);
-      sent.StrengthModelOffset = parse_json<double>::parse(value["StrengthModelOffset"]);
-      sent.SignalOffset = parse_json<double>::parse(value["SignalOffset"]);
-      sent.ManualOffset = parse_json<double>::parse(value["ManualOffset"]);
-      sent.Total = parse_json<double>::parse(value["Total"]);
+      if (!try_parse_json(value["AntennaOffset"], sent.AntennaOffset))
+        return std::nullopt;
+      if (!try_parse_json(value["StrengthModelOffset"], sent.StrengthModelOffset))
+        return std::nullopt;
+      if (!try_parse_json(value["SignalOffset"], sent.SignalOffset))
+        return std::nullopt;
+      if (!try_parse_json(value["ManualOffset"], sent.ManualOffset))
+        return std::nullopt;
+      if (!try_parse_json(value["Total"], sent.Total))
+        return std::nullopt;
       return sent;
     }
 
+    static Sdx::SignalPower parse(const rapidjson::Value& value)
+    {
+      std::optional<Sdx::SignalPower> sent = try_parse(value);
+      if (!sent)
+        throw std::runtime_error("Unexpected value");
+      return std::move(*sent);
+    }
+
     static rapidjson::Value format(const Sdx::SignalPower& value, rapidjson::Value::AllocatorType& alloc)
     {
       rapidjson::Value sent(rapidjson::kObjectType);
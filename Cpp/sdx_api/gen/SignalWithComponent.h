@@ -35,17 +35,27 @@ struct parse_json<Sdx::SignalWithComponent>
 
     }
 
-    static Sdx::SignalWithComponent parse(const rapidjson::Value& value)
+    static std::optional<Sdx::SignalWithComponent> try_parse(const rapidjson::Value& value)
     {
-      if (!is_valid(value))
-        throw std::runtime_error("Unexpected value");
+      if (!value.IsObject())
+        return std::nullopt;
       Sdx::SignalWithComponent sent;
 
-      sent.Signal = parse_json<std::string>::parse(value["Signal"]);
-      sent.Component = parse_json<std::optional<std::string>>::parse(value["Component"]);
+      if (!try_parse_json(value["Signal"], sent.Signal))
+        return std::nullopt;
+      if (!try_parse_json(value["Component"], sent.Component))
+        return std::nullopt;
       return sent;
     }
 
+    static Sdx::SignalWithComponent parse(const rapidjson::Value& value)
+    {
+      std::optional<Sdx::SignalWithComponent> sent = try_parse(value);
+      if (!sent)
+        throw std::runtime_error("Unexpected value");
+      return std::move(*sent);
+    }
+
     static rapidjson::Value format(const Sdx::SignalWithComponent& value, rapidjson::Value::AllocatorType& alloc)
     {
       rapidjson::Value sent(rapidjson::kObjectType);
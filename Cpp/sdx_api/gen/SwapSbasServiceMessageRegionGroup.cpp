@@ -82,7 +82,7 @@ namespace Sdx
 
     void SwapSbasServiceMessageRegionGroup::setServiceProvider(const std::string& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
@@ -94,7 +94,7 @@ namespace Sdx
 
     void SwapSbasServiceMessageRegionGroup::setFirstId(const std::string& firstId)
     {
-      m_values.AddMember("FirstId", parse_json<std::string>::format(firstId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("FirstId", parse_json<std::string>::format(firstId, m_values.GetAllocator()));
     }
 
 
@@ -106,7 +106,7 @@ namespace Sdx
 
     void SwapSbasServiceMessageRegionGroup::setSecondId(const std::string& secondId)
     {
-      m_values.AddMember("SecondId", parse_json<std::string>::format(secondId, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("SecondId", parse_json<std::string>::format(secondId, m_values.GetAllocator()));
     }
 
 
@@ -76,7 +76,7 @@ namespace Sdx
 
     void TestEncryptionLibrary::setType(const Sdx::EncryptionSignalType& type)
     {
-      m_values.AddMember("Type", parse_json<Sdx::EncryptionSignalType>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setMember("Type", parse_json<Sdx::EncryptionSignalType>::format(type, m_values.GetAllocator()));
     }
 
 
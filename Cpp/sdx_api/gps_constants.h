@@ -10,6 +10,8 @@ const double ESMAJ = 6378137.0; // Semi-major axis of Earth, meters
 const double EFLAT = 0.00335281066474;
 const double ESMIN = ESMAJ * (1.0 - EFLAT);
 const double EECC_SQUARED = (((ESMAJ * ESMAJ) - (ESMIN * ESMIN)) / (ESMAJ * ESMAJ));
+const double GM = 3.986005e14;          // Earth's gravitational constant, m^3/s^2
+const double OMEGA_E = 7.2921151467e-5; // Earth's rotation rate, rad/s
 } // namespace GPS
 } // namespace Sdx
 
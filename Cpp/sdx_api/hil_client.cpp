@@ -6,6 +6,7 @@
 #include <winsock.h>
 #else
 #include <winsock2.h>
+#include <ws2tcpip.h>
 #endif
 #else
 #include <arpa/inet.h>
@@ -22,6 +23,8 @@
 #include <iostream>
 
 #include "ecef.h"
+#include "stream_recorder.h"
+#include "trace_recorder.h"
 #include "vehicle_info.h"
 
 #define HIL_BLOCK_SIZE 255
@@ -29,27 +32,71 @@
 namespace Sdx
 {
 
+// Thread safe, unlike gethostbyname which returns a static hostent: clients connect concurrently, see SimulatorCluster
+static bool resolveHost(const std::string& ip, int socketType, sockaddr_in& addr)
+{
+#ifdef WINSOCK1
+  // The Windows gethostbyname result is per thread
+  hostent* server = gethostbyname(ip.c_str());
+  if (!server)
+    return false;
+  memcpy(&addr.sin_addr.s_addr, server->h_addr, server->h_length);
+  return true;
+#else
+  addrinfo hints {};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = socketType;
+  addrinfo* result = nullptr;
+  if (getaddrinfo(ip.c_str(), nullptr, &hints, &result) != 0 || !result)
+    return false;
+  addr.sin_addr = reinterpret_cast<sockaddr_in*>(result->ai_addr)->sin_addr;
+  freeaddrinfo(result);
+  return true;
+#endif
+}
+
+static const char* messageName(char msgId)
+{
+  switch (static_cast<HilMessageId>(msgId))
+  {
+    case HilMsgId_Hello:
+      return "Hello";
+    case HilMsgId_Bye:
+      return "Bye";
+    case HilMsgId_PushEcef:
+      return "PushEcef";
+    case HilMsgId_PushEcefNed:
+      return "PushEcefNed";
+    case HilMsgId_PushEcefDynamics:
+      return "PushEcefDynamics";
+    case HilMsgId_PushEcefNedDynamics:
+      return "PushEcefNedDynamics";
+    default:
+      return "";
+  }
+}
+
 struct HilClient::Pimpl
 {
   std::string errorMessage;
 
   int s;
-  struct hostent* server;
   struct sockaddr_in servAddr;
   bool connected;
   char message[HIL_BLOCK_SIZE];
   bool stopRequest;
   bool exceptionOnError;
   bool verbose;
+  StreamRecorder* streamRecorder;
 };
 
 HilClient::HilClient(bool exceptionOnError) : m(new Pimpl)
 {
   m->s = -1;
-  m->server = 0;
   m->connected = false;
   m->exceptionOnError = exceptionOnError;
   m->verbose = false;
+  m->streamRecorder = nullptr;
 #if _WIN32
   WORD versionWanted = MAKEWORD(2, 0);
   WSADATA wsaData;
@@ -95,16 +142,14 @@ bool HilClient::connectToHost(const std::string& ip, int port)
     errorMessage("Unable to create socket");
     return false;
   }
-  m->server = gethostbyname(ip.c_str());
-  if (!m->server)
+  memset(&m->servAddr, 0, sizeof(m->servAddr));
+  m->servAddr.sin_family = AF_INET;
+  if (!resolveHost(ip, SOCK_DGRAM, m->servAddr))
   {
     disconnect();
     errorMessage("Unable to get host by name");
     return false;
   }
-  memset(&m->servAddr, 0, sizeof(m->servAddr));
-  m->servAddr.sin_family = AF_INET;
-  memcpy(&m->servAddr.sin_addr.s_addr, m->server->h_addr, m->server->h_length);
   m->servAddr.sin_port = htons(static_cast<u_short>(port));
   if (connect(m->s, reinterpret_cast<sockaddr*>(&m->servAddr), sizeof(m->servAddr)) < 0)
   {
@@ -434,6 +479,8 @@ bool HilClient::recvVehicleInfo(VehicleInfo& simStats)
     memcpy(&simStats.speed, &m->message[57], 8);
     memcpy(&simStats.heading, &m->message[65], 8);
     memcpy(&simStats.odometer, &m->message[73], 8);
+    if (TraceRecorder::instance().isEnabled())
+      TraceRecorder::instance().instant("hil", "VehicleInfo", static_cast<double>(simStats.elapsedTime));
 
     return true;
   }
@@ -441,6 +488,16 @@ bool HilClient::recvVehicleInfo(VehicleInfo& simStats)
   return false;
 }
 
+void HilClient::setStreamRecorder(StreamRecorder* recorder)
+{
+  m->streamRecorder = recorder;
+}
+
+bool HilClient::sendRawMessage(const char* message, int length)
+{
+  return sendMessage(message, length);
+}
+
 void HilClient::disconnect()
 {
   if (m->s < 0)
@@ -461,6 +518,7 @@ void HilClient::disconnect()
 
 bool HilClient::sendMessage(const char* message, int length)
 {
+  TraceScope trace("hil", "push", messageName(message[0]));
   if (!m->connected)
   {
     return false;
@@ -470,6 +528,8 @@ bool HilClient::sendMessage(const char* message, int length)
     errorMessage("Error sending message.");
     return false;
   }
+  if (m->streamRecorder)
+    m->streamRecorder->record(StreamRecordKind::HilSent, message, length);
   return true;
 }
 
@@ -482,6 +542,8 @@ bool HilClient::receiveMessage()
     disconnect();
     return false;
   }
+  if (m->streamRecorder)
+    m->streamRecorder->record(StreamRecordKind::HilReceived, m->message, rx);
 
   return true;
 }
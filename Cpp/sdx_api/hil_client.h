@@ -48,6 +48,7 @@ struct HilMessageEcefNed
 
 class Ecef;
 class Attitude;
+class StreamRecorder;
 struct VehicleInfo;
 class HilClient
 {
@@ -224,6 +225,11 @@ public:
   bool recvNextVehicleInfo(VehicleInfo& vehicleInfo);
   void clearVehicleInfo();
 
+  // Appends every datagram sent and received to recorder. The recorder must outlive the client, nullptr detaches it.
+  void setStreamRecorder(StreamRecorder* recorder);
+  // Sends an already encoded datagram, as recorded by a StreamRecorder.
+  bool sendRawMessage(const char* message, int length);
+
 private:
   struct Pimpl;
   Pimpl* m;
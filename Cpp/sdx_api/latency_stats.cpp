@@ -0,0 +1,274 @@
+#include "latency_stats.h"
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <algorithm>
+#include <bit>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <sstream>
+
+namespace Sdx
+{
+
+LatencyHistogram::LatencyHistogram()
+{
+  reset();
+}
+
+int LatencyHistogram::bucketIndex(uint64_t nanoseconds)
+{
+  if (nanoseconds < static_cast<uint64_t>(SubBucketCount))
+    return static_cast<int>(nanoseconds);
+
+  const int magnitude = std::min(static_cast<int>(std::bit_width(nanoseconds)) - 1, MaxMagnitude);
+  if (nanoseconds >> magnitude >= 2) // Beyond the covered range
+    return BucketCount - 1;
+
+  const int shift = magnitude - SubBucketBits;
+  const int subBucket = static_cast<int>(nanoseconds >> shift) - SubBucketCount;
+  return SubBucketCount * (shift + 1) + subBucket;
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(int index)
+{
+  if (index < SubBucketCount)
+    return static_cast<uint64_t>(index);
+
+  const int shift = index / SubBucketCount - 1;
+  const uint64_t lowerBound = static_cast<uint64_t>(SubBucketCount + index % SubBucketCount) << shift;
+  return lowerBound + (uint64_t(1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t nanoseconds)
+{
+  m_buckets[bucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+  m_count.fetch_add(1, std::memory_order_relaxed);
+  m_sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+  uint64_t current = m_min.load(std::memory_order_relaxed);
+  while (nanoseconds < current && !m_min.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed))
+    ;
+  current = m_max.load(std::memory_order_relaxed);
+  while (nanoseconds > current && !m_max.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed))
+    ;
+}
+
+void LatencyHistogram::reset()
+{
+  for (auto& bucket : m_buckets)
+    bucket.store(0, std::memory_order_relaxed);
+  m_count.store(0, std::memory_order_relaxed);
+  m_sum.store(0, std::memory_order_relaxed);
+  m_min.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+  m_max.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::count() const
+{
+  return m_count.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::min() const
+{
+  return count() == 0 ? 0 : m_min.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::max() const
+{
+  return m_max.load(std::memory_order_relaxed);
+}
+
+double LatencyHistogram::mean() const
+{
+  const uint64_t n = count();
+  return n == 0 ? 0.0 : static_cast<double>(m_sum.load(std::memory_order_relaxed)) / static_cast<double>(n);
+}
+
+uint64_t LatencyHistogram::percentile(double percent) const
+{
+  const uint64_t n = count();
+  if (n == 0)
+    return 0;
+
+  const double clamped = std::clamp(percent, 0.0, 100.0);
+  const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(clamped / 100.0 * static_cast<double>(n) + 0.5));
+  uint64_t seen = 0;
+  for (int i = 0; i < BucketCount; ++i)
+  {
+    seen += m_buckets[i].load(std::memory_order_relaxed);
+    if (seen >= rank)
+      return std::min(bucketUpperBound(i), max());
+  }
+  return max();
+}
+
+LatencyStats::LatencyStats() : m_enabled(false)
+{
+}
+
+LatencyStats::~LatencyStats() = default;
+
+void LatencyStats::setEnabled(bool enabled)
+{
+  m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void LatencyStats::record(const std::string& cmdName, LatencyPhase phase, std::chrono::nanoseconds duration)
+{
+  PhaseHistograms* histograms = nullptr;
+  {
+    std::shared_lock lock(m_mutex);
+    if (auto it = m_histograms.find(cmdName); it != m_histograms.end())
+      histograms = it->second.get();
+  }
+  if (!histograms)
+  {
+    std::unique_lock lock(m_mutex);
+    auto& entry = m_histograms[cmdName];
+    if (!entry)
+      entry = std::make_unique<PhaseHistograms>();
+    histograms = entry.get();
+  }
+  (*histograms)[static_cast<size_t>(phase)].record(duration);
+}
+
+std::vector<std::string> LatencyStats::commandNames() const
+{
+  std::vector<std::string> names;
+  {
+    std::shared_lock lock(m_mutex);
+    names.reserve(m_histograms.size());
+    for (const auto& [name, histograms] : m_histograms)
+      names.push_back(name);
+  }
+  std::sort(names.begin(), names.end());
+  return names;
+}
+
+const LatencyHistogram* LatencyStats::histogram(const std::string& cmdName, LatencyPhase phase) const
+{
+  std::shared_lock lock(m_mutex);
+  if (auto it = m_histograms.find(cmdName); it != m_histograms.end())
+    return &(*it->second)[static_cast<size_t>(phase)];
+  return nullptr;
+}
+
+void LatencyStats::reset()
+{
+  std::shared_lock lock(m_mutex);
+  for (auto& [name, histograms] : m_histograms)
+    for (LatencyHistogram& histogram : *histograms)
+      histogram.reset();
+}
+
+const char* LatencyStats::phaseName(LatencyPhase phase)
+{
+  switch (phase)
+  {
+    case LatencyPhase::Send:
+      return "Send";
+    case LatencyPhase::FirstByte:
+      return "FirstByte";
+    case LatencyPhase::Parse:
+      return "Parse";
+  }
+  return "";
+}
+
+namespace
+{
+constexpr LatencyPhase Phases[] = {LatencyPhase::Send, LatencyPhase::FirstByte, LatencyPhase::Parse};
+constexpr double Percentiles[] = {50.0, 90.0, 99.0};
+
+double toMicroseconds(double nanoseconds)
+{
+  return nanoseconds / 1000.0;
+}
+} // namespace
+
+std::string LatencyStats::toText() const
+{
+  const std::vector<std::string> names = commandNames();
+  size_t width = 7;
+  for (const std::string& name : names)
+    width = std::max(width, name.size());
+
+  std::ostringstream ss;
+  ss << std::left << std::setw(static_cast<int>(width)) << "Command" << "  " << std::setw(9) << "Phase" << std::right
+     << std::setw(10) << "Count" << std::setw(12) << "Min(us)" << std::setw(12) << "Mean(us)" << std::setw(12)
+     << "P50(us)" << std::setw(12) << "P90(us)" << std::setw(12) << "P99(us)" << std::setw(12) << "Max(us)" << '\n';
+  ss << std::fixed << std::setprecision(1);
+
+  for (const std::string& name : names)
+  {
+    for (LatencyPhase phase : Phases)
+    {
+      const LatencyHistogram* h = histogram(name, phase);
+      if (!h || h->count() == 0)
+        continue;
+      ss << std::left << std::setw(static_cast<int>(width)) << name << "  " << std::setw(9) << phaseName(phase)
+         << std::right << std::setw(10) << h->count() << std::setw(12) << toMicroseconds(h->min()) << std::setw(12)
+         << toMicroseconds(h->mean());
+      for (double p : Percentiles)
+        ss << std::setw(12) << toMicroseconds(static_cast<double>(h->percentile(p)));
+      ss << std::setw(12) << toMicroseconds(static_cast<double>(h->max())) << '\n';
+    }
+  }
+  return ss.str();
+}
+
+std::string LatencyStats::toJson() const
+{
+  rapidjson::StringBuffer sb;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+
+  writer.StartObject();
+  writer.Key("Commands");
+  writer.StartObject();
+  for (const std::string& name : commandNames())
+  {
+    writer.Key(name.c_str());
+    writer.StartObject();
+    for (LatencyPhase phase : Phases)
+    {
+      const LatencyHistogram* h = histogram(name, phase);
+      if (!h || h->count() == 0)
+        continue;
+      writer.Key(phaseName(phase));
+      writer.StartObject();
+      writer.Key("Count");
+      writer.Uint64(h->count());
+      writer.Key("MinUs");
+      writer.Double(toMicroseconds(static_cast<double>(h->min())));
+      writer.Key("MeanUs");
+      writer.Double(toMicroseconds(h->mean()));
+      writer.Key("P50Us");
+      writer.Double(toMicroseconds(static_cast<double>(h->percentile(50.0))));
+      writer.Key("P90Us");
+      writer.Double(toMicroseconds(static_cast<double>(h->percentile(90.0))));
+      writer.Key("P99Us");
+      writer.Double(toMicroseconds(static_cast<double>(h->percentile(99.0))));
+      writer.Key("MaxUs");
+      writer.Double(toMicroseconds(static_cast<double>(h->max())));
+      writer.EndObject();
+    }
+    writer.EndObject();
+  }
+  writer.EndObject();
+  writer.EndObject();
+  return sb.GetString();
+}
+
+bool LatencyStats::dump(const std::string& path) const
+{
+  const bool isJson = path.size() >= 5 && path.compare(path.size() - 5, 5, ".json") == 0;
+  std::ofstream file(path);
+  file << (isJson ? toJson() : toText());
+  return file.good();
+}
+
+} // namespace Sdx
@@ -0,0 +1,107 @@
+#ifndef LATENCY_STATS_H
+#define LATENCY_STATS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Sdx
+{
+
+// Lock-free histogram of durations in nanoseconds.
+//
+// Buckets follow the HDR histogram layout: values below 16 ns are exact, above that every power of two is split in 16
+// linear sub-buckets, so any recorded value is known within 6.25%. Durations up to about 18 minutes are covered,
+// longer ones are counted in the last bucket. Recording is a few relaxed atomic operations and can be done from any
+// thread while another one reads the histogram.
+class LatencyHistogram
+{
+public:
+  static constexpr int SubBucketBits = 4;
+  static constexpr int SubBucketCount = 1 << SubBucketBits;
+  static constexpr int MaxMagnitude = 40; // 2^40 ns
+  static constexpr int BucketCount = SubBucketCount * (MaxMagnitude - SubBucketBits + 2);
+
+  LatencyHistogram();
+
+  void record(uint64_t nanoseconds);
+  inline void record(std::chrono::nanoseconds duration)
+  {
+    record(static_cast<uint64_t>(duration.count() > 0 ? duration.count() : 0));
+  }
+  void reset();
+
+  uint64_t count() const;
+  uint64_t min() const; // ns, 0 if empty
+  uint64_t max() const; // ns, 0 if empty
+  double mean() const;  // ns, 0 if empty
+
+  // Highest value equivalent to the recorded value at the given percentile [0, 100], in ns.
+  uint64_t percentile(double percent) const;
+
+  static int bucketIndex(uint64_t nanoseconds);
+  static uint64_t bucketUpperBound(int index);
+
+private:
+  std::array<std::atomic<uint64_t>, BucketCount> m_buckets;
+  std::atomic<uint64_t> m_count;
+  std::atomic<uint64_t> m_sum;
+  std::atomic<uint64_t> m_min;
+  std::atomic<uint64_t> m_max;
+};
+
+enum class LatencyPhase
+{
+  Send,      // Command serialization and socket send
+  FirstByte, // End of send until the client reads the first byte of the result
+  Parse      // Result decoding
+};
+
+// Per command name latency histograms of the Send, FirstByte and Parse phases of a command round trip.
+//
+// Disabled by default: when disabled, CmdClient doesn't read the clock and the only overhead is a flag check per
+// command. Histograms are created the first time a command name is recorded, queries can run concurrently with the
+// recording.
+class LatencyStats
+{
+public:
+  LatencyStats();
+  ~LatencyStats();
+
+  void setEnabled(bool enabled);
+  inline bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+  void record(const std::string& cmdName, LatencyPhase phase, std::chrono::nanoseconds duration);
+
+  // Sorted names of the commands with recorded latencies
+  std::vector<std::string> commandNames() const;
+  // nullptr if nothing was recorded for cmdName, otherwise valid for the lifetime of the stats
+  const LatencyHistogram* histogram(const std::string& cmdName, LatencyPhase phase) const;
+  // Clears the recorded values, the histograms themselves are kept
+  void reset();
+
+  // Table of count, min, mean, p50, p90, p99 and max in microseconds per command and phase
+  std::string toText() const;
+  std::string toJson() const;
+  // Writes toJson() if path ends with .json, toText() otherwise
+  bool dump(const std::string& path) const;
+
+  static const char* phaseName(LatencyPhase phase);
+
+private:
+  using PhaseHistograms = std::array<LatencyHistogram, 3>;
+
+  std::atomic<bool> m_enabled;
+  mutable std::shared_mutex m_mutex;
+  std::unordered_map<std::string, std::unique_ptr<PhaseHistograms>> m_histograms;
+};
+
+} // namespace Sdx
+
+#endif // LATENCY_STATS_H
@@ -0,0 +1,153 @@
+#ifndef MATRIX_H
+#define MATRIX_H
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "parse_json.hpp"
+
+namespace Sdx
+{
+
+// Row-major matrix stored in a single buffer, for the "array array" fields (antenna patterns, iono grids).
+//
+// A Matrix<bool> stores its elements as uint8_t so rows can be viewed as spans.
+template<typename T>
+class Matrix
+{
+public:
+  using Element = std::conditional_t<std::is_same_v<T, bool>, uint8_t, T>;
+
+  Matrix() : m_rows(0), m_cols(0) {}
+  Matrix(size_t rows, size_t cols, Element value = Element()) : m_rows(rows), m_cols(cols), m_data(rows * cols, value)
+  {
+  }
+
+  // Throws std::runtime_error if the rows don't all have the same size
+  explicit Matrix(const std::vector<std::vector<T>>& rows) :
+    m_rows(rows.size()),
+    m_cols(rows.empty() ? 0 : rows[0].size())
+  {
+    m_data.reserve(m_rows * m_cols);
+    for (const auto& row : rows)
+    {
+      if (row.size() != m_cols)
+        throw std::runtime_error("Matrix rows must all have the same size");
+      m_data.insert(m_data.end(), row.begin(), row.end());
+    }
+  }
+
+  inline size_t rows() const { return m_rows; }
+  inline size_t cols() const { return m_cols; }
+  inline size_t size() const { return m_data.size(); }
+  inline bool empty() const { return m_data.empty(); }
+
+  inline Element& operator()(size_t row, size_t col) { return m_data[row * m_cols + col]; }
+  inline const Element& operator()(size_t row, size_t col) const { return m_data[row * m_cols + col]; }
+
+  inline std::span<Element> row(size_t row) { return {m_data.data() + row * m_cols, m_cols}; }
+  inline std::span<const Element> row(size_t row) const { return {m_data.data() + row * m_cols, m_cols}; }
+
+  inline Element* data() { return m_data.data(); }
+  inline const Element* data() const { return m_data.data(); }
+  inline std::span<Element> values() { return m_data; }
+  inline std::span<const Element> values() const { return m_data; }
+
+  void resize(size_t rows, size_t cols, Element value = Element())
+  {
+    m_rows = rows;
+    m_cols = cols;
+    m_data.assign(rows * cols, value);
+  }
+
+  std::vector<std::vector<T>> toVectors() const
+  {
+    std::vector<std::vector<T>> rows(m_rows);
+    for (size_t i = 0; i < m_rows; ++i)
+      rows[i].assign(row(i).begin(), row(i).end());
+    return rows;
+  }
+
+  inline bool operator==(const Matrix& other) const = default;
+
+private:
+  size_t m_rows;
+  size_t m_cols;
+  std::vector<Element> m_data;
+};
+
+} // namespace Sdx
+
+// Matrix specialization, a JSON array of arrays of the same size
+template<typename T>
+struct parse_json<Sdx::Matrix<T>>
+{
+  static bool is_valid(const rapidjson::Value& value)
+  {
+    if (!value.IsArray())
+      return false;
+    const rapidjson::SizeType cols = value.Empty() ? 0 : (value[0].IsArray() ? value[0].Size() : 0);
+    for (const rapidjson::Value& row : value.GetArray())
+    {
+      if (!row.IsArray() || row.Size() != cols)
+        return false;
+      for (const rapidjson::Value& element : row.GetArray())
+        if (!parse_json<T>::is_valid(element))
+          return false;
+    }
+    return true;
+  }
+
+  static std::optional<Sdx::Matrix<T>> try_parse(const rapidjson::Value& value)
+  {
+    if (!value.IsArray())
+      return std::nullopt;
+    const rapidjson::SizeType cols = value.Empty() ? 0 : (value[0].IsArray() ? value[0].Size() : 0);
+
+    Sdx::Matrix<T> sent(value.Size(), cols);
+    typename Sdx::Matrix<T>::Element* element = sent.data();
+    for (const rapidjson::Value& row : value.GetArray())
+    {
+      if (!row.IsArray() || row.Size() != cols)
+        return std::nullopt;
+      for (const rapidjson::Value& v : row.GetArray())
+      {
+        std::optional<T> parsed = try_parse_json<T>(v);
+        if (!parsed)
+          return std::nullopt;
+        *element++ = *parsed;
+      }
+    }
+    return sent;
+  }
+
+  static Sdx::Matrix<T> parse(const rapidjson::Value& value)
+  {
+    std::optional<Sdx::Matrix<T>> sent = try_parse(value);
+    if (!sent)
+      throw std::runtime_error("Unexpected value");
+    return std::move(*sent);
+  }
+
+  static rapidjson::Value format(const Sdx::Matrix<T>& value, rapidjson::Value::AllocatorType& alloc)
+  {
+    rapidjson::Value sent(rapidjson::kArrayType);
+    sent.Reserve(static_cast<rapidjson::SizeType>(value.rows()), alloc);
+    for (size_t i = 0; i < value.rows(); ++i)
+    {
+      rapidjson::Value row(rapidjson::kArrayType);
+      row.Reserve(static_cast<rapidjson::SizeType>(value.cols()), alloc);
+      for (const auto& v : value.row(i))
+        row.PushBack(parse_json<T>::format(static_cast<T>(v), alloc), alloc);
+      sent.PushBack(row, alloc);
+    }
+    return sent;
+  }
+};
+
+#endif // MATRIX_H
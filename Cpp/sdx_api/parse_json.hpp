@@ -5,17 +5,52 @@
 #include <map>
 #include <optional>
 #include <stdexcept>
+#include <string>
+#include <utility>
 #include <vector>
 
 template<typename T>
 struct parse_json;
 
+// Validates and converts in a single traversal, std::nullopt if the value is not valid. Uses parse_json<T>::try_parse
+// when the specialization has one, is_valid followed by parse otherwise.
+template<typename T>
+std::optional<T> try_parse_json(const rapidjson::Value& value)
+{
+  if constexpr (requires { parse_json<T>::try_parse(value); })
+    return parse_json<T>::try_parse(value);
+  else
+  {
+    if (!parse_json<T>::is_valid(value))
+      return std::nullopt;
+    return parse_json<T>::parse(value);
+  }
+}
+
+// Same as above, the converted value being written to out. Returns false if the value is not valid.
+template<typename T>
+bool try_parse_json(const rapidjson::Value& value, T& out)
+{
+  std::optional<T> parsed = try_parse_json<T>(value);
+  if (!parsed)
+    return false;
+  out = std::move(*parsed);
+  return true;
+}
+
 // bool specialization
 template<>
 struct parse_json<bool>
 {
   static bool is_valid(const rapidjson::Value& value) { return value.IsBool(); }
 
+  static std::optional<bool> try_parse(const rapidjson::Value& value)
+  {
+    if (!is_valid(value))
+      return std::nullopt;
+    return value.GetBool();
+  }
+
   static bool parse(const rapidjson::Value& value)
   {
     if (!is_valid(value))
@@ -32,6 +67,13 @@ struct parse_json<int>
 {
   static bool is_valid(const rapidjson::Value& value) { return value.IsInt() || value.IsDouble(); }
 
+  static std::optional<int> try_parse(const rapidjson::Value& value)
+  {
+    if (!is_valid(value))
+      return std::nullopt;
+    return value.GetInt();
+  }
+
   static int parse(const rapidjson::Value& value)
   {
     if (!is_valid(value))
@@ -51,6 +93,13 @@ struct parse_json<double>
     return value.IsDouble() || value.IsInt64() || value.IsUint64();
   }
 
+  static std::optional<double> try_parse(const rapidjson::Value& value)
+  {
+    if (!is_valid(value))
+      return std::nullopt;
+    return value.GetDouble();
+  }
+
   static double parse(const rapidjson::Value& value)
   {
     if (!is_valid(value))
@@ -67,6 +116,13 @@ struct parse_json<std::string>
 {
   static bool is_valid(const rapidjson::Value& value) { return value.IsString(); }
 
+  static std::optional<std::string> try_parse(const rapidjson::Value& value)
+  {
+    if (!is_valid(value))
+      return std::nullopt;
+    return std::string(value.GetString(), value.GetStringLength());
+  }
+
   static std::string parse(const rapidjson::Value& value)
   {
     if (!is_valid(value))
@@ -94,17 +150,31 @@ struct parse_json<std::vector<T>>
     return true;
   }
 
-  static std::vector<T> parse(const rapidjson::Value& value)
+  static std::optional<std::vector<T>> try_parse(const rapidjson::Value& value)
   {
-    std::vector<T> sent;
+    if (!value.IsArray())
+      return std::nullopt;
 
-    if (!is_valid(value))
-      throw std::runtime_error("Unexpected value");
+    std::vector<T> sent;
+    sent.reserve(value.Size());
     for (rapidjson::Value::ConstValueIterator itr = value.Begin(); itr != value.End(); ++itr)
-      sent.push_back(std::move(parse_json<T>::parse(*itr)));
+    {
+      std::optional<T> element = try_parse_json<T>(*itr);
+      if (!element)
+        return std::nullopt;
+      sent.push_back(std::move(*element));
+    }
     return sent;
   }
 
+  static std::vector<T> parse(const rapidjson::Value& value)
+  {
+    std::optional<std::vector<T>> sent = try_parse(value);
+    if (!sent)
+      throw std::runtime_error("Unexpected value");
+    return std::move(*sent);
+  }
+
   static rapidjson::Value format(const std::vector<T>& value, rapidjson::Value::AllocatorType& alloc)
   {
     rapidjson::Value sent;
@@ -139,21 +209,36 @@ struct parse_json<std::map<std::string, TValue>>
     return true;
   }
 
-  static std::map<std::string, TValue> parse(const rapidjson::Value& value)
+  static std::optional<std::map<std::string, TValue>> try_parse(const rapidjson::Value& value)
   {
-    if (!is_valid(value))
-      throw std::runtime_error("Unexpected value");
+    if (!value.IsObject())
+    {
+      return std::nullopt;
+    }
 
     std::map<std::string, TValue> sent;
 
     for (rapidjson::Value::ConstMemberIterator itr = value.MemberBegin(); itr != value.MemberEnd(); ++itr)
     {
-      sent.emplace(itr->name.GetString(), parse_json<TValue>::parse(itr->value));
+      std::optional<TValue> element = try_parse_json<TValue>(itr->value);
+      if (!itr->name.IsString() || !element)
+      {
+        return std::nullopt;
+      }
+      sent.emplace(std::string(itr->name.GetString(), itr->name.GetStringLength()), std::move(*element));
     }
 
     return sent;
   }
 
+  static std::map<std::string, TValue> parse(const rapidjson::Value& value)
+  {
+    std::optional<std::map<std::string, TValue>> sent = try_parse(value);
+    if (!sent)
+      throw std::runtime_error("Unexpected value");
+    return std::move(*sent);
+  }
+
   static rapidjson::Value format(const std::map<std::string, TValue>& map, rapidjson::Value::AllocatorType& alloc)
   {
     rapidjson::Value sent(rapidjson::kObjectType);
@@ -174,6 +259,16 @@ struct parse_json<std::optional<T>>
 {
   static bool is_valid(const rapidjson::Value& value) { return value.IsNull() || parse_json<T>::is_valid(value); }
 
+  static std::optional<std::optional<T>> try_parse(const rapidjson::Value& value)
+  {
+    if (value.IsNull())
+      return std::make_optional(std::optional<T>());
+    std::optional<T> sent = try_parse_json<T>(value);
+    if (!sent)
+      return std::nullopt;
+    return std::make_optional(std::move(sent));
+  }
+
   static std::optional<T> parse(const rapidjson::Value& value)
   {
     if (value.IsNull())
@@ -0,0 +1,203 @@
+#include "precision_policy.h"
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace Sdx
+{
+
+namespace
+{
+// Largest magnitude a scaled value can have while being an exact integer in a double
+constexpr double MaxScaled = 9007199254740992.0; // 2^53
+
+constexpr double Pow10[PrecisionPolicy::MaxDecimals + 1] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15};
+
+// rapidjson Writer writing the doubles with the decimals of the policy. The Accept functions are templates on the
+// handler, so the functions below replace the Writer ones without being virtual.
+template<typename OutputStream>
+class PrecisionWriter : public rapidjson::Writer<OutputStream>
+{
+  using Base = rapidjson::Writer<OutputStream>;
+
+public:
+  PrecisionWriter(OutputStream& os, const PrecisionPolicy& policy) : Base(os), m_policy(policy) {}
+
+  bool Key(const char* str, rapidjson::SizeType length, bool copy = false)
+  {
+    m_key = std::string_view(str, length);
+    return Base::Key(str, length, copy);
+  }
+
+  bool StartObject()
+  {
+    enter();
+    return Base::StartObject();
+  }
+
+  bool EndObject(rapidjson::SizeType memberCount = 0)
+  {
+    leave();
+    return Base::EndObject(memberCount);
+  }
+
+  bool StartArray()
+  {
+    enter();
+    return Base::StartArray();
+  }
+
+  bool EndArray(rapidjson::SizeType elementCount = 0)
+  {
+    leave();
+    return Base::EndArray(elementCount);
+  }
+
+  bool Double(double d)
+  {
+    const int decimals = fieldDecimals();
+    if (decimals < 0)
+      return Base::Double(d);
+
+    char buffer[PrecisionPolicy::FormatBufferSize];
+    const size_t length = PrecisionPolicy::formatDouble(d, decimals, buffer);
+    if (length == 0)
+      return Base::Double(d);
+    return Base::RawValue(buffer, length, rapidjson::kNumberType);
+  }
+
+private:
+  // The member holding the container becomes one of its enclosing fields, the elements of an array have no key
+  void enter()
+  {
+    m_fields.push_back(m_key);
+    m_key = std::string_view();
+  }
+
+  void leave()
+  {
+    m_key = m_fields.back();
+    m_fields.pop_back();
+  }
+
+  int fieldDecimals() const
+  {
+    if (!m_key.empty())
+    {
+      if (int decimals = m_policy.decimals(m_key); decimals >= 0)
+        return decimals;
+    }
+    for (auto field = m_fields.rbegin(); field != m_fields.rend(); ++field)
+    {
+      if (field->empty())
+        continue;
+      if (int decimals = m_policy.decimals(*field); decimals >= 0)
+        return decimals;
+    }
+    return m_policy.defaultDecimals();
+  }
+
+  const PrecisionPolicy& m_policy;
+  std::string_view m_key;
+  std::vector<std::string_view> m_fields;
+};
+
+char* writeDigits(uint64_t value, char* out)
+{
+  char digits[20];
+  int count = 0;
+  do
+  {
+    digits[count++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  while (count > 0)
+    *out++ = digits[--count];
+  return out;
+}
+} // namespace
+
+void PrecisionPolicy::setDecimals(const std::string& field, int decimals)
+{
+  if (decimals < 0 || decimals > MaxDecimals)
+    throw std::runtime_error("Decimals must be between 0 and " + std::to_string(MaxDecimals));
+  m_decimals[field] = decimals;
+}
+
+void PrecisionPolicy::removeDecimals(const std::string& field)
+{
+  m_decimals.erase(field);
+}
+
+void PrecisionPolicy::setDefaultDecimals(int decimals)
+{
+  if (decimals > MaxDecimals)
+    throw std::runtime_error("Decimals must be between 0 and " + std::to_string(MaxDecimals));
+  m_defaultDecimals = decimals < 0 ? -1 : decimals;
+}
+
+void PrecisionPolicy::clear()
+{
+  m_decimals.clear();
+  m_defaultDecimals = -1;
+}
+
+int PrecisionPolicy::decimals(std::string_view field) const
+{
+  auto it = m_decimals.find(field);
+  return it == m_decimals.end() ? -1 : it->second;
+}
+
+std::string PrecisionPolicy::write(const rapidjson::Value& value) const
+{
+  rapidjson::StringBuffer buffer;
+  PrecisionWriter<rapidjson::StringBuffer> writer(buffer, *this);
+  value.Accept(writer);
+  return std::string(buffer.GetString(), buffer.GetSize());
+}
+
+size_t PrecisionPolicy::formatDouble(double value, int decimals, char* buffer)
+{
+  if (decimals < 0 || decimals > MaxDecimals)
+    return 0;
+  const double scaled = std::round(value * Pow10[decimals]);
+  if (!(std::fabs(scaled) < MaxScaled))
+    return 0; // NaN and infinites included
+
+  char* out = buffer;
+  int64_t rounded = static_cast<int64_t>(scaled);
+  if (rounded < 0)
+  {
+    *out++ = '-';
+    rounded = -rounded;
+  }
+  const uint64_t scale = static_cast<uint64_t>(Pow10[decimals]);
+  out = writeDigits(static_cast<uint64_t>(rounded) / scale, out);
+  *out++ = '.';
+
+  // Fraction digits without the trailing zeros, at least one digit so the value is still read as a double
+  uint64_t fraction = static_cast<uint64_t>(rounded) % scale;
+  int digits = decimals;
+  while (digits > 1 && fraction % 10 == 0)
+  {
+    fraction /= 10;
+    --digits;
+  }
+  for (int i = digits - 1; i >= 0; --i)
+  {
+    out[i] = static_cast<char>('0' + fraction % 10);
+    fraction /= 10;
+  }
+  out += digits == 0 ? 1 : digits;
+  if (digits == 0)
+    out[-1] = '0';
+  return static_cast<size_t>(out - buffer);
+}
+
+} // namespace Sdx
@@ -0,0 +1,55 @@
+#ifndef PRECISION_POLICY_H
+#define PRECISION_POLICY_H
+
+#include <rapidjson/document.h>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+
+namespace Sdx
+{
+
+// Number of decimals written for the doubles of the commands sent, per field name, instead of the shortest round trip
+// representation (up to 17 significant digits). 3 decimals for "X", "Y" and "Z" keeps ECEF positions within half a
+// millimetre, 2 decimals for "Gain" keeps antenna gains within 0.005 dB.
+//
+// A double is looked up by the name of its innermost enclosing member having a rule: "X" in {"Position": {"X": 1.0}},
+// "Gain" for every cell of a "Gain" matrix. The values are rounded to the nearest and written with a fixed point
+// formatter, trailing zeros removed. Doubles without a rule, or too large to be scaled exactly, are written unchanged.
+class PrecisionPolicy
+{
+public:
+  static constexpr int MaxDecimals = 15;
+  static constexpr size_t FormatBufferSize = 40;
+
+  // Throws std::runtime_error if decimals is not in [0, MaxDecimals]
+  void setDecimals(const std::string& field, int decimals);
+  void removeDecimals(const std::string& field);
+  // Decimals of the doubles matching no rule, -1 for the shortest round trip representation (default)
+  void setDefaultDecimals(int decimals);
+  void clear();
+
+  // -1 if the field has no rule
+  int decimals(std::string_view field) const;
+  inline int defaultDecimals() const { return m_defaultDecimals; }
+  inline bool isEmpty() const { return m_decimals.empty() && m_defaultDecimals < 0; }
+  bool operator==(const PrecisionPolicy& other) const = default;
+
+  // Compact JSON of value with the policy applied
+  std::string write(const rapidjson::Value& value) const;
+
+  // Writes value rounded to decimals in buffer (FormatBufferSize characters) without a terminating null.
+  // Returns the number of characters written, 0 if value can't be scaled exactly.
+  static size_t formatDouble(double value, int decimals, char* buffer);
+
+private:
+  std::map<std::string, int, std::less<>> m_decimals;
+  int m_defaultDecimals = -1;
+};
+
+} // namespace Sdx
+
+#endif // PRECISION_POLICY_H
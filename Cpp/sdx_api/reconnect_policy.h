@@ -0,0 +1,36 @@
+#ifndef RECONNECT_POLICY_H
+#define RECONNECT_POLICY_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace Sdx
+{
+
+// How RemoteSimulator restores a lost connection: up to maxAttempts connections, the first one right away and the
+// next ones after an exponential backoff delay (initialDelay, initialDelay * backoffFactor... capped to maxDelay).
+// Disabled by default.
+struct ReconnectPolicy
+{
+  int maxAttempts = 0;
+  std::chrono::milliseconds initialDelay {500};
+  std::chrono::milliseconds maxDelay {30000};
+  double backoffFactor = 2.0;
+
+  inline bool isEnabled() const { return maxAttempts > 0; }
+
+  // Delay before the given attempt, 0 for the first one
+  inline std::chrono::milliseconds delay(int attempt) const
+  {
+    if (attempt <= 0)
+      return std::chrono::milliseconds(0);
+    const double delay = static_cast<double>(initialDelay.count()) * std::pow(backoffFactor, attempt - 1);
+    return std::chrono::milliseconds(
+      static_cast<std::chrono::milliseconds::rep>(std::min(delay, static_cast<double>(maxDelay.count()))));
+  }
+};
+
+} // namespace Sdx
+
+#endif // RECONNECT_POLICY_H
@@ -1,19 +1,69 @@
 #include "remote_simulator.h"
 
+#include <algorithm>
+#include <chrono>
 #include <exception>
+#include <future>
 #include <iostream>
 #include <sstream>
+#include <thread>
 
 #include "all_commands.h"
 #include "attitude.h"
 #include "cmd_client.h"
+#include "command_blob.h"
+#include "command_dispatcher.h"
 #include "command_exception.h"
+#include "command_template.h"
 #include "ecef.h"
 #include "hil_client.h"
 #include "lla.h"
+#include "trace_recorder.h"
 
 using namespace Sdx;
 
+namespace
+{
+// Longest wait for the result of a cancelled WaitSimulatorState once aborted, the simulator may be hung
+constexpr std::chrono::milliseconds AbortedWaitGracePeriod(2000);
+
+// Limits the waits of the client for the lifetime of the scope
+class WaitLimitsScope
+{
+public:
+  WaitLimitsScope(CmdClient* client, std::chrono::steady_clock::time_point deadline, const CancellationToken* token) :
+    m_client(client)
+  {
+    if (m_client)
+      m_client->setWaitLimits(deadline, token);
+  }
+
+  ~WaitLimitsScope()
+  {
+    if (m_client)
+      m_client->setWaitLimits(std::chrono::steady_clock::time_point::max(), nullptr);
+  }
+
+private:
+  CmdClient* m_client;
+};
+
+// time_point::max() without timeout
+std::chrono::steady_clock::time_point deadlineAfter(std::chrono::milliseconds timeout)
+{
+  return timeout.count() > 0 ? std::chrono::steady_clock::now() + timeout : std::chrono::steady_clock::time_point::max();
+}
+
+CommandResultPtr futureResult(const std::shared_future<CommandResultPtr>& future,
+                              std::chrono::steady_clock::time_point deadline)
+{
+  if (deadline != std::chrono::steady_clock::time_point::max() &&
+      future.wait_until(deadline) != std::future_status::ready)
+    throw std::runtime_error("Timed out waiting for command result.");
+  return future.get();
+}
+} // namespace
+
 RemoteSimulator::RemoteSimulator(bool exceptionOnError) :
   m_exceptionOnError(exceptionOnError),
   m_client(0),
@@ -22,7 +72,14 @@ RemoteSimulator::RemoteSimulator(bool exceptionOnError) :
   m_hilStreamingCheckEnabled(true),
   m_beginTrack(false),
   m_beginRoute(false),
-  m_serverApiVersion(0)
+  m_connectId(0),
+  m_failIfApiVersionMismatch(false),
+  m_reconnecting(false),
+  m_defaultTimeout(0),
+  m_serverApiVersion(0),
+  m_streamRecorder(0),
+  m_threadSafe(false),
+  m_dispatcher(0)
 {
   resetTime();
 }
@@ -48,13 +105,22 @@ bool RemoteSimulator::connect(const std::string& ip, int id, bool failIfApiVersi
     return false;
   }
 
+  m_connectIp = ip;
+  m_connectId = id;
+  m_failIfApiVersionMismatch = failIfApiVersionMismatch;
+
   int port = 4820 + id;
   if (isVerbose())
     std::cout << "Connecting to " << ip << " port on " << port << "..." << std::endl;
 
+  m_resultCache.clear();
+  m_shadowState.clear();
   delete m_client;
   m_client = new CmdClient(m_exceptionOnError);
   m_client->setVerbose(m_verbose);
+  m_client->setLatencyStats(&m_latencyStats);
+  m_client->setStreamRecorder(m_streamRecorder);
+  m_client->setPrecisionPolicy(serializationPolicy());
   if (!m_client->connectToHost(ip, port))
   {
     delete m_client;
@@ -84,6 +150,7 @@ bool RemoteSimulator::connect(const std::string& ip, int id, bool failIfApiVersi
   delete m_hil;
   m_hil = new HilClient(m_exceptionOnError);
   m_hil->setVerbose(m_verbose);
+  m_hil->setStreamRecorder(m_streamRecorder);
   if (!m_hil->connectToHost(m_client->address(), hilPort))
   {
     delete m_client;
@@ -93,6 +160,8 @@ bool RemoteSimulator::connect(const std::string& ip, int id, bool failIfApiVersi
     return false;
   }
 
+  if (m_threadSafe)
+    m_dispatcher = new CommandDispatcher(*m_client);
   return true;
 }
 
@@ -100,10 +169,14 @@ void RemoteSimulator::disconnect()
 {
   if (isVerbose())
     std::cout << "Commands Client Disconnecting" << std::endl;
+  delete m_dispatcher;
+  m_dispatcher = 0;
   delete m_client;
   m_client = 0;
   delete m_hil;
   m_hil = 0;
+  m_resultCache.clear();
+  m_shadowState.clear();
 }
 
 bool RemoteSimulator::isConnected() const
@@ -111,6 +184,73 @@ bool RemoteSimulator::isConnected() const
   return m_client && m_client->isConnected();
 }
 
+bool RemoteSimulator::reconnect()
+{
+  if (m_connectIp.empty())
+  {
+    errorMessage("Cannot reconnect. Connect first.");
+    return false;
+  }
+
+  m_reconnecting = true;
+  const int attempts = std::max(m_reconnectPolicy.maxAttempts, 1);
+  bool connected = false;
+  std::string error;
+  for (int attempt = 0; attempt < attempts && !connected; ++attempt)
+  {
+    std::this_thread::sleep_for(m_reconnectPolicy.delay(attempt));
+    if (isVerbose())
+      std::cout << "Reconnection attempt " << attempt + 1 << " of " << attempts << std::endl;
+
+    try
+    {
+      disconnect();
+      connected = connect(m_connectIp, m_connectId, m_failIfApiVersionMismatch);
+      for (size_t i = 0; connected && i < m_volatileSettings.size(); ++i)
+      {
+        m_volatileSettings[i]->renew();
+        callCommand(m_volatileSettings[i]);
+        connected = isConnected();
+      }
+    }
+    catch (const std::exception& e)
+    {
+      connected = false;
+      error = e.what();
+    }
+  }
+  m_reconnecting = false;
+
+  if (!connected)
+  {
+    errorMessage("Unable to reconnect to " + m_connectIp + " after " + std::to_string(attempts) + " attempts." +
+                 (error.empty() ? "" : " Last error: " + error));
+    return false;
+  }
+  return true;
+}
+
+void RemoteSimulator::setReconnectPolicy(const ReconnectPolicy& policy)
+{
+  m_reconnectPolicy = policy;
+}
+
+void RemoteSimulator::addVolatileSetting(CommandBasePtr cmd)
+{
+  m_volatileSettings.push_back(cmd);
+}
+
+void RemoteSimulator::clearVolatileSettings()
+{
+  m_volatileSettings.clear();
+}
+
+void RemoteSimulator::restoreConnection()
+{
+  if (m_client && !m_client->isConnected() && !m_dispatcher && !m_reconnecting && m_reconnectPolicy.isEnabled())
+    reconnect();
+}
+
 int RemoteSimulator::clientApiVersion()
 {
   return Cmd::COMMANDS_API_VERSION;
@@ -138,6 +278,7 @@ void RemoteSimulator::errorMessage(const std::string& msg)
 
 void RemoteSimulator::setDeprecatedMessageMode(DeprecatedMessageMode mode)
 {
+  std::lock_guard<std::mutex> lock(m_deprecatedMutex);
   m_deprecatedMessageMode = mode;
   m_latchDeprecated.clear();
 }
@@ -145,9 +286,12 @@ void RemoteSimulator::setDeprecatedMessageMode(DeprecatedMessageMode mode)
 void RemoteSimulator::deprecatedMessage(CommandBasePtr cmd)
 {
   auto deprecated = cmd->deprecated();
-  if (deprecated && (m_deprecatedMessageMode == DeprecatedMessageMode::ALL ||
-                     (m_deprecatedMessageMode == DeprecatedMessageMode::LATCH &&
-                      m_latchDeprecated.find(cmd->name()) == m_latchDeprecated.end())))
+  if (!deprecated)
+    return;
+  std::lock_guard<std::mutex> lock(m_deprecatedMutex);
+  if (m_deprecatedMessageMode == DeprecatedMessageMode::ALL ||
+      (m_deprecatedMessageMode == DeprecatedMessageMode::LATCH &&
+       m_latchDeprecated.find(cmd->name()) == m_latchDeprecated.end()))
   {
     std::cout << "Warning: " << *deprecated << std::endl;
     m_latchDeprecated.insert(cmd->name());
@@ -178,6 +322,78 @@ bool RemoteSimulator::isHilStreamingCheckEnabled()
   return m_hilStreamingCheckEnabled;
 }
 
+void RemoteSimulator::setLatencyStatsEnabled(bool enabled)
+{
+  m_latencyStats.setEnabled(enabled);
+}
+
+bool RemoteSimulator::isLatencyStatsEnabled() const
+{
+  return m_latencyStats.isEnabled();
+}
+
+void RemoteSimulator::setThreadSafe(bool threadSafe)
+{
+  if (threadSafe != m_threadSafe && isConnected())
+  {
+    errorMessage("Cannot change the thread safe mode while connected. Disconnect first.");
+    return;
+  }
+  m_threadSafe = threadSafe;
+}
+
+void RemoteSimulator::setDefaultTimeout(std::chrono::milliseconds timeout)
+{
+  m_defaultTimeout = timeout;
+}
+
+bool RemoteSimulator::isThreadSafe() const
+{
+  return m_threadSafe;
+}
+
+void RemoteSimulator::setResultCacheEnabled(bool enabled)
+{
+  m_resultCache.setEnabled(enabled);
+}
+
+bool RemoteSimulator::isResultCacheEnabled() const
+{
+  return m_resultCache.isEnabled();
+}
+
+void RemoteSimulator::setShadowStateEnabled(bool enabled)
+{
+  m_shadowState.setEnabled(enabled);
+}
+
+bool RemoteSimulator::isShadowStateEnabled() const
+{
+  return m_shadowState.isEnabled();
+}
+
+void RemoteSimulator::setStreamRecorder(StreamRecorder* recorder)
+{
+  m_streamRecorder = recorder;
+  if (m_client)
+    m_client->setStreamRecorder(recorder);
+  if (m_hil)
+    m_hil->setStreamRecorder(recorder);
+}
+
+void RemoteSimulator::setPrecisionPolicy(const PrecisionPolicy& policy)
+{
+  if (m_dispatcher)
+  {
+    errorMessage("Cannot change the precision policy while connected in thread safe mode. Disconnect first.");
+    return;
+  }
+  m_precisionPolicy = policy;
+  m_pushTemplates.clear();
+  if (m_client)
+    m_client->setPrecisionPolicy(serializationPolicy());
+}
+
 bool RemoteSimulator::arm()
 {
   if (isVerbose())
@@ -298,15 +514,28 @@ bool RemoteSimulator::checkIfStreaming()
 }
 
 bool RemoteSimulator::waitState(const std::string& state, const std::string& failureState)
+{
+  return waitState(state, failureState, m_defaultTimeout, nullptr);
+}
+
+bool RemoteSimulator::waitState(const std::string& state,
+                                const std::string& failureState,
+                                std::chrono::milliseconds timeout,
+                                const CancellationToken* token)
 {
   if (isVerbose())
     std::cout << "Waiting for simulator state " << std::endl;
 
+  CommandBasePtr cmd = postCommand(Cmd::WaitSimulatorState::create(state, failureState));
   Cmd::SimulatorStateResultPtr stateResult = Cmd::SimulatorStateResult::dynamicCast(
-    callCommand(Cmd::WaitSimulatorState::create(state, failureState)));
+    waitCommand(cmd, timeout, token));
 
   std::string errorMsg;
-  if (stateResult->state() == state)
+  if (!stateResult)
+  {
+    errorMsg = "Wait for simulator state " + state + " aborted.";
+  }
+  else if (stateResult->state() == state)
   {
     if (isVerbose())
       std::cout << "Simulator state is now to " << state << std::endl;
@@ -337,6 +566,7 @@ bool RemoteSimulator::hilCheck(double elapsedTime)
   if (elapsedTime - m_checkRunningTime >= 1000)
   {
     m_checkRunningTime = elapsedTime;
+    TraceScope trace("sim", "hilCheck");
     if (m_hilStreamingCheckEnabled && !checkIfStreaming())
     {
       resetTime();
@@ -515,15 +745,52 @@ void RemoteSimulator::pushTrackEcef(int elapsedTime, const Ecef& ecef)
 {
   if (!m_beginTrack)
     throw std::runtime_error("You must call beginTrackDefinition first.");
-  postCommand(Cmd::PushTrackEcef::create(elapsedTime, ecef.x, ecef.y, ecef.z));
+
+  CommandTemplate* push = pushTemplate(
+    "PushTrackEcef",
+    [] { return CommandBasePtr(Cmd::PushTrackEcef::create(0, 0.0, 0.0, 0.0)); },
+    {"Time", "X", "Y", "Z"});
+  if (!push)
+  {
+    postCommand(Cmd::PushTrackEcef::create(elapsedTime, ecef.x, ecef.y, ecef.z));
+    return;
+  }
+  push->setInt(0, elapsedTime);
+  push->setDouble(1, ecef.x);
+  push->setDouble(2, ecef.y);
+  push->setDouble(3, ecef.z);
+  postTemplate(*push);
+}
+
+void RemoteSimulator::pushTrackEcef(std::span<const TrackNode> nodes)
+{
+  for (const TrackNode& node : nodes)
+    pushTrackEcef(node.elapsedTime, node.position);
 }
 
 void RemoteSimulator::pushTrackEcefNed(int elapsedTime, const Ecef& ecef, const Attitude& attitude)
 {
   if (!m_beginTrack)
     throw std::runtime_error("You must call beginTrackDefinition first.");
-  postCommand(
-    Cmd::PushTrackEcefNed::create(elapsedTime, ecef.x, ecef.y, ecef.z, attitude.yaw, attitude.pitch, attitude.roll));
+
+  CommandTemplate* push = pushTemplate(
+    "PushTrackEcefNed",
+    [] { return CommandBasePtr(Cmd::PushTrackEcefNed::create(0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0)); },
+    {"Time", "X", "Y", "Z", "Yaw", "Pitch", "Roll"});
+  if (!push)
+  {
+    postCommand(
+      Cmd::PushTrackEcefNed::create(elapsedTime, ecef.x, ecef.y, ecef.z, attitude.yaw, attitude.pitch, attitude.roll));
+    return;
+  }
+  push->setInt(0, elapsedTime);
+  push->setDouble(1, ecef.x);
+  push->setDouble(2, ecef.y);
+  push->setDouble(3, ecef.z);
+  push->setDouble(4, attitude.yaw);
+  push->setDouble(5, attitude.pitch);
+  push->setDouble(6, attitude.roll);
+  postTemplate(*push);
 }
 
 void RemoteSimulator::pushTrackLla(int elapsedTime, const Lla& lla)
@@ -575,7 +842,20 @@ void RemoteSimulator::pushRouteEcef(double speed, const Ecef& ecef)
   if (speed <= 0)
     throw std::runtime_error("A route node must have a speed limit greater than zero.");
 
-  postCommand(Cmd::PushRouteEcef::create(speed, ecef.x, ecef.y, ecef.z));
+  CommandTemplate* push = pushTemplate(
+    "PushRouteEcef",
+    [] { return CommandBasePtr(Cmd::PushRouteEcef::create(0.0, 0.0, 0.0, 0.0)); },
+    {"Speed", "X", "Y", "Z"});
+  if (!push)
+  {
+    postCommand(Cmd::PushRouteEcef::create(speed, ecef.x, ecef.y, ecef.z));
+    return;
+  }
+  push->setDouble(0, speed);
+  push->setDouble(1, ecef.x);
+  push->setDouble(2, ecef.y);
+  push->setDouble(3, ecef.z);
+  postTemplate(*push);
 }
 
 void RemoteSimulator::pushRouteLla(double speed, const Lla& lla)
@@ -621,7 +901,20 @@ void RemoteSimulator::pushIntTxTrackEcef(int elapsedTime, const Ecef& ecef, cons
   if (m_beginIntTxTrack.find(id) == m_beginIntTxTrack.end())
     throw std::runtime_error("You must call beginIntTxTrackDefinition first.");
 
-  postCommand(Cmd::PushIntTxTrackEcef::create(elapsedTime, ecef.x, ecef.y, ecef.z, id));
+  CommandTemplate* push = pushTemplate(
+    "PushIntTxTrackEcef " + id,
+    [&id] { return CommandBasePtr(Cmd::PushIntTxTrackEcef::create(0, 0.0, 0.0, 0.0, id)); },
+    {"Time", "X", "Y", "Z"});
+  if (!push)
+  {
+    postCommand(Cmd::PushIntTxTrackEcef::create(elapsedTime, ecef.x, ecef.y, ecef.z, id));
+    return;
+  }
+  push->setInt(0, elapsedTime);
+  push->setDouble(1, ecef.x);
+  push->setDouble(2, ecef.y);
+  push->setDouble(3, ecef.z);
+  postTemplate(*push);
 }
 
 void RemoteSimulator::pushIntTxTrackEcefNed(int elapsedTime,
@@ -632,14 +925,30 @@ void RemoteSimulator::pushIntTxTrackEcefNed(int elapsedTime,
   if (m_beginIntTxTrack.find(id) == m_beginIntTxTrack.end())
     throw std::runtime_error("You must call beginIntTxTrackDefinition first.");
 
-  postCommand(Cmd::PushIntTxTrackEcefNed::create(elapsedTime,
-                                                 ecef.x,
-                                                 ecef.y,
-                                                 ecef.z,
-                                                 attitude.yaw,
-                                                 attitude.pitch,
-                                                 attitude.roll,
-                                                 id));
+  CommandTemplate* push = pushTemplate(
+    "PushIntTxTrackEcefNed " + id,
+    [&id] { return CommandBasePtr(Cmd::PushIntTxTrackEcefNed::create(0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, id)); },
+    {"Time", "X", "Y", "Z", "Yaw", "Pitch", "Roll"});
+  if (!push)
+  {
+    postCommand(Cmd::PushIntTxTrackEcefNed::create(elapsedTime,
+                                                   ecef.x,
+                                                   ecef.y,
+                                                   ecef.z,
+                                                   attitude.yaw,
+                                                   attitude.pitch,
+                                                   attitude.roll,
+                                                   id));
+    return;
+  }
+  push->setInt(0, elapsedTime);
+  push->setDouble(1, ecef.x);
+  push->setDouble(2, ecef.y);
+  push->setDouble(3, ecef.z);
+  push->setDouble(4, attitude.yaw);
+  push->setDouble(5, attitude.pitch);
+  push->setDouble(6, attitude.roll);
+  postTemplate(*push);
 }
 
 void RemoteSimulator::pushIntTxTrackLla(int elapsedTime, const Lla& lla, const std::string& id)
@@ -665,6 +974,8 @@ CommandResultPtr RemoteSimulator::endIntTxTrackDefinition(int& numberOfNodesInTr
     throw std::runtime_error("You must call beginIntTxTrackDefinition first.");
 
   m_beginIntTxTrack.erase(id);
+  m_pushTemplates.erase("PushIntTxTrackEcef " + id);
+  m_pushTemplates.erase("PushIntTxTrackEcefNed " + id);
   CommandResultPtr result = callCommand(Cmd::EndIntTxTrackDefinition::create(id));
   if (result->isSuccess())
   {
@@ -698,6 +1009,112 @@ void RemoteSimulator::handleException(CommandResultPtr result)
     std::cout << result->relatedCommand()->name() << " failed: " << result->message() << std::endl;
 }
 
+void RemoteSimulator::checkBlob(const CommandBlob& blob)
+{
+  if (!isConnected())
+    throw std::runtime_error("Cannot send commands to simulator because you are not connected.");
+  for (size_t i = 0; i < blob.commandCount(); ++i)
+  {
+    if (blob.commandName(i) == "Start")
+      throw std::runtime_error("You cannot send a Start() command. Use RemoteSimulator.start() instead.");
+  }
+}
+
+void RemoteSimulator::postBlob(const CommandBlob& blob)
+{
+  restoreConnection();
+  checkBlob(blob);
+  if (isVerbose())
+    std::cout << "Post blob of " << blob.commandCount() << " commands" << std::endl;
+
+  TraceScope trace("sim", "postBlob");
+  if (m_dispatcher)
+    m_dispatcher->submit(blob);
+  else
+    m_client->sendRawMessage(blob.data(), static_cast<int>(blob.size()));
+  for (size_t i = 0; i < blob.commandCount(); ++i)
+  {
+    m_resultCache.sent(blob.commandName(i));
+    m_shadowState.sent(blob.commandName(i));
+  }
+}
+
+std::vector<CommandResultPtr> RemoteSimulator::callBlob(CommandBlob& blob)
+{
+  restoreConnection();
+  checkBlob(blob);
+  if (isVerbose())
+    std::cout << "Call blob of " << blob.commandCount() << " commands" << std::endl;
+
+  TraceScope trace("sim", "callBlob");
+  blob.renewUuids();
+  const std::chrono::steady_clock::time_point deadline = deadlineAfter(m_defaultTimeout);
+  std::vector<CommandResultPtr> results;
+  if (m_dispatcher)
+  {
+    for (const auto& future : m_dispatcher->submit(blob))
+      results.push_back(futureResult(future, deadline));
+  }
+  else
+  {
+    WaitLimitsScope limits(m_client, deadline, nullptr);
+    results = m_client->sendAndWaitCommands(blob.data(), blob.size(), blob.uuids());
+  }
+  for (size_t i = 0; i < blob.commandCount(); ++i)
+  {
+    m_resultCache.sent(blob.commandName(i));
+    m_shadowState.sent(blob.commandName(i));
+  }
+  for (const CommandResultPtr& result : results)
+    handleException(result);
+  return results;
+}
+
+std::vector<CommandResultPtr> RemoteSimulator::applyConfiguration(const std::vector<CommandBasePtr>& commands)
+{
+  const std::vector<CommandBasePtr> diff = m_shadowState.diff(commands);
+  if (isVerbose())
+    std::cout << "Apply configuration, " << commands.size() - diff.size() << " of " << commands.size()
+              << " commands already applied" << std::endl;
+  if (diff.empty())
+    return {};
+
+  CommandBlob blob(diff, serializationPolicy());
+  for (const CommandBasePtr& cmd : diff)
+    m_shadowState.sending(cmd);
+  std::vector<CommandResultPtr> results = callBlob(blob);
+  for (size_t i = 0; i < diff.size(); ++i)
+    m_shadowState.received(diff[i], results[i]);
+  return results;
+}
+
+CommandResultPtr RemoteSimulator::callStreaming(CommandBasePtr cmd,
+                                                const std::string& arrayField,
+                                                const std::function<void(const rapidjson::Value& element)>& onElement)
+{
+  if (m_dispatcher)
+  {
+    errorMessage("Cannot stream a result in thread safe mode.");
+    return nullptr;
+  }
+
+  checkForbiddenCall(cmd);
+  postCommand(cmd);
+  if (isVerbose())
+    std::cout << "Call " << cmd->toReadableCommand() << " (streaming " << arrayField << ")" << std::flush;
+
+  TraceScope trace("sim", "wait", cmd->name());
+  WaitLimitsScope limits(m_client, deadlineAfter(m_defaultTimeout), nullptr);
+  CommandResultPtr result = m_client->waitCommand(cmd, arrayField, onElement);
+  // Without its elements, the result must not be served from the cache
+  m_resultCache.received(cmd, nullptr);
+  m_shadowState.received(cmd, result);
+  if (isVerbose())
+    std::cout << " => " << result->message() << std::endl;
+  handleException(result);
+  return result;
+}
+
 CommandBasePtr RemoteSimulator::post(CommandBasePtr cmd, double timestamp)
 {
   checkForbiddenPost(cmd);
@@ -728,10 +1145,17 @@ CommandBasePtr RemoteSimulator::post(CommandBasePtr cmd)
 }
 
 CommandResultPtr RemoteSimulator::wait(CommandBasePtr cmd)
+{
+  return wait(cmd, m_defaultTimeout, nullptr);
+}
+
+CommandResultPtr RemoteSimulator::wait(CommandBasePtr cmd,
+                                       std::chrono::milliseconds timeout,
+                                       const CancellationToken* token)
 {
   if (isVerbose())
     std::cout << "Wait " << cmd->toReadableCommand() << std::flush;
-  CommandResultPtr result = waitCommand(cmd);
+  CommandResultPtr result = waitCommand(cmd, timeout, token);
   if (isVerbose())
     std::cout << " => " << result->message() << std::endl;
   return result;
@@ -764,12 +1188,31 @@ CommandResultPtr RemoteSimulator::call(CommandBasePtr cmd, const Sdx::DateTime&
 }
 
 CommandResultPtr RemoteSimulator::call(CommandBasePtr cmd)
+{
+  return call(cmd, m_defaultTimeout, nullptr);
+}
+
+CommandResultPtr RemoteSimulator::call(CommandBasePtr cmd,
+                                       std::chrono::milliseconds timeout,
+                                       const CancellationToken* token)
 {
   checkForbiddenCall(cmd);
+  if (m_shadowState.isApplied(cmd))
+  {
+    if (isVerbose())
+      std::cout << "Call " << cmd->toReadableCommand() << " => already applied" << std::endl;
+    return Cmd::SuccessResult::create(cmd);
+  }
+  if (CommandResultPtr cached = m_resultCache.find(cmd))
+  {
+    if (isVerbose())
+      std::cout << "Call " << cmd->toReadableCommand() << " => " << cached->message() << " (cached)" << std::endl;
+    return cached;
+  }
   postCommand(cmd);
   if (isVerbose())
     std::cout << "Call " << cmd->toReadableCommand() << std::flush;
-  CommandResultPtr result = waitCommand(cmd);
+  CommandResultPtr result = waitCommand(cmd, timeout, token);
   if (isVerbose())
     std::cout << " => " << result->message() << std::endl;
   return result;
@@ -777,34 +1220,124 @@ CommandResultPtr RemoteSimulator::call(CommandBasePtr cmd)
 
 CommandBasePtr RemoteSimulator::postCommand(CommandBasePtr cmd, double timestamp)
 {
+  TraceScope trace("sim", "post", cmd->name());
   deprecatedMessage(cmd);
   cmd->setTimestamp(timestamp);
-  m_client->sendCommand(cmd);
+  sendCommand(cmd);
   return cmd;
 }
 
 CommandBasePtr RemoteSimulator::postCommand(CommandBasePtr cmd, const Sdx::DateTime& gpsTimestamp)
 {
+  TraceScope trace("sim", "post", cmd->name());
   deprecatedMessage(cmd);
   cmd->setGpsTimestamp(gpsTimestamp);
-  m_client->sendCommand(cmd);
+  sendCommand(cmd);
   return cmd;
 }
 
 CommandBasePtr RemoteSimulator::postCommand(CommandBasePtr cmd)
 {
+  TraceScope trace("sim", "post", cmd->name());
   deprecatedMessage(cmd);
-  m_client->sendCommand(cmd);
+  sendCommand(cmd);
   return cmd;
 }
 
+void RemoteSimulator::sendCommand(CommandBasePtr cmd)
+{
+  restoreConnection();
+  if (!m_client)
+    throw std::runtime_error("Cannot send commands to simulator because you are not connected.");
+  m_resultCache.sending(cmd);
+  m_shadowState.sending(cmd);
+  if (m_dispatcher)
+    m_dispatcher->post(cmd);
+  else
+    m_client->sendCommand(cmd);
+  m_resultCache.sent(cmd->name());
+  m_shadowState.sent(cmd);
+}
+
+CommandTemplate* RemoteSimulator::pushTemplate(const std::string& key,
+                                              const std::function<CommandBasePtr()>& prototype,
+                                              std::initializer_list<const char*> slotFields)
+{
+  if (m_dispatcher)
+    return nullptr;
+
+  std::unique_ptr<CommandTemplate>& pushTemplate = m_pushTemplates[key];
+  if (!pushTemplate)
+  {
+    pushTemplate = std::make_unique<CommandTemplate>(prototype(),
+                                                     std::vector<std::string>(slotFields.begin(), slotFields.end()),
+                                                     serializationPolicy());
+  }
+  return pushTemplate.get();
+}
+
+void RemoteSimulator::postTemplate(CommandTemplate& commandTemplate)
+{
+  restoreConnection();
+  if (!m_client)
+    throw std::runtime_error("Cannot send commands to simulator because you are not connected.");
+  TraceScope trace("sim", "post", commandTemplate.name());
+  const std::string_view message = commandTemplate.render();
+  m_client->sendRawMessage(message.data(), static_cast<int>(message.size()));
+  m_resultCache.sent(commandTemplate.name());
+  m_shadowState.sent(commandTemplate.name());
+}
+
 CommandResultPtr RemoteSimulator::waitCommand(CommandBasePtr cmd)
 {
-  CommandResultPtr result = m_client->waitCommand(cmd);
+  return waitCommand(cmd, m_defaultTimeout, nullptr);
+}
+
+CommandResultPtr RemoteSimulator::waitCommand(CommandBasePtr cmd,
+                                              std::chrono::milliseconds timeout,
+                                              const CancellationToken* token)
+{
+  TraceScope trace("sim", "wait", cmd->name());
+  const std::chrono::steady_clock::time_point deadline = deadlineAfter(timeout);
+  CommandResultPtr result;
+  try
+  {
+    result = receiveResult(cmd, deadline, token);
+  }
+  catch (const std::runtime_error&)
+  {
+    // Left alone, the simulator would keep waiting for the state
+    if (cmd->name() != Cmd::WaitSimulatorState::CmdName || !isConnected())
+      throw;
+    postCommand(Cmd::AbortWaitSimulatorState::create());
+    if (!token || !token->isCancelled())
+      throw;
+    const std::exception_ptr cancelled = std::current_exception();
+    try
+    {
+      result = receiveResult(cmd, std::min(deadline, deadlineAfter(AbortedWaitGracePeriod)), nullptr);
+    }
+    catch (const std::runtime_error&)
+    {
+      std::rethrow_exception(cancelled);
+    }
+  }
+  m_resultCache.received(cmd, result);
+  m_shadowState.received(cmd, result);
   handleException(result);
   return result;
 }
 
+CommandResultPtr RemoteSimulator::receiveResult(CommandBasePtr cmd,
+                                                std::chrono::steady_clock::time_point deadline,
+                                                const CancellationToken* token)
+{
+  if (m_dispatcher)
+    return m_dispatcher->wait(cmd, deadline, token);
+  WaitLimitsScope limits(m_client, deadline, token);
+  return m_client->waitCommand(cmd);
+}
+
 CommandResultPtr RemoteSimulator::callCommand(CommandBasePtr cmd, double timestamp)
 {
   postCommand(cmd, timestamp);
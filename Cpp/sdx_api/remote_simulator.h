@@ -1,16 +1,34 @@
 #ifndef REMOTE_SIMULATOR_H__
 #define REMOTE_SIMULATOR_H__
 
+#include <chrono>
+#include <functional>
+#include <initializer_list>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <queue>
 
 #include <set>
 
+#include "cancellation_token.h"
 #include "command_result.h"
+#include "latency_stats.h"
+#include "parse_json.hpp"
+#include "precision_policy.h"
+#include "reconnect_policy.h"
+#include "result_cache.h"
+#include "shadow_state.h"
+#include "track_model.h"
 
 namespace Sdx
 {
 class CmdClient;
 class HilClient;
+class StreamRecorder;
+class CommandBlob;
+class CommandDispatcher;
+class CommandTemplate;
 class Ecef;
 class Lla;
 class Attitude;
@@ -29,6 +47,19 @@ public:
   void disconnect();
   bool isConnected() const;
 
+  // Connects again to the simulator of the last connect, HIL channel included, with the attempts and delays of the
+  // reconnect policy (a single attempt if disabled), then calls the volatile settings. Returns false if every attempt
+  // failed.
+  bool reconnect();
+  // When enabled, a lost connection is restored with reconnect before the next command is sent (not in thread safe
+  // mode). The command that noticed the loss still fails, and the results of the commands posted before are lost.
+  void setReconnectPolicy(const ReconnectPolicy& policy);
+  inline const ReconnectPolicy& reconnectPolicy() const { return m_reconnectPolicy; }
+  // Setters the simulator doesn't keep when the connection is lost (SetHilTjoin), called in this order after every
+  // reconnection. Registering a setter doesn't send it.
+  void addVolatileSetting(CommandBasePtr cmd);
+  void clearVolatileSettings();
+
   static int clientApiVersion();
   int serverApiVersion() const;
 
@@ -38,6 +69,51 @@ public:
   void setHilStreamingCheckEnabled(bool hilStreamingCheckEnabled);
   bool isHilStreamingCheckEnabled();
 
+  // Per command name Send, FirstByte and Parse latency histograms, disabled by default.
+  void setLatencyStatsEnabled(bool enabled);
+  bool isLatencyStatsEnabled() const;
+  inline LatencyStats& latencyStats() { return m_latencyStats; }
+  inline const LatencyStats& latencyStats() const { return m_latencyStats; }
+
+  // Serves the queries paired with a setter (GetEngineLatency and SetEngineLatency) from the results of previous calls
+  // without a round trip, see ResultCache. Only call without timestamp is served from the cache. Disabled by default.
+  void setResultCacheEnabled(bool enabled);
+  bool isResultCacheEnabled() const;
+  inline ResultCache& resultCache() { return m_resultCache; }
+
+  // Skips the setters whose value is known to be already applied, see ShadowState: call returns a SuccessResult
+  // without a round trip. Only call without timestamp and applyConfiguration skip setters. Disabled by default.
+  void setShadowStateEnabled(bool enabled);
+  bool isShadowStateEnabled() const;
+  inline ShadowState& shadowState() { return m_shadowState; }
+
+  // Records the command and HIL traffic, connection included if set before connect. The recorder must outlive the
+  // simulator or be detached with nullptr.
+  void setStreamRecorder(StreamRecorder* recorder);
+
+  // Decimals of the doubles sent by post and call, see PrecisionPolicy. The blobs are serialized by their owner, see
+  // CommandBlob::append. Can't be changed while connected in thread safe mode.
+  void setPrecisionPolicy(const PrecisionPolicy& policy);
+  inline const PrecisionPolicy& precisionPolicy() const { return m_precisionPolicy; }
+  // Policy to serialize the commands with, nullptr if empty. The blobs sent to this simulator are built with it by
+  // applyConfiguration, CommandScheduler, SimulatorCluster and SvCommandCoalescer.
+  inline const PrecisionPolicy* serializationPolicy() const
+  {
+    return m_precisionPolicy.isEmpty() ? nullptr : &m_precisionPolicy;
+  }
+
+  // When enabled, post, wait, call, postBlob and callBlob can be used from several threads at once: the commands are
+  // queued to a CommandDispatcher that sends them in batches from a writer thread while a reader thread delivers the
+  // results. The other functions (connection, HIL, tracks and routes) must still be called from a single thread.
+  // Disabled by default and can only be changed while disconnected. The latency stats aren't recorded while enabled.
+  void setThreadSafe(bool threadSafe);
+  bool isThreadSafe() const;
+
+  // Longest wait for a command result in wait, call, callBlob and the functions calling commands, 0 (default) waits
+  // forever. Past it, the wait fails with std::runtime_error and the late result is skipped.
+  void setDefaultTimeout(std::chrono::milliseconds timeout);
+  inline std::chrono::milliseconds defaultTimeout() const { return m_defaultTimeout; }
+
   bool arm();
   bool start();
   void stop(double timestamp);
@@ -53,8 +129,46 @@ public:
   CommandResultPtr call(CommandBasePtr cmd, const Sdx::DateTime& gpsTimestamp);
   CommandResultPtr call(CommandBasePtr cmd);
 
+  // Same as wait and call with their own timeout (0 waits forever), failing with std::runtime_error once the token is
+  // cancelled from another thread. The command can be waited again after a failure. A WaitSimulatorState is aborted in
+  // the simulator with AbortWaitSimulatorState on failure: once cancelled, its result is returned.
+  CommandResultPtr wait(CommandBasePtr cmd,
+                        std::chrono::milliseconds timeout,
+                        const CancellationToken* token = nullptr);
+  CommandResultPtr call(CommandBasePtr cmd,
+                        std::chrono::milliseconds timeout,
+                        const CancellationToken* token = nullptr);
+
+  // Renews the blob UUIDs, sends all its commands in a single write and returns their results in the blob order.
+  // Failed results are handled like call does.
+  std::vector<CommandResultPtr> callBlob(CommandBlob& blob);
+  // Sends all the blob commands in a single write without waiting for their results, as post does.
+  void postBlob(const CommandBlob& blob);
+  // Sends the commands not already applied according to the shadow state in a single write, see callBlob. Returns the
+  // results of the commands sent.
+  std::vector<CommandResultPtr> applyConfiguration(const std::vector<CommandBasePtr>& commands);
+
+  // Same as call, the elements of the array field of the result (Records of GetStatusLogResult) being passed to
+  // onElement one at a time as they are decoded instead of being stored: the returned result has the field empty and
+  // memory holds a single element whatever the size of the array. Not available in thread safe mode.
+  CommandResultPtr callStreaming(CommandBasePtr cmd,
+                                 const std::string& arrayField,
+                                 const std::function<void(const rapidjson::Value& element)>& onElement);
+  // Typed elements: callStreaming<Sdx::LogRecord>(GetStatusLog::create(), "Records", onRecord)
+  template<typename T>
+  CommandResultPtr callStreaming(CommandBasePtr cmd,
+                                 const std::string& arrayField,
+                                 const std::function<void(T&& element)>& onElement)
+  {
+    return callStreaming(cmd, arrayField, [&onElement](const rapidjson::Value& element) {
+      onElement(parse_json<T>::parse(element));
+    });
+  }
+
   CommandResultPtr beginTrackDefinition();
   void pushTrackEcef(int elapsedTime, const Ecef& ecef);
+  // Pushes all the nodes, the same span can be used to build a TrackModel of the uploaded track.
+  void pushTrackEcef(std::span<const TrackNode> nodes);
   void pushTrackEcefNed(int elapsedTime, const Ecef& ecef, const Attitude& attitude);
   void pushTrackLla(int elapsedTime, const Lla& lla);
   void pushTrackLlaNed(int elapsedTime, const Lla& lla, const Attitude& attitude);
@@ -265,6 +379,11 @@ public:
   bool checkIfStreaming();
 
   bool waitState(const std::string& state, const std::string& failureState = "");
+  // Same as above with a timeout (0 waits forever) and a token aborting the wait, see call
+  bool waitState(const std::string& state,
+                 const std::string& failureState,
+                 std::chrono::milliseconds timeout,
+                 const CancellationToken* token = nullptr);
 
   enum DeprecatedMessageMode
   {
@@ -279,7 +398,20 @@ private:
   CommandBasePtr postCommand(CommandBasePtr cmd, const Sdx::DateTime& gpsTimestamp);
   CommandBasePtr postCommand(CommandBasePtr cmd);
 
+  void sendCommand(CommandBasePtr cmd);
   CommandResultPtr waitCommand(CommandBasePtr cmd);
+  CommandResultPtr waitCommand(CommandBasePtr cmd, std::chrono::milliseconds timeout, const CancellationToken* token);
+  CommandResultPtr receiveResult(CommandBasePtr cmd,
+                                 std::chrono::steady_clock::time_point deadline,
+                                 const CancellationToken* token);
+  // Template of the push commands sent under key, made from the prototype on first use. Null in thread safe mode, the
+  // commands being posted through the dispatcher.
+  CommandTemplate* pushTemplate(const std::string& key,
+                                const std::function<CommandBasePtr()>& prototype,
+                                std::initializer_list<const char*> slotFields);
+  void postTemplate(CommandTemplate& commandTemplate);
+  // Reconnects if the connection is lost and the reconnect policy enabled
+  void restoreConnection();
 
   CommandResultPtr callCommand(CommandBasePtr cmd, double timestamp);
   CommandResultPtr callCommand(CommandBasePtr cmd, const Sdx::DateTime& gpsTimestamp);
@@ -288,6 +420,7 @@ private:
   void resetTime();
   void checkForbiddenPost(CommandBasePtr cmd);
   void checkForbiddenCall(CommandBasePtr cmd);
+  void checkBlob(const CommandBlob& blob);
   bool hilCheck(double elapsedTime);
   void handleException(CommandResultPtr result);
   void errorMessage(const std::string& msg);
@@ -303,10 +436,26 @@ private:
   bool m_beginRoute;
 
   std::set<std::string> m_beginIntTxTrack;
+  std::map<std::string, std::unique_ptr<CommandTemplate>> m_pushTemplates;
+  std::string m_connectIp;
+  int m_connectId;
+  bool m_failIfApiVersionMismatch;
+  ReconnectPolicy m_reconnectPolicy;
+  std::vector<CommandBasePtr> m_volatileSettings;
+  bool m_reconnecting;
+  std::chrono::milliseconds m_defaultTimeout;
   std::set<std::string> m_latchDeprecated;
+  std::mutex m_deprecatedMutex;
   DeprecatedMessageMode m_deprecatedMessageMode {DeprecatedMessageMode::LATCH};
 
   int m_serverApiVersion;
+  LatencyStats m_latencyStats;
+  ResultCache m_resultCache;
+  ShadowState m_shadowState;
+  StreamRecorder* m_streamRecorder;
+  PrecisionPolicy m_precisionPolicy;
+  bool m_threadSafe;
+  CommandDispatcher* m_dispatcher;
 };
 } // namespace Sdx
 
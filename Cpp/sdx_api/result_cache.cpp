@@ -0,0 +1,145 @@
+#include "result_cache.h"
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "command_metadata.h"
+
+namespace Sdx
+{
+
+ResultCache::ResultCache() : m_enabled(false), m_generation(0), m_hitCount(0), m_missCount(0)
+{
+}
+
+void ResultCache::setEnabled(bool enabled)
+{
+  m_enabled = enabled;
+  if (!enabled)
+    clear();
+}
+
+bool ResultCache::isEnabled() const
+{
+  return m_enabled;
+}
+
+std::string ResultCache::key(const CommandBasePtr& cmd)
+{
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  writer.StartArray();
+  writer.String(cmd->name().c_str(), static_cast<rapidjson::SizeType>(cmd->name().size()));
+  for (const std::string& field : cmd->fieldNames())
+  {
+    if (cmd->contains(field))
+      cmd->value(field).Accept(writer);
+    else
+      writer.Null();
+  }
+  writer.EndArray();
+  return std::string(buffer.GetString(), buffer.GetSize());
+}
+
+CommandResultPtr ResultCache::find(const CommandBasePtr& cmd)
+{
+  if (!m_enabled || CommandMetadata::pairedSetter(cmd->name()).empty())
+    return nullptr;
+
+  const std::string cmdKey = key(cmd);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_entries.find(cmdKey);
+  if (it == m_entries.end())
+  {
+    ++m_missCount;
+    return nullptr;
+  }
+  ++m_hitCount;
+  return it->second.result;
+}
+
+void ResultCache::sending(const CommandBasePtr& cmd)
+{
+  if (!m_enabled || CommandMetadata::pairedSetter(cmd->name()).empty())
+    return;
+
+  std::string cmdKey = key(cmd);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_inFlight.size() >= MaxQueriesInFlight)
+    m_inFlight.clear();
+  m_inFlight[cmd->uuid()] = {std::move(cmdKey), m_generation};
+}
+
+void ResultCache::sent(const std::string& cmdName)
+{
+  if (!m_enabled || CommandMetadata::isQuery(cmdName))
+    return;
+
+  const std::string family = CommandMetadata::subjectFamily(CommandMetadata::subject(cmdName));
+  const bool independentSetter = !CommandMetadata::resetsConfiguration(cmdName) &&
+                                 !CommandMetadata::pairedQuery(cmdName).empty() &&
+                                 !CommandMetadata::isLinkedFamily(family);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (independentSetter)
+    invalidateFamily(family);
+  else
+    invalidateAll();
+}
+
+void ResultCache::received(const CommandBasePtr& cmd, const CommandResultPtr& result)
+{
+  if (!m_enabled)
+    return;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_inFlight.find(cmd->uuid());
+  if (it == m_inFlight.end())
+    return;
+
+  if (result && result->isSuccess() && it->second.generation == m_generation)
+  {
+    const std::string family = CommandMetadata::subjectFamily(CommandMetadata::subject(cmd->name()));
+    m_entries[it->second.key] = {family, result};
+  }
+  m_inFlight.erase(it);
+}
+
+void ResultCache::clear()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  invalidateAll();
+  m_inFlight.clear();
+}
+
+size_t ResultCache::size() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+uint64_t ResultCache::hitCount() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_hitCount;
+}
+
+uint64_t ResultCache::missCount() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_missCount;
+}
+
+void ResultCache::invalidateFamily(const std::string& family)
+{
+  ++m_generation;
+  std::erase_if(m_entries, [&family](const auto& entry) { return entry.second.family == family; });
+}
+
+void ResultCache::invalidateAll()
+{
+  ++m_generation;
+  m_entries.clear();
+}
+
+} // namespace Sdx
@@ -0,0 +1,84 @@
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "command_result.h"
+
+namespace Sdx
+{
+
+// Successful results of the queries paired with a setter (see CommandMetadata), by command name and arguments.
+//
+// Every command sent must be reported with sending and sent, so the cache can invalidate what it changes:
+// - A paired setter invalidates the queries of its subject family (SetPowerForSV invalidates GetPowerForSV), or
+//   everything if its family is linked to another one (see CommandMetadata::isLinkedFamily).
+// - Other queries don't invalidate anything.
+// - Any other command (New, Open, Add, Remove, Import...) invalidates everything.
+// A result is only stored if nothing was invalidated between its query being sent and its result being received.
+// Queries without a setter of the same subject aren't cached, such as GetVehicleAntennaModel whose models are changed
+// by the SetVehicleAntenna... setters.
+// Changes made outside of this client (Skydel user interface, other clients) aren't seen, use clear. A cached result is
+// shared by all the hits, its related command is the query that was actually sent.
+//
+// Thread-safe.
+class ResultCache
+{
+public:
+  ResultCache();
+
+  // Disabled by default, disabling clears the cache.
+  void setEnabled(bool enabled);
+  bool isEnabled() const;
+
+  // Cached result of the query, nullptr if there is none
+  CommandResultPtr find(const CommandBasePtr& cmd);
+
+  // Before cmd is sent
+  void sending(const CommandBasePtr& cmd);
+  // After the command was sent
+  void sent(const std::string& cmdName);
+  // Stores the result of cmd if it can be cached
+  void received(const CommandBasePtr& cmd, const CommandResultPtr& result);
+
+  void clear();
+
+  size_t size() const;
+  uint64_t hitCount() const;
+  uint64_t missCount() const;
+
+  // Queries sent but never received are forgotten past this count
+  static constexpr size_t MaxQueriesInFlight = 10000;
+
+private:
+  struct Entry
+  {
+    std::string family;
+    CommandResultPtr result;
+  };
+  struct InFlight
+  {
+    std::string key;
+    uint64_t generation;
+  };
+
+  static std::string key(const CommandBasePtr& cmd);
+  void invalidateFamily(const std::string& family);
+  void invalidateAll();
+
+  std::atomic<bool> m_enabled;
+  mutable std::mutex m_mutex;
+  uint64_t m_generation; // Incremented on every invalidation
+  std::unordered_map<std::string, Entry> m_entries;      // By key
+  std::unordered_map<std::string, InFlight> m_inFlight; // By query uuid
+  uint64_t m_hitCount;
+  uint64_t m_missCount;
+};
+
+} // namespace Sdx
+
+#endif // RESULT_CACHE_H
@@ -0,0 +1,217 @@
+#include "shadow_state.h"
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <algorithm>
+
+#include "command_factory.h"
+#include "command_metadata.h"
+
+namespace Sdx
+{
+
+ShadowState::ShadowState() : m_enabled(false), m_generation(0), m_skippedCount(0)
+{
+}
+
+void ShadowState::setEnabled(bool enabled)
+{
+  m_enabled = enabled;
+  if (!enabled)
+    clear();
+}
+
+bool ShadowState::isEnabled() const
+{
+  return m_enabled;
+}
+
+bool ShadowState::isShadowed(const CommandBasePtr& cmd)
+{
+  return !cmd->hasTimestamp() && !CommandMetadata::pairedQuery(cmd->name()).empty();
+}
+
+void ShadowState::split(const CommandBasePtr& cmd, std::string& key, std::string& value)
+{
+  auto fields = m_keyFields.find(cmd->name());
+  if (fields == m_keyFields.end())
+  {
+    std::vector<std::string> keyFields;
+    if (auto query = CommandFactory::instance()->createEmptyCommand(CommandMetadata::pairedQuery(cmd->name())))
+      keyFields = query->fieldNames();
+    fields = m_keyFields.emplace(cmd->name(), std::move(keyFields)).first;
+  }
+
+  rapidjson::StringBuffer keyBuffer;
+  rapidjson::Writer<rapidjson::StringBuffer> keyWriter(keyBuffer);
+  rapidjson::StringBuffer valueBuffer;
+  rapidjson::Writer<rapidjson::StringBuffer> valueWriter(valueBuffer);
+  keyWriter.StartArray();
+  keyWriter.String(cmd->name().c_str(), static_cast<rapidjson::SizeType>(cmd->name().size()));
+  valueWriter.StartArray();
+  for (const std::string& field : cmd->fieldNames())
+  {
+    const bool isKey = std::find(fields->second.begin(), fields->second.end(), field) != fields->second.end();
+    auto& writer = isKey ? keyWriter : valueWriter;
+    if (cmd->contains(field))
+      cmd->value(field).Accept(writer);
+    else
+      writer.Null();
+  }
+  keyWriter.EndArray();
+  valueWriter.EndArray();
+
+  key.assign(keyBuffer.GetString(), keyBuffer.GetSize());
+  value.assign(valueBuffer.GetString(), valueBuffer.GetSize());
+}
+
+bool ShadowState::isApplied(const CommandBasePtr& cmd)
+{
+  if (!m_enabled || !isShadowed(cmd))
+    return false;
+
+  std::string key, value;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  split(cmd, key, value);
+  auto it = m_entries.find(key);
+  if (it == m_entries.end() || it->second.value != value)
+    return false;
+  ++m_skippedCount;
+  return true;
+}
+
+std::vector<CommandBasePtr> ShadowState::diff(const std::vector<CommandBasePtr>& commands)
+{
+  std::vector<CommandBasePtr> notApplied;
+  for (const CommandBasePtr& cmd : commands)
+  {
+    if (!isApplied(cmd))
+      notApplied.push_back(cmd);
+  }
+  return notApplied;
+}
+
+void ShadowState::sending(const CommandBasePtr& cmd)
+{
+  if (!m_enabled || !isShadowed(cmd))
+    return;
+
+  std::string key, value;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  split(cmd, key, value);
+  const std::string family = CommandMetadata::subjectFamily(CommandMetadata::subject(cmd->name()));
+  if (m_inFlight.size() >= MaxSettersInFlight)
+    m_inFlight.clear();
+  m_inFlight[cmd->uuid()] = {std::move(key), std::move(value), m_generation, otherSetters(cmd->name(), family)};
+}
+
+void ShadowState::sent(const CommandBasePtr& cmd)
+{
+  if (!m_enabled || CommandMetadata::isQuery(cmd->name()))
+    return;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (cmd->hasTimestamp())
+  {
+    // Applied later, while other setters may be recorded in the meantime
+    ++m_generation;
+    m_entries.clear();
+  }
+  else if (isShadowed(cmd))
+  {
+    // Applied once its success is received
+    std::string key, value;
+    split(cmd, key, value);
+    m_entries.erase(key);
+    const uint64_t generation = m_generation;
+    if (forget(cmd->name(), false))
+    {
+      // Everything sent before is forgotten, but not the setter itself
+      auto it = m_inFlight.find(cmd->uuid());
+      if (it != m_inFlight.end() && it->second.generation == generation)
+        it->second.generation = m_generation;
+    }
+  }
+  else
+  {
+    forget(cmd->name(), true);
+  }
+}
+
+void ShadowState::sent(const std::string& cmdName)
+{
+  if (!m_enabled || CommandMetadata::isQuery(cmdName))
+    return;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  forget(cmdName, true);
+}
+
+void ShadowState::received(const CommandBasePtr& cmd, const CommandResultPtr& result)
+{
+  if (!m_enabled)
+    return;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_inFlight.find(cmd->uuid());
+  if (it == m_inFlight.end())
+    return;
+
+  const std::string family = CommandMetadata::subjectFamily(CommandMetadata::subject(cmd->name()));
+  if (result && result->isSuccess() && it->second.generation == m_generation &&
+      it->second.otherSetters == otherSetters(cmd->name(), family))
+  {
+    m_entries[it->second.key] = {cmd->name(), family, std::move(it->second.value)};
+  }
+  m_inFlight.erase(it);
+}
+
+void ShadowState::clear()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ++m_generation;
+  m_entries.clear();
+  m_inFlight.clear();
+}
+
+size_t ShadowState::size() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+uint64_t ShadowState::skippedCount() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_skippedCount;
+}
+
+bool ShadowState::forget(const std::string& cmdName, bool sameName)
+{
+  const std::string family = CommandMetadata::subjectFamily(CommandMetadata::subject(cmdName));
+  if (CommandMetadata::resetsConfiguration(cmdName) || CommandMetadata::pairedQuery(cmdName).empty() ||
+      CommandMetadata::isLinkedFamily(family))
+  {
+    ++m_generation;
+    m_entries.clear();
+    return true;
+  }
+
+  std::erase_if(m_entries, [&](const auto& entry) {
+    return entry.second.family == family && (sameName || entry.second.name != cmdName);
+  });
+  ++m_sentByFamily[family];
+  ++m_sentByName[cmdName];
+  return false;
+}
+
+uint64_t ShadowState::otherSetters(const std::string& cmdName, const std::string& family) const
+{
+  auto byFamily = m_sentByFamily.find(family);
+  auto byName = m_sentByName.find(cmdName);
+  return (byFamily != m_sentByFamily.end() ? byFamily->second : 0) -
+         (byName != m_sentByName.end() ? byName->second : 0);
+}
+
+} // namespace Sdx
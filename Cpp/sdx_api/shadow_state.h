@@ -0,0 +1,97 @@
+#ifndef SHADOW_STATE_H
+#define SHADOW_STATE_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "command_result.h"
+
+namespace Sdx
+{
+
+// Client side copy of the configuration applied by the setters paired with a query (see CommandMetadata).
+//
+// A setter is identified by its name and the fields it shares with its query (SetPowerForSV is identified by its
+// System and SvId, GetPowerForSV arguments), the other fields are its value. A setter whose value is already applied
+// is redundant and doesn't need to be sent.
+//
+// Every command sent must be reported with sending and sent, and every result waited with received:
+// - A setter is recorded once its success is received, unless another setter of its subject family or a command
+//   outside of the pairs was sent in the meantime.
+// - A setter forgets the other setters of its subject family (SetPowerForEachSV forgets SetPowerForSV), or
+//   everything if its family is linked to another one (SetVehicleTrajectoryCircular forgets SetVehicleTrajectory, see
+//   CommandMetadata::isLinkedFamily).
+// - Timestamped setters, and any command that isn't a query or a paired setter (New, Open, Add, Remove...), forget
+//   everything they might change.
+// Changes made outside of this client (Skydel user interface, other clients) aren't seen, use clear.
+//
+// Thread-safe.
+class ShadowState
+{
+public:
+  ShadowState();
+
+  // Disabled by default, disabling clears the state.
+  void setEnabled(bool enabled);
+  bool isEnabled() const;
+
+  // True if cmd is a setter whose value is known to be applied
+  bool isApplied(const CommandBasePtr& cmd);
+  // The commands which aren't applied, in the same order
+  std::vector<CommandBasePtr> diff(const std::vector<CommandBasePtr>& commands);
+
+  // Before cmd is sent
+  void sending(const CommandBasePtr& cmd);
+  // After the command was sent
+  void sent(const CommandBasePtr& cmd);
+  // After a command only known by its name was sent, forgets all its subject family
+  void sent(const std::string& cmdName);
+  void received(const CommandBasePtr& cmd, const CommandResultPtr& result);
+
+  void clear();
+
+  size_t size() const;
+  uint64_t skippedCount() const;
+
+  // Setters sent but never received are forgotten past this count
+  static constexpr size_t MaxSettersInFlight = 10000;
+
+private:
+  struct Entry
+  {
+    std::string name;
+    std::string family;
+    std::string value;
+  };
+  struct InFlight
+  {
+    std::string key;
+    std::string value;
+    uint64_t generation;
+    uint64_t otherSetters; // Sent in the family by other setters
+  };
+
+  bool isShadowed(const CommandBasePtr& cmd);
+  void split(const CommandBasePtr& cmd, std::string& key, std::string& value);
+  // Returns true if everything was forgotten
+  bool forget(const std::string& cmdName, bool sameName);
+  uint64_t otherSetters(const std::string& cmdName, const std::string& family) const;
+
+  std::atomic<bool> m_enabled;
+  mutable std::mutex m_mutex;
+  uint64_t m_generation; // Incremented when everything is forgotten
+  std::unordered_map<std::string, Entry> m_entries;      // By setter key
+  std::unordered_map<std::string, InFlight> m_inFlight; // By setter uuid
+  std::unordered_map<std::string, uint64_t> m_sentByFamily;
+  std::unordered_map<std::string, uint64_t> m_sentByName;
+  std::unordered_map<std::string, std::vector<std::string>> m_keyFields; // By setter name
+  uint64_t m_skippedCount;
+};
+
+} // namespace Sdx
+
+#endif // SHADOW_STATE_H
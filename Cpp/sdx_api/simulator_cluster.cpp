@@ -0,0 +1,191 @@
+#include "simulator_cluster.h"
+
+#include <atomic>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+#include "all_commands.h"
+#include "command_blob.h"
+#include "remote_simulator.h"
+
+namespace Sdx
+{
+
+namespace
+{
+// Runs fct(index) for index in [0, count) on one thread each and rethrows the first exception once all are done.
+void runConcurrently(size_t count, const std::function<void(size_t index)>& fct)
+{
+  std::vector<std::exception_ptr> errors(count);
+  std::vector<std::thread> threads;
+  threads.reserve(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    threads.emplace_back([&fct, &errors, i] {
+      try
+      {
+        fct(i);
+      }
+      catch (...)
+      {
+        errors[i] = std::current_exception();
+      }
+    });
+  }
+
+  for (std::thread& thread : threads)
+    thread.join();
+  for (const std::exception_ptr& error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+} // namespace
+
+SimulatorCluster::SimulatorCluster(bool exceptionOnError) : m_exceptionOnError(exceptionOnError), m_verbose(false)
+{
+}
+
+SimulatorCluster::~SimulatorCluster()
+{
+  disconnect();
+}
+
+bool SimulatorCluster::connect(const std::vector<SimulatorEndpoint>& endpoints, bool failIfApiVersionMismatch)
+{
+  disconnect();
+
+  std::vector<std::unique_ptr<RemoteSimulator>> instances;
+  for (size_t i = 0; i < endpoints.size(); ++i)
+  {
+    instances.push_back(std::make_unique<RemoteSimulator>(m_exceptionOnError));
+    instances.back()->setVerbose(m_verbose);
+  }
+
+  std::atomic<bool> connected {true};
+  try
+  {
+    runConcurrently(instances.size(), [&](size_t i) {
+      if (!instances[i]->connect(endpoints[i].ip, endpoints[i].id, failIfApiVersionMismatch))
+        connected = false;
+    });
+  }
+  catch (...)
+  {
+    for (auto& instance : instances)
+    {
+      if (instance->isConnected())
+        instance->disconnect();
+    }
+    throw;
+  }
+
+  if (!connected)
+  {
+    for (auto& instance : instances)
+    {
+      if (instance->isConnected())
+        instance->disconnect();
+    }
+    return false;
+  }
+
+  m_instances = std::move(instances);
+  return true;
+}
+
+bool SimulatorCluster::connect(const std::string& ip, int count, bool failIfApiVersionMismatch)
+{
+  std::vector<SimulatorEndpoint> endpoints;
+  for (int id = 0; id < count; ++id)
+    endpoints.push_back({ip, id});
+  return connect(endpoints, failIfApiVersionMismatch);
+}
+
+void SimulatorCluster::disconnect()
+{
+  for (auto& instance : m_instances)
+  {
+    if (instance->isConnected())
+      instance->disconnect();
+  }
+  m_instances.clear();
+}
+
+RemoteSimulator& SimulatorCluster::instance(size_t index)
+{
+  if (index >= m_instances.size())
+    throw std::runtime_error("Invalid simulator instance index.");
+  return *m_instances[index];
+}
+
+void SimulatorCluster::setVerbose(bool verbose)
+{
+  m_verbose = verbose;
+  for (auto& instance : m_instances)
+    instance->setVerbose(verbose);
+}
+
+void SimulatorCluster::forEach(const std::function<void(RemoteSimulator& simulator, size_t index)>& fct)
+{
+  runConcurrently(m_instances.size(), [&](size_t i) { fct(*m_instances[i], i); });
+}
+
+std::vector<std::vector<CommandResultPtr>> SimulatorCluster::broadcast(
+  const std::vector<CommandBasePtr>& commands,
+  const std::map<size_t, std::vector<CommandBasePtr>>& overrides)
+{
+  // Serialized once with the precision policy of the first instance, again for the instances having another one
+  const PrecisionPolicy* commonPolicy = m_instances.empty() ? nullptr : m_instances.front()->serializationPolicy();
+  const CommandBlob common(commands, commonPolicy);
+  std::vector<std::vector<CommandResultPtr>> results(m_instances.size());
+
+  forEach([&](RemoteSimulator& simulator, size_t index) {
+    const PrecisionPolicy* policy = simulator.serializationPolicy();
+    const bool samePolicy = policy == commonPolicy || (policy && commonPolicy && *policy == *commonPolicy);
+    CommandBlob blob = samePolicy ? common : CommandBlob(commands, policy);
+    if (auto it = overrides.find(index); it != overrides.end())
+    {
+      for (const CommandBasePtr& cmd : it->second)
+        blob.append(cmd, policy);
+    }
+    if (!blob.isEmpty())
+      results[index] = simulator.callBlob(blob);
+  });
+
+  return results;
+}
+
+bool SimulatorCluster::startPps(int syncDurationMs)
+{
+  if (m_verbose)
+    std::cout << "Starting " << m_instances.size() << " instances at PPS0 + " << syncDurationMs << " ms" << std::endl;
+
+  std::atomic<bool> success {true};
+  auto step = [&](const std::function<CommandBasePtr()>& create) {
+    forEach([&](RemoteSimulator& simulator, size_t) {
+      if (success && !simulator.call(create())->isSuccess())
+        success = false;
+    });
+  };
+
+  step([] { return Cmd::ArmPPS::create(); });
+  if (success)
+    step([] { return Cmd::WaitAndResetPPS::create(); });
+  if (success)
+    step([syncDurationMs] { return Cmd::StartPPS::create(syncDurationMs); });
+
+  if (!success && m_verbose)
+    std::cout << "Failed to start the instances." << std::endl;
+  return success;
+}
+
+void SimulatorCluster::stop()
+{
+  forEach([](RemoteSimulator& simulator, size_t) { simulator.stop(); });
+}
+
+} // namespace Sdx
@@ -0,0 +1,68 @@
+#ifndef SIMULATOR_CLUSTER_H
+#define SIMULATOR_CLUSTER_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "command_result.h"
+
+namespace Sdx
+{
+
+class RemoteSimulator;
+
+struct SimulatorEndpoint
+{
+  std::string ip;
+  int id; // Instance id, the command port is 4820 + id
+};
+
+// Drives several Skydel instances (main and workers, or spoofer instances) as a group.
+//
+// Every operation runs concurrently on all the instances, one thread per instance, and returns once all are done. If
+// an instance throws, the first exception is rethrown after every instance has finished.
+class SimulatorCluster
+{
+public:
+  explicit SimulatorCluster(bool exceptionOnError = true);
+  ~SimulatorCluster();
+
+  // Connects to all the endpoints concurrently. On failure, the instances already connected are disconnected.
+  bool connect(const std::vector<SimulatorEndpoint>& endpoints, bool failIfApiVersionMismatch = false);
+  // Connects to the instances 0 to count - 1 of ip
+  bool connect(const std::string& ip, int count, bool failIfApiVersionMismatch = false);
+  void disconnect();
+
+  inline size_t size() const { return m_instances.size(); }
+  RemoteSimulator& instance(size_t index);
+
+  void setVerbose(bool verbose);
+
+  // Runs fct(simulator, index) for every instance concurrently
+  void forEach(const std::function<void(RemoteSimulator& simulator, size_t index)>& fct);
+
+  // Sends the common commands to every instance, followed by the instance overrides (by instance index). The common
+  // commands are serialized once and pipelined to each instance, see RemoteSimulator::callBlob. Returns the results by
+  // instance, in the order the commands were sent.
+  std::vector<std::vector<CommandResultPtr>> broadcast(
+    const std::vector<CommandBasePtr>& commands,
+    const std::map<size_t, std::vector<CommandBasePtr>>& overrides = {});
+
+  // Synchronized start of all the instances: ArmPPS on all, then WaitAndResetPPS on all so they share the same PPS
+  // reference (PPS0), then StartPPS to start at PPS0 + syncDurationMs. Each step starts once all the instances
+  // completed the previous one.
+  bool startPps(int syncDurationMs);
+  void stop();
+
+private:
+  bool m_exceptionOnError;
+  bool m_verbose;
+  std::vector<std::unique_ptr<RemoteSimulator>> m_instances;
+};
+
+} // namespace Sdx
+
+#endif // SIMULATOR_CLUSTER_H
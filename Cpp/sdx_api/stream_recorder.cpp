@@ -0,0 +1,82 @@
+#include "stream_recorder.h"
+
+#include <cstring>
+
+namespace Sdx
+{
+
+StreamRecorder::StreamRecorder() : m_file(nullptr), m_recordCount(0)
+{
+}
+
+StreamRecorder::~StreamRecorder()
+{
+  close();
+}
+
+bool StreamRecorder::open(const std::string& path)
+{
+  std::lock_guard lock(m_mutex);
+  if (m_file)
+    fclose(m_file);
+
+  m_file = fopen(path.c_str(), "wb");
+  m_recordCount = 0;
+  if (!m_file)
+    return false;
+
+  if (fwrite(Magic, sizeof(Magic), 1, m_file) != 1)
+  {
+    fclose(m_file);
+    m_file = nullptr;
+    return false;
+  }
+  m_start = std::chrono::steady_clock::now();
+  return true;
+}
+
+void StreamRecorder::close()
+{
+  std::lock_guard lock(m_mutex);
+  if (m_file)
+  {
+    fclose(m_file);
+    m_file = nullptr;
+  }
+}
+
+bool StreamRecorder::isRecording() const
+{
+  std::lock_guard lock(m_mutex);
+  return m_file != nullptr;
+}
+
+uint64_t StreamRecorder::recordCount() const
+{
+  std::lock_guard lock(m_mutex);
+  return m_recordCount;
+}
+
+void StreamRecorder::record(StreamRecordKind kind, const char* data, int size)
+{
+  const auto now = std::chrono::steady_clock::now();
+  if (size < 0)
+    return;
+
+  std::lock_guard lock(m_mutex);
+  if (!m_file)
+    return;
+
+  char header[RecordHeaderSize];
+  const uint32_t payloadSize = static_cast<uint32_t>(size);
+  const int64_t timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_start).count();
+  header[0] = static_cast<char>(kind);
+  memcpy(&header[1], &payloadSize, sizeof(payloadSize));
+  memcpy(&header[5], &timestamp, sizeof(timestamp));
+
+  fwrite(header, sizeof(header), 1, m_file);
+  fwrite(data, 1, payloadSize, m_file);
+  ++m_recordCount;
+}
+
+} // namespace Sdx
@@ -0,0 +1,65 @@
+#ifndef STREAM_RECORDER_H
+#define STREAM_RECORDER_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+
+namespace Sdx
+{
+
+enum class StreamRecordKind : uint8_t
+{
+  CommandSent = 0,     // CmdClient framed message, size prefix included
+  CommandReceived = 1, // CmdClient framed message, size prefix included
+  HilSent = 2,         // HilClient datagram
+  HilReceived = 3      // HilClient datagram
+};
+
+// Append-only binary recording of the traffic of CmdClient and HilClient.
+//
+// File layout, native endianness:
+//
+// Field      Type       Description
+// ---------  ---------  -------------------------------------------------------
+// magic      char[8]    "SDXREC01"
+// records    ...        Until the end of the file
+//
+// Record:
+//
+// Field      Type       Description
+// ---------  ---------  -------------------------------------------------------
+// kind       uint8      StreamRecordKind
+// size       uint32     Payload size in bytes
+// timestamp  int64      Monotonic time since the recording start (ns)
+// payload    char[size] Message bytes as sent or received on the socket
+//
+// A recorder can be shared by several clients and threads. Writes are buffered, the file is complete once closed.
+class StreamRecorder
+{
+public:
+  static constexpr char Magic[8] = {'S', 'D', 'X', 'R', 'E', 'C', '0', '1'};
+  static constexpr size_t RecordHeaderSize = 13;
+
+  StreamRecorder();
+  ~StreamRecorder();
+
+  bool open(const std::string& path);
+  void close();
+  bool isRecording() const;
+
+  void record(StreamRecordKind kind, const char* data, int size);
+  uint64_t recordCount() const;
+
+private:
+  mutable std::mutex m_mutex;
+  FILE* m_file;
+  std::chrono::steady_clock::time_point m_start;
+  uint64_t m_recordCount;
+};
+
+} // namespace Sdx
+
+#endif // STREAM_RECORDER_H
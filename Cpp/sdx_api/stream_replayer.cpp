@@ -0,0 +1,184 @@
+#include "stream_replayer.h"
+
+#if _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <chrono>
+#include <cstring>
+#include <string_view>
+#include <thread>
+
+#include "cmd_client.h"
+#include "hil_client.h"
+
+namespace Sdx
+{
+
+struct StreamReplayer::Pimpl
+{
+  const char* data {nullptr};
+  size_t size {0};
+  size_t offset {0};
+#if _WIN32
+  HANDLE file {INVALID_HANDLE_VALUE};
+  HANDLE mapping {nullptr};
+#endif
+};
+
+StreamReplayer::StreamReplayer() : m(new Pimpl)
+{
+}
+
+StreamReplayer::~StreamReplayer()
+{
+  close();
+  delete m;
+}
+
+bool StreamReplayer::open(const std::string& path)
+{
+  close();
+
+#if _WIN32
+  m->file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, 0, nullptr);
+  if (m->file == INVALID_HANDLE_VALUE)
+    return false;
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(m->file, &fileSize) || fileSize.QuadPart < static_cast<LONGLONG>(sizeof(StreamRecorder::Magic)))
+  {
+    close();
+    return false;
+  }
+  m->mapping = CreateFileMappingA(m->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!m->mapping)
+  {
+    close();
+    return false;
+  }
+  m->data = static_cast<const char*>(MapViewOfFile(m->mapping, FILE_MAP_READ, 0, 0, 0));
+  m->size = static_cast<size_t>(fileSize.QuadPart);
+#else
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat st;
+  if (fstat(fd, &st) < 0 || st.st_size < static_cast<off_t>(sizeof(StreamRecorder::Magic)))
+  {
+    ::close(fd);
+    return false;
+  }
+  void* mapped = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED)
+    return false;
+  madvise(mapped, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+  m->data = static_cast<const char*>(mapped);
+  m->size = static_cast<size_t>(st.st_size);
+#endif
+
+  if (!m->data || memcmp(m->data, StreamRecorder::Magic, sizeof(StreamRecorder::Magic)) != 0)
+  {
+    close();
+    return false;
+  }
+  rewind();
+  return true;
+}
+
+void StreamReplayer::close()
+{
+#if _WIN32
+  if (m->data)
+    UnmapViewOfFile(m->data);
+  if (m->mapping)
+    CloseHandle(m->mapping);
+  if (m->file != INVALID_HANDLE_VALUE)
+    CloseHandle(m->file);
+  m->mapping = nullptr;
+  m->file = INVALID_HANDLE_VALUE;
+#else
+  if (m->data)
+    munmap(const_cast<char*>(m->data), m->size);
+#endif
+  m->data = nullptr;
+  m->size = 0;
+  m->offset = 0;
+}
+
+bool StreamReplayer::isOpen() const
+{
+  return m->data != nullptr;
+}
+
+void StreamReplayer::rewind()
+{
+  m->offset = sizeof(StreamRecorder::Magic);
+}
+
+bool StreamReplayer::next(StreamRecord& record)
+{
+  if (!m->data || m->size - m->offset < StreamRecorder::RecordHeaderSize)
+    return false;
+
+  const char* header = m->data + m->offset;
+  uint32_t size;
+  memcpy(&size, &header[1], sizeof(size));
+  if (m->size - m->offset - StreamRecorder::RecordHeaderSize < size) // Truncated record
+    return false;
+
+  record.kind = static_cast<StreamRecordKind>(header[0]);
+  memcpy(&record.timestamp, &header[5], sizeof(record.timestamp));
+  record.data = header + StreamRecorder::RecordHeaderSize;
+  record.size = size;
+  m->offset += StreamRecorder::RecordHeaderSize + size;
+  return true;
+}
+
+bool StreamReplayer::replay(CmdClient* cmdClient, HilClient* hilClient, double speed)
+{
+  if (!isOpen())
+    return false;
+
+  using Clock = std::chrono::steady_clock;
+  const Clock::time_point start = Clock::now();
+  std::string_view received;
+
+  rewind();
+  StreamRecord record;
+  while (next(record))
+  {
+    if (speed > 0.0 && (record.kind == StreamRecordKind::CommandSent || record.kind == StreamRecordKind::HilSent))
+    {
+      const auto offset = std::chrono::nanoseconds(static_cast<int64_t>(static_cast<double>(record.timestamp) / speed));
+      std::this_thread::sleep_until(start + offset);
+    }
+
+    switch (record.kind)
+    {
+      case StreamRecordKind::CommandSent:
+        if (cmdClient && !cmdClient->sendRawMessage(record.data, static_cast<int>(record.size)))
+          return false;
+        break;
+      case StreamRecordKind::CommandReceived:
+        if (cmdClient && !cmdClient->receiveRawMessage(received))
+          return false;
+        break;
+      case StreamRecordKind::HilSent:
+        if (hilClient && !hilClient->sendRawMessage(record.data, static_cast<int>(record.size)))
+          return false;
+        break;
+      case StreamRecordKind::HilReceived:
+        break;
+    }
+  }
+  rewind();
+  return true;
+}
+
+} // namespace Sdx
@@ -0,0 +1,53 @@
+#ifndef STREAM_REPLAYER_H
+#define STREAM_REPLAYER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "stream_recorder.h"
+
+namespace Sdx
+{
+
+class CmdClient;
+class HilClient;
+
+struct StreamRecord
+{
+  StreamRecordKind kind;
+  int64_t timestamp; // ns since the recording start
+  const char* data;  // Points in the mapped file, valid until close
+  uint32_t size;
+};
+
+// Reads a StreamRecorder file through a read-only memory mapping and re-sends the recorded traffic.
+//
+// Replaying sends every recorded command and HIL datagram at its recorded time divided by speed (speed <= 0 sends as
+// fast as possible). Where the original client read a command message, the replayer reads one from the server too, so
+// the request/response pattern of the recording is preserved and the server is never left with unread results. Either
+// client can be nullptr to skip its traffic.
+class StreamReplayer
+{
+public:
+  StreamReplayer();
+  ~StreamReplayer();
+
+  bool open(const std::string& path);
+  void close();
+  bool isOpen() const;
+
+  // Sequential access to the records
+  bool next(StreamRecord& record);
+  void rewind();
+
+  bool replay(CmdClient* cmdClient, HilClient* hilClient, double speed = 1.0);
+
+private:
+  struct Pimpl;
+  Pimpl* m;
+};
+
+} // namespace Sdx
+
+#endif // STREAM_REPLAYER_H
@@ -0,0 +1,343 @@
+#include "streaming_parse.h"
+
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
+
+#include <sstream>
+#include <vector>
+
+namespace Sdx
+{
+
+namespace
+{
+// Builds a value from SAX events, its strings and containers being allocated with the given allocator
+class ValueBuilder
+{
+public:
+  explicit ValueBuilder(rapidjson::Document::AllocatorType& allocator) : m_allocator(allocator), m_complete(false) {}
+
+  inline bool isBuilding() const { return !m_containers.empty(); }
+  inline bool isComplete() const { return m_complete; }
+  inline rapidjson::Value& value() { return m_value; }
+
+  void reset()
+  {
+    m_containers.clear();
+    m_keys.clear();
+    m_value.SetNull();
+    m_complete = false;
+  }
+
+  // Moves value to the current container, or makes it the built value
+  bool add(rapidjson::Value& value)
+  {
+    if (m_containers.empty())
+    {
+      m_value = value;
+      m_complete = true;
+    }
+    else if (m_containers.back().IsObject())
+      m_containers.back().AddMember(m_keys.back(), value, m_allocator);
+    else
+      m_containers.back().PushBack(value, m_allocator);
+    return true;
+  }
+
+  bool key(const char* str, rapidjson::SizeType length)
+  {
+    m_keys.back().SetString(str, length, m_allocator);
+    return true;
+  }
+
+  bool start(rapidjson::Type type)
+  {
+    m_containers.emplace_back(type);
+    m_keys.emplace_back();
+    return true;
+  }
+
+  bool end()
+  {
+    rapidjson::Value container;
+    container = m_containers.back();
+    m_containers.pop_back();
+    m_keys.pop_back();
+    return add(container);
+  }
+
+private:
+  rapidjson::Document::AllocatorType& m_allocator;
+  std::vector<rapidjson::Value> m_containers;
+  std::vector<rapidjson::Value> m_keys; // Pending key of every container, unused for arrays
+  rapidjson::Value m_value;
+  bool m_complete;
+};
+
+// SAX handler building the command, except the elements of the streamed field which are built one at a time with
+// their own allocator, cleared after every element
+class StreamingHandler
+{
+public:
+  StreamingHandler(const std::string& field,
+                   rapidjson::Document::AllocatorType& allocator,
+                   rapidjson::Document::AllocatorType& elementAllocator,
+                   const std::function<void(const rapidjson::Value& element)>& onElement) :
+    m_field(field),
+    m_allocator(allocator),
+    m_elementAllocator(elementAllocator),
+    m_command(allocator),
+    m_element(elementAllocator),
+    m_onElement(onElement),
+    m_depth(0),
+    m_fieldKey(false),
+    m_inField(false)
+  {
+  }
+
+  inline rapidjson::Value& command() { return m_command.value(); }
+
+  bool Null()
+  {
+    rapidjson::Value value;
+    return add(value);
+  }
+
+  bool Bool(bool b)
+  {
+    rapidjson::Value value(b);
+    return add(value);
+  }
+
+  bool Int(int i)
+  {
+    rapidjson::Value value(i);
+    return add(value);
+  }
+
+  bool Uint(unsigned i)
+  {
+    rapidjson::Value value(i);
+    return add(value);
+  }
+
+  bool Int64(int64_t i)
+  {
+    rapidjson::Value value(i);
+    return add(value);
+  }
+
+  bool Uint64(uint64_t i)
+  {
+    rapidjson::Value value(i);
+    return add(value);
+  }
+
+  bool Double(double d)
+  {
+    rapidjson::Value value(d);
+    return add(value);
+  }
+
+  bool RawNumber(const char* str, rapidjson::SizeType length, bool copy) { return String(str, length, copy); }
+
+  bool String(const char* str, rapidjson::SizeType length, bool)
+  {
+    rapidjson::Value value(str, length, m_inField ? m_elementAllocator : m_allocator);
+    return add(value);
+  }
+
+  bool Key(const char* str, rapidjson::SizeType length, bool)
+  {
+    if (m_inField)
+      return m_element.key(str, length);
+    m_fieldKey = m_depth == 1 && std::string_view(str, length) == m_field;
+    return m_command.key(str, length);
+  }
+
+  bool StartObject() { return start(rapidjson::kObjectType); }
+
+  bool EndObject(rapidjson::SizeType) { return end(); }
+
+  bool StartArray()
+  {
+    if (m_fieldKey)
+    {
+      m_fieldKey = false;
+      m_inField = true;
+      ++m_depth;
+      return m_command.start(rapidjson::kArrayType);
+    }
+    return start(rapidjson::kArrayType);
+  }
+
+  bool EndArray(rapidjson::SizeType)
+  {
+    if (m_inField && !m_element.isBuilding())
+    {
+      m_inField = false;
+      --m_depth;
+      return m_command.end();
+    }
+    return end();
+  }
+
+private:
+  bool add(rapidjson::Value& value)
+  {
+    if (!m_inField)
+    {
+      m_fieldKey = false;
+      return m_command.add(value);
+    }
+    m_element.add(value);
+    return elementDone();
+  }
+
+  bool start(rapidjson::Type type)
+  {
+    if (m_inField)
+      return m_element.start(type);
+    m_fieldKey = false;
+    ++m_depth;
+    return m_command.start(type);
+  }
+
+  bool end()
+  {
+    if (m_inField)
+    {
+      m_element.end();
+      return elementDone();
+    }
+    --m_depth;
+    return m_command.end();
+  }
+
+  bool elementDone()
+  {
+    if (m_element.isComplete())
+    {
+      m_onElement(m_element.value());
+      m_element.reset();
+      m_elementAllocator.Clear();
+    }
+    return true;
+  }
+
+  const std::string& m_field;
+  rapidjson::Document::AllocatorType& m_allocator;
+  rapidjson::Document::AllocatorType& m_elementAllocator;
+  ValueBuilder m_command;
+  ValueBuilder m_element;
+  const std::function<void(const rapidjson::Value& element)>& m_onElement;
+  int m_depth;     // Of the containers of the command
+  bool m_fieldKey; // The next value is the one of the streamed field
+  bool m_inField;
+};
+
+// Stops the parsing at the value of a top level string member
+class StringMemberHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, StringMemberHandler>
+{
+public:
+  StringMemberHandler(const std::string& key, std::string& value) :
+    m_key(key),
+    m_value(value),
+    m_depth(0),
+    m_isKey(false),
+    m_found(false)
+  {
+  }
+
+  inline bool isFound() const { return m_found; }
+
+  bool Default()
+  {
+    m_isKey = false;
+    return true;
+  }
+
+  bool String(const char* str, rapidjson::SizeType length, bool)
+  {
+    if (m_isKey)
+    {
+      m_value.assign(str, length);
+      m_found = true;
+      return false;
+    }
+    return true;
+  }
+
+  bool Key(const char* str, rapidjson::SizeType length, bool)
+  {
+    m_isKey = m_depth == 1 && std::string_view(str, length) == m_key;
+    return true;
+  }
+
+  bool StartObject() { return start(); }
+  bool EndObject(rapidjson::SizeType) { return end(); }
+  bool StartArray() { return start(); }
+  bool EndArray(rapidjson::SizeType) { return end(); }
+
+private:
+  bool start()
+  {
+    m_isKey = false;
+    ++m_depth;
+    return true;
+  }
+
+  bool end()
+  {
+    --m_depth;
+    return true;
+  }
+
+  const std::string& m_key;
+  std::string& m_value;
+  int m_depth;
+  bool m_isKey;
+  bool m_found;
+};
+} // namespace
+
+bool findStringMember(std::string_view serializedObject, const std::string& key, std::string& value)
+{
+  StringMemberHandler handler(key, value);
+  rapidjson::Reader reader;
+  rapidjson::MemoryStream stream(serializedObject.data(), serializedObject.size());
+  reader.Parse(stream, handler);
+  return handler.isFound();
+}
+
+bool parseStreaming(std::string_view serializedCommand,
+                    const std::string& field,
+                    rapidjson::Document& doc,
+                    const std::function<void(const rapidjson::Value& element)>& onElement,
+                    std::string* errorMsg)
+{
+  // Most elements fit in the buffer, so they are built without any allocation
+  char elementBuffer[4096];
+  rapidjson::Document::AllocatorType elementAllocator(elementBuffer, sizeof(elementBuffer));
+
+  StreamingHandler handler(field, doc.GetAllocator(), elementAllocator, onElement);
+  rapidjson::Reader reader;
+  rapidjson::MemoryStream stream(serializedCommand.data(), serializedCommand.size());
+  const rapidjson::ParseResult result = reader.Parse(stream, handler);
+  if (result.IsError())
+  {
+    if (errorMsg)
+    {
+      std::stringstream ss;
+      ss << "JSON parse error: " << result.Code() << " at offset " << result.Offset();
+      *errorMsg = ss.str();
+    }
+    return false;
+  }
+
+  rapidjson::Value& root = doc;
+  root = handler.command();
+  return true;
+}
+
+} // namespace Sdx
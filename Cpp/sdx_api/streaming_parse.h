@@ -0,0 +1,30 @@
+#ifndef STREAMING_PARSE_H
+#define STREAMING_PARSE_H
+
+#include <rapidjson/document.h>
+
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace Sdx
+{
+
+// Parses a serialized command with a SAX reader, without building the elements of the array member field: each one
+// is passed to onElement as soon as it is decoded and discarded afterward, so a single element is held in memory
+// whatever the size of the array. The field is left as an empty array in doc, the other members are parsed as usual.
+//
+// Returns false and sets errorMsg if the JSON is not valid. Exceptions thrown by onElement stop the parsing.
+bool parseStreaming(std::string_view serializedCommand,
+                    const std::string& field,
+                    rapidjson::Document& doc,
+                    const std::function<void(const rapidjson::Value& element)>& onElement,
+                    std::string* errorMsg = nullptr);
+
+// Value of the string member key of a serialized object, read with a SAX reader which stops once it is found, without
+// building the other members. Returns false if the object has no such member before a JSON error.
+bool findStringMember(std::string_view serializedObject, const std::string& key, std::string& value);
+
+} // namespace Sdx
+
+#endif // STREAMING_PARSE_H
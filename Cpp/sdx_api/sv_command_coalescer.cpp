@@ -0,0 +1,289 @@
+#include "sv_command_coalescer.h"
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+#include "command_blob.h"
+#include "command_factory.h"
+#include "command_metadata.h"
+#include "remote_simulator.h"
+
+namespace Sdx
+{
+
+namespace
+{
+const std::string SvIdKey = "SvId";
+
+bool contains(const std::vector<std::string>& names, const std::string& name)
+{
+  return std::find(names.begin(), names.end(), name) != names.end();
+}
+
+// Command of the given name with the key fields of cmd
+rapidjson::Document commandDocument(const std::string& name,
+                                    const CommandBasePtr& cmd,
+                                    const std::vector<std::string>& keyFields)
+{
+  rapidjson::Document doc;
+  auto& allocator = doc.GetAllocator();
+  doc.SetObject();
+  doc.AddMember(rapidjson::StringRef(CommandBase::CmdNameKey.c_str()),
+                rapidjson::Value(name.c_str(), allocator),
+                allocator);
+  doc.AddMember(rapidjson::StringRef(CommandBase::CmdUuidKey.c_str()),
+                rapidjson::Value(cmd->uuid().c_str(), allocator),
+                allocator);
+  for (const std::string& field : keyFields)
+  {
+    if (cmd->contains(field))
+      doc.AddMember(rapidjson::Value(field.c_str(), allocator),
+                    rapidjson::Value(cmd->value(field), allocator),
+                    allocator);
+  }
+  return doc;
+}
+
+CommandBasePtr createCommand(rapidjson::Document&& doc)
+{
+  CommandBasePtr cmd = CommandFactory::instance()->createCommand(std::move(doc));
+  if (cmd)
+    cmd->generateUuid();
+  return cmd;
+}
+} // namespace
+
+SvCommandCoalescer::SvCommandCoalescer(RemoteSimulator& simulator, size_t minRunLength) :
+  m_simulator(simulator),
+  m_minRunLength(std::max<size_t>(minRunLength, 1))
+{
+}
+
+void SvCommandCoalescer::setMinRunLength(size_t minRunLength)
+{
+  m_minRunLength = std::max<size_t>(minRunLength, 1);
+}
+
+void SvCommandCoalescer::add(CommandBasePtr cmd)
+{
+  m_pending.push_back(cmd);
+}
+
+void SvCommandCoalescer::clear()
+{
+  m_pending.clear();
+}
+
+bool SvCommandCoalescer::isCoalescable(const CommandBasePtr& cmd)
+{
+  return !cmd->hasTimestamp() && variant(cmd->name()) && cmd->contains(SvIdKey) && cmd->value(SvIdKey).IsInt();
+}
+
+const SvCommandCoalescer::Variant* SvCommandCoalescer::variant(const std::string& forSvName)
+{
+  static std::mutex mutex;
+  static std::unordered_map<std::string, std::optional<Variant>> variants;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = variants.find(forSvName);
+  if (it != variants.end())
+    return it->second ? &*it->second : nullptr;
+
+  std::optional<Variant> found = [&]() -> std::optional<Variant> {
+    Variant variant;
+    variant.forEachSv = CommandMetadata::forEachSvVariant(forSvName);
+    variant.query = variant.forEachSv.empty() ? std::string() : CommandMetadata::pairedQuery(variant.forEachSv);
+    if (variant.query.empty())
+      return std::nullopt;
+
+    const CommandFactory* factory = CommandFactory::instance();
+    const CommandBasePtr svCmd = factory->createEmptyCommand(forSvName);
+    const CommandBasePtr eachCmd = factory->createEmptyCommand(variant.forEachSv);
+    const CommandBasePtr queryCmd = factory->createEmptyCommand(variant.query);
+    if (!svCmd || !eachCmd || !queryCmd)
+      return std::nullopt;
+
+    const std::vector<std::string> svFields = svCmd->fieldNames();
+    const std::vector<std::string> eachFields = eachCmd->fieldNames();
+    variant.keyFields = queryCmd->fieldNames();
+    if (!contains(svFields, SvIdKey))
+      return std::nullopt;
+
+    for (const std::string& field : variant.keyFields)
+    {
+      if (!contains(svFields, field) || !contains(eachFields, field))
+        return std::nullopt;
+    }
+
+    // The array fields are named as the ForSV field, or its plural (AntennaModelNames for AntennaModelName)
+    for (const std::string& field : eachFields)
+    {
+      if (contains(variant.keyFields, field))
+        continue;
+      if (contains(svFields, field))
+        variant.svFields.emplace_back(field, field);
+      else if (field.ends_with('s') && contains(svFields, field.substr(0, field.size() - 1)))
+        variant.svFields.emplace_back(field, field.substr(0, field.size() - 1));
+      else
+        return std::nullopt;
+    }
+
+    // Every ForSV field must be carried over
+    for (const std::string& field : svFields)
+    {
+      const bool carried = field == SvIdKey || contains(variant.keyFields, field) ||
+                           std::any_of(variant.svFields.begin(), variant.svFields.end(), [&field](const auto& sv) {
+                             return sv.second == field;
+                           });
+      if (!carried)
+        return std::nullopt;
+    }
+    return variant;
+  }();
+
+  it = variants.emplace(forSvName, std::move(found)).first;
+  return it->second ? &*it->second : nullptr;
+}
+
+std::string SvCommandCoalescer::groupKey(const CommandBasePtr& cmd, const Variant& variant)
+{
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  writer.StartArray();
+  writer.String(cmd->name().c_str(), static_cast<rapidjson::SizeType>(cmd->name().size()));
+  for (const std::string& field : variant.keyFields)
+  {
+    if (cmd->contains(field))
+      cmd->value(field).Accept(writer);
+    else
+      writer.Null();
+  }
+  writer.EndArray();
+  return std::string(buffer.GetString(), buffer.GetSize());
+}
+
+CommandBasePtr SvCommandCoalescer::createQuery(const CommandBasePtr& cmd, const Variant& variant)
+{
+  return createCommand(commandDocument(variant.query, cmd, variant.keyFields));
+}
+
+CommandBasePtr SvCommandCoalescer::createForEachSv(const std::vector<CommandBasePtr>& group,
+                                                   const Variant& variant,
+                                                   const CommandResultPtr& current)
+{
+  if (!current || !current->isSuccess())
+    return nullptr;
+
+  rapidjson::Document doc = commandDocument(variant.forEachSv, group.front(), variant.keyFields);
+  auto& allocator = doc.GetAllocator();
+  for (const auto& [eachField, svField] : variant.svFields)
+  {
+    if (!current->contains(eachField) || !current->value(eachField).IsArray())
+      return nullptr;
+
+    rapidjson::Value values(current->value(eachField), allocator);
+    for (const CommandBasePtr& cmd : group)
+    {
+      const int index = cmd->value(SvIdKey).GetInt() - 1;
+      if (index < 0 || index >= static_cast<int>(values.Size()) || !cmd->contains(svField))
+        return nullptr;
+      values[index].CopyFrom(cmd->value(svField), allocator);
+    }
+    doc.AddMember(rapidjson::Value(eachField.c_str(), allocator), values, allocator);
+  }
+  return createCommand(std::move(doc));
+}
+
+std::vector<CommandResultPtr> SvCommandCoalescer::flush()
+{
+  std::vector<CommandBasePtr> pending;
+  pending.swap(m_pending);
+
+  std::vector<CommandResultPtr> results;
+  std::vector<CommandBasePtr> segment;
+  for (const CommandBasePtr& cmd : pending)
+  {
+    if (isCoalescable(cmd))
+    {
+      segment.push_back(cmd);
+    }
+    else
+    {
+      flushSegment(segment, cmd, results);
+      segment.clear();
+    }
+  }
+  if (!segment.empty())
+    flushSegment(segment, nullptr, results);
+  return results;
+}
+
+void SvCommandCoalescer::flushSegment(const std::vector<CommandBasePtr>& segment,
+                                      const CommandBasePtr& barrier,
+                                      std::vector<CommandResultPtr>& results)
+{
+  // Index of the first command of the group of each command
+  std::vector<size_t> groupOf(segment.size());
+  std::map<size_t, std::vector<CommandBasePtr>> groups;
+  std::unordered_map<std::string, size_t> firstIndex;
+  for (size_t i = 0; i < segment.size(); ++i)
+  {
+    groupOf[i] = firstIndex.emplace(groupKey(segment[i], *variant(segment[i]->name())), i).first->second;
+    groups[groupOf[i]].push_back(segment[i]);
+  }
+
+  // Current values of the groups to coalesce, in a single round trip
+  std::vector<size_t> queried;
+  std::vector<CommandBasePtr> queries;
+  for (const auto& [first, group] : groups)
+  {
+    if (group.size() < m_minRunLength)
+      continue;
+    if (CommandBasePtr query = createQuery(group.front(), *variant(group.front()->name())))
+    {
+      queried.push_back(first);
+      queries.push_back(query);
+    }
+  }
+
+  std::map<size_t, CommandBasePtr> coalesced; // By first command index
+  if (!queries.empty())
+  {
+    CommandBlob blob(queries, m_simulator.serializationPolicy());
+    const std::vector<CommandResultPtr> current = m_simulator.callBlob(blob);
+    for (size_t i = 0; i < queried.size(); ++i)
+    {
+      const std::vector<CommandBasePtr>& group = groups[queried[i]];
+      if (CommandBasePtr forEachSv = createForEachSv(group, *variant(group.front()->name()), current[i]))
+        coalesced.emplace(queried[i], forEachSv);
+    }
+  }
+
+  std::vector<CommandBasePtr> commands;
+  for (size_t i = 0; i < segment.size(); ++i)
+  {
+    auto forEachSv = coalesced.find(groupOf[i]);
+    if (forEachSv == coalesced.end())
+      commands.push_back(segment[i]);
+    else if (groupOf[i] == i)
+      commands.push_back(forEachSv->second);
+  }
+  if (barrier)
+    commands.push_back(barrier);
+
+  if (!commands.empty())
+  {
+    CommandBlob blob(commands, m_simulator.serializationPolicy());
+    for (CommandResultPtr& result : m_simulator.callBlob(blob))
+      results.push_back(std::move(result));
+  }
+}
+
+} // namespace Sdx
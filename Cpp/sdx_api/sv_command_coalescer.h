@@ -0,0 +1,70 @@
+#ifndef SV_COMMAND_COALESCER_H
+#define SV_COMMAND_COALESCER_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "command_result.h"
+
+namespace Sdx
+{
+
+class RemoteSimulator;
+
+// Rewrites runs of per satellite commands into their ForEachSV variant.
+//
+// Commands are held until flush. Each ForSV command having a ForEachSV variant and a ForEachSV query
+// (EnableSignalForSV, EnableSignalForEachSV and IsSignalEnabledForEachSV) is grouped with the others sharing the
+// same query arguments (Signal "L1CA"). A group of at least minRunLength commands is sent as the ForEachSV query,
+// whose result is patched with the values of the group satellites, followed by the ForEachSV setter: two round trips
+// instead of one per satellite. The ForEachSV arrays are indexed by SV ID - 1.
+//
+// Any other command, timestamped commands included, is a barrier: the commands held before it are flushed first so
+// the order between them is kept.
+class SvCommandCoalescer
+{
+public:
+  explicit SvCommandCoalescer(RemoteSimulator& simulator, size_t minRunLength = 4);
+
+  void setMinRunLength(size_t minRunLength);
+  inline size_t minRunLength() const { return m_minRunLength; }
+
+  void add(CommandBasePtr cmd);
+  inline size_t pendingCount() const { return m_pending.size(); }
+  void clear();
+
+  // Sends the held commands with RemoteSimulator::callBlob. Returns the results of the commands actually sent,
+  // ForEachSV setters included but not their queries.
+  std::vector<CommandResultPtr> flush();
+
+  static bool isCoalescable(const CommandBasePtr& cmd);
+
+private:
+  struct Variant
+  {
+    std::string forEachSv;
+    std::string query;
+    std::vector<std::string> keyFields;
+    std::vector<std::pair<std::string, std::string>> svFields; // ForEachSV array field, ForSV field
+  };
+
+  static const Variant* variant(const std::string& forSvName);
+  static std::string groupKey(const CommandBasePtr& cmd, const Variant& variant);
+  static CommandBasePtr createQuery(const CommandBasePtr& cmd, const Variant& variant);
+  static CommandBasePtr createForEachSv(const std::vector<CommandBasePtr>& group,
+                                        const Variant& variant,
+                                        const CommandResultPtr& current);
+  // Sends the segment of coalescable commands, followed by the barrier if not nullptr
+  void flushSegment(const std::vector<CommandBasePtr>& segment,
+                    const CommandBasePtr& barrier,
+                    std::vector<CommandResultPtr>& results);
+
+  RemoteSimulator& m_simulator;
+  size_t m_minRunLength;
+  std::vector<CommandBasePtr> m_pending;
+};
+
+} // namespace Sdx
+
+#endif // SV_COMMAND_COALESCER_H
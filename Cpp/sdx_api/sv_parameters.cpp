@@ -0,0 +1,99 @@
+#include "sv_parameters.h"
+
+namespace Sdx
+{
+
+namespace
+{
+// Indexed by SvParameter
+const char* const ParameterNames[SvParameters::Count] = {
+  "Time of ephemeris",
+  "Week Number",
+  "Transmission Time",
+  "ClockBias",
+  "ClockDrift",
+  "ClockDriftRate",
+  "Crs",
+  "Crc",
+  "Cis",
+  "Cic",
+  "Cus",
+  "Cuc",
+  "DeltaN",
+  "M0",
+  "Eccentricity",
+  "SqrtA",
+  "BigOmega",
+  "I0",
+  "LittleOmega",
+  "BigOmegaDot",
+  "Idot",
+  "Accuracy",
+  "Adot",
+  "DeltaN0dot",
+  "UraIndex",
+  "IODE",
+  "IODNAV",
+  "IODEC",
+  "IODC",
+  "Tgd",
+  "IscL1CA",
+  "IscL2C",
+  "IscL5I5",
+  "IscL5Q5",
+  "IscL1CP",
+  "IscL1CD",
+  "BgdE1E5a",
+  "BgdE1E5b",
+  "Tgd1",
+  "Tgd2",
+  "TgdB1Cp",
+  "TgdB2ap",
+  "IscB1Cd",
+  "IscB2ad",
+  "SisaE1E5a",
+  "SisaE1E5b",
+};
+} // namespace
+
+SvParameters::SvParameters(const std::map<std::string, double>& map) : m_values()
+{
+  for (const auto& [name, value] : map)
+    set(parameter(name), value);
+}
+
+const char* SvParameters::name(SvParameter parameter)
+{
+  return ParameterNames[index(parameter)];
+}
+
+std::optional<SvParameter> SvParameters::fromName(std::string_view name)
+{
+  for (size_t i = 0; i < Count; ++i)
+    if (name == ParameterNames[i])
+      return static_cast<SvParameter>(i);
+  return std::nullopt;
+}
+
+SvParameter SvParameters::parameter(std::string_view name)
+{
+  if (auto parameter = fromName(name))
+    return *parameter;
+  throw std::runtime_error("Unknown SV parameter: " + std::string(name));
+}
+
+double SvParameters::at(SvParameter parameter) const
+{
+  if (!contains(parameter))
+    throw std::out_of_range(std::string("SV parameter not set: ") + name(parameter));
+  return m_values[index(parameter)];
+}
+
+std::map<std::string, double> SvParameters::toMap() const
+{
+  std::map<std::string, double> map;
+  forEach([&map](SvParameter parameter, double value) { map.emplace(name(parameter), value); });
+  return map;
+}
+
+} // namespace Sdx
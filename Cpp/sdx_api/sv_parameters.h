@@ -0,0 +1,236 @@
+#ifndef SV_PARAMETERS_H
+#define SV_PARAMETERS_H
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "parse_json.hpp"
+
+namespace Sdx
+{
+
+// Keys accepted in the ParametersDict of PushDynamicSVData and AlmanacSVData
+enum class SvParameter : uint8_t
+{
+  TimeOfEphemeris,
+  WeekNumber,
+  TransmissionTime,
+  ClockBias,
+  ClockDrift,
+  ClockDriftRate,
+  Crs,
+  Crc,
+  Cis,
+  Cic,
+  Cus,
+  Cuc,
+  DeltaN,
+  M0,
+  Eccentricity,
+  SqrtA,
+  BigOmega,
+  I0,
+  LittleOmega,
+  BigOmegaDot,
+  Idot,
+  Accuracy,
+  Adot,
+  DeltaN0dot,
+  UraIndex,
+  IODE,
+  IODNAV,
+  IODEC,
+  IODC,
+  Tgd,
+  IscL1CA,
+  IscL2C,
+  IscL5I5,
+  IscL5Q5,
+  IscL1CP,
+  IscL1CD,
+  BgdE1E5a,
+  BgdE1E5b,
+  Tgd1,
+  Tgd2,
+  TgdB1Cp,
+  TgdB2ap,
+  IscB1Cd,
+  IscB2ad,
+  SisaE1E5a,
+  SisaE1E5b,
+  Count
+};
+
+// Fixed layout replacement of the std::map<std::string, double> parameters dictionary: one slot per SvParameter and
+// a presence bit, so that filling and sending a block allocates nothing per parameter. The accessors taking a
+// parameter name behave like the map ones, but throw std::runtime_error for a name that is not a SvParameter.
+class SvParameters
+{
+public:
+  static constexpr size_t Count = static_cast<size_t>(SvParameter::Count);
+
+  SvParameters() : m_values() {}
+  explicit SvParameters(const std::map<std::string, double>& map);
+
+  // Key of the parameter in the JSON dictionary ("Time of ephemeris" for TimeOfEphemeris)
+  static const char* name(SvParameter parameter);
+  static std::optional<SvParameter> fromName(std::string_view name);
+
+  inline bool contains(SvParameter parameter) const { return m_present.test(index(parameter)); }
+  // 0 if the parameter is not set
+  inline double value(SvParameter parameter) const { return m_values[index(parameter)]; }
+  inline void set(SvParameter parameter, double value)
+  {
+    m_values[index(parameter)] = value;
+    m_present.set(index(parameter));
+  }
+  inline void erase(SvParameter parameter)
+  {
+    m_values[index(parameter)] = 0.0;
+    m_present.reset(index(parameter));
+  }
+  inline void clear()
+  {
+    m_values.fill(0.0);
+    m_present.reset();
+  }
+  inline size_t size() const { return m_present.count(); }
+  inline bool empty() const { return m_present.none(); }
+
+  // Throws std::out_of_range if the parameter is not set
+  double at(SvParameter parameter) const;
+  inline double& operator[](SvParameter parameter)
+  {
+    m_present.set(index(parameter));
+    return m_values[index(parameter)];
+  }
+
+  inline bool contains(std::string_view name) const { return contains(parameter(name)); }
+  inline size_t count(std::string_view name) const { return contains(name) ? 1 : 0; }
+  inline double at(std::string_view name) const { return at(parameter(name)); }
+  inline double& operator[](std::string_view name) { return (*this)[parameter(name)]; }
+  inline size_t erase(std::string_view name)
+  {
+    const size_t erased = count(name);
+    erase(parameter(name));
+    return erased;
+  }
+
+  // Calls f(SvParameter, double) for every parameter set, in the SvParameter order
+  template<typename F>
+  void forEach(F&& f) const
+  {
+    for (size_t i = 0; i < Count; ++i)
+      if (m_present.test(i))
+        f(static_cast<SvParameter>(i), m_values[i]);
+  }
+
+  std::map<std::string, double> toMap() const;
+
+  inline bool operator==(const SvParameters& other) const = default;
+
+private:
+  static inline size_t index(SvParameter parameter) { return static_cast<size_t>(parameter); }
+  static SvParameter parameter(std::string_view name);
+
+  std::array<double, Count> m_values;
+  std::bitset<Count> m_present;
+};
+
+// AlmanacSVData with its parameters as a SvParameters, same JSON
+struct AlmanacSVParameters
+{
+  int SvId;
+  Sdx::SvParameters Parameters;
+};
+
+} // namespace Sdx
+
+// SvParameters specialization, a JSON object whose keys are parameter names
+template<>
+struct parse_json<Sdx::SvParameters>
+{
+  static bool is_valid(const rapidjson::Value& value) { return try_parse(value).has_value(); }
+
+  static std::optional<Sdx::SvParameters> try_parse(const rapidjson::Value& value)
+  {
+    if (!value.IsObject())
+      return std::nullopt;
+
+    Sdx::SvParameters sent;
+    for (rapidjson::Value::ConstMemberIterator itr = value.MemberBegin(); itr != value.MemberEnd(); ++itr)
+    {
+      const std::optional<Sdx::SvParameter> parameter =
+        Sdx::SvParameters::fromName(std::string_view(itr->name.GetString(), itr->name.GetStringLength()));
+      const std::optional<double> parameterValue = parse_json<double>::try_parse(itr->value);
+      if (!parameter || !parameterValue)
+        return std::nullopt;
+      sent.set(*parameter, *parameterValue);
+    }
+    return sent;
+  }
+
+  static Sdx::SvParameters parse(const rapidjson::Value& value)
+  {
+    std::optional<Sdx::SvParameters> sent = try_parse(value);
+    if (!sent)
+      throw std::runtime_error("Unexpected value");
+    return *sent;
+  }
+
+  // The keys are not copied, the names being static strings
+  static rapidjson::Value format(const Sdx::SvParameters& value, rapidjson::Value::AllocatorType& alloc)
+  {
+    rapidjson::Value sent(rapidjson::kObjectType);
+    sent.MemberReserve(static_cast<rapidjson::SizeType>(value.size()), alloc);
+    value.forEach([&sent, &alloc](Sdx::SvParameter parameter, double parameterValue) {
+      sent.AddMember(rapidjson::StringRef(Sdx::SvParameters::name(parameter)), parameterValue, alloc);
+    });
+    return sent;
+  }
+};
+
+template<>
+struct parse_json<Sdx::AlmanacSVParameters>
+{
+  static bool is_valid(const rapidjson::Value& value) { return try_parse(value).has_value(); }
+
+  static std::optional<Sdx::AlmanacSVParameters> try_parse(const rapidjson::Value& value)
+  {
+    if (!value.IsObject())
+      return std::nullopt;
+    Sdx::AlmanacSVParameters sent;
+
+    if (!try_parse_json(value["SvId"], sent.SvId))
+      return std::nullopt;
+    if (!try_parse_json(value["ParametersDict"], sent.Parameters))
+      return std::nullopt;
+    return sent;
+  }
+
+  static Sdx::AlmanacSVParameters parse(const rapidjson::Value& value)
+  {
+    std::optional<Sdx::AlmanacSVParameters> sent = try_parse(value);
+    if (!sent)
+      throw std::runtime_error("Unexpected value");
+    return *sent;
+  }
+
+  static rapidjson::Value format(const Sdx::AlmanacSVParameters& value, rapidjson::Value::AllocatorType& alloc)
+  {
+    rapidjson::Value sent(rapidjson::kObjectType);
+
+    sent.AddMember("SvId", parse_json<int>::format(value.SvId, alloc), alloc);
+    sent.AddMember("ParametersDict", parse_json<Sdx::SvParameters>::format(value.Parameters, alloc), alloc);
+    return sent;
+  }
+};
+
+#endif // SV_PARAMETERS_H
@@ -0,0 +1,121 @@
+#include "sv_queries.h"
+
+#include "all_commands.h"
+#include "command_blob.h"
+#include "remote_simulator.h"
+
+namespace Sdx
+{
+
+void querySvs(RemoteSimulator& simulator,
+              const std::vector<SvKey>& keys,
+              const std::function<CommandBasePtr(const SvKey& key)>& createQuery,
+              const std::function<void(size_t row, const CommandResultPtr& result)>& fill,
+              std::vector<uint8_t>& valid)
+{
+  valid.assign(keys.size(), 0);
+  if (keys.empty())
+    return;
+
+  CommandBlob blob;
+  for (const SvKey& key : keys)
+    blob.append(createQuery(key), simulator.serializationPolicy());
+
+  const std::vector<CommandResultPtr> results = simulator.callBlob(blob);
+  for (size_t row = 0; row < results.size(); ++row)
+  {
+    if (results[row] && results[row]->isSuccess())
+    {
+      valid[row] = 1;
+      fill(row, results[row]);
+    }
+  }
+}
+
+std::vector<SvKey> queryVisibleSvs(RemoteSimulator& simulator, const std::vector<std::string>& systems)
+{
+  CommandBlob blob;
+  for (const std::string& system : systems)
+    blob.append(Cmd::GetVisibleSV::create(system), simulator.serializationPolicy());
+
+  std::vector<SvKey> keys;
+  for (const CommandResultPtr& result : simulator.callBlob(blob))
+  {
+    if (auto visible = Cmd::GetVisibleSVResult::dynamicCast(result))
+    {
+      const std::string system = visible->system();
+      for (int svId : visible->svId())
+        keys.push_back({system, svId});
+    }
+  }
+  return keys;
+}
+
+SvPowerTable queryPower(RemoteSimulator& simulator,
+                        const std::vector<SvKey>& keys,
+                        const std::vector<std::string>& signals)
+{
+  SvPowerTable table;
+  table.keys = keys;
+  table.signals = signals;
+  table.rows.resize(keys.size());
+  table.signalPowers.resize(keys.size() * signals.size());
+
+  querySvs(
+    simulator,
+    keys,
+    [&signals](const SvKey& key) { return Cmd::GetAllPowerForSV::create(key.system, key.svId, signals); },
+    [&table](size_t row, const CommandResultPtr& result) {
+      auto power = Cmd::GetAllPowerForSVResult::dynamicCast(result);
+      table.rows[row] = {power->nominalPower(), power->globalOffset()};
+      const auto signalPowers = power->signalPowerDict();
+      for (size_t signal = 0; signal < table.signals.size(); ++signal)
+      {
+        if (auto it = signalPowers.find(table.signals[signal]); it != signalPowers.end())
+          table.signalPowers[row * table.signals.size() + signal] = it->second;
+      }
+    },
+    table.valid);
+  return table;
+}
+
+SvTable<SvElevationAzimuth> queryElevationAzimuth(RemoteSimulator& simulator, const std::vector<SvKey>& keys)
+{
+  SvTable<SvElevationAzimuth> table;
+  table.keys = keys;
+  table.rows.resize(keys.size());
+
+  querySvs(
+    simulator,
+    keys,
+    [](const SvKey& key) { return Cmd::GetElevationAzimuthForSV::create(key.system, key.svId); },
+    [&table](size_t row, const CommandResultPtr& result) {
+      if (auto elevationAzimuth = Cmd::GetElevationAzimuthForSVResult::dynamicCast(result)->elevationAzimuth())
+        table.rows[row] = {elevationAzimuth->Elevation, elevationAzimuth->Azimuth};
+      else
+        table.valid[row] = 0;
+    },
+    table.valid);
+  return table;
+}
+
+SvTable<SvPseudorangeNoiseOffset> queryPseudorangeNoiseOffset(RemoteSimulator& simulator,
+                                                              const std::vector<SvKey>& keys)
+{
+  SvTable<SvPseudorangeNoiseOffset> table;
+  table.keys = keys;
+  table.rows.resize(keys.size());
+
+  querySvs(
+    simulator,
+    keys,
+    [](const SvKey& key) { return Cmd::GetPseudorangeNoiseOffsetForSV::create(key.system, key.svId); },
+    [&table](size_t row, const CommandResultPtr& result) {
+      auto offset = Cmd::GetPseudorangeNoiseOffsetForSVResult::dynamicCast(result);
+      table.rows[row] = {offset->enabled(), offset->offset()};
+    },
+    table.valid);
+  return table;
+}
+
+} // namespace Sdx
@@ -0,0 +1,89 @@
+#ifndef SV_QUERIES_H
+#define SV_QUERIES_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "command_result.h"
+#include "gen/SignalPower.h"
+
+namespace Sdx
+{
+
+class RemoteSimulator;
+
+struct SvKey
+{
+  std::string system;
+  int svId;
+};
+
+// Result of a query fanned out to many satellites: one row per key, in the order of the keys. The rows of the
+// satellites whose query failed (only when the simulator doesn't throw on error) are default initialized and not
+// valid.
+template<class Row>
+struct SvTable
+{
+  std::vector<SvKey> keys;
+  std::vector<Row> rows;
+  std::vector<uint8_t> valid;
+
+  inline size_t size() const { return rows.size(); }
+  inline bool isValid(size_t row) const { return valid[row] != 0; }
+};
+
+struct SvPower
+{
+  double nominalPower;
+  double globalOffset;
+};
+
+// Powers of the requested signals, signalPowers[row * signals.size() + signal index]
+struct SvPowerTable : SvTable<SvPower>
+{
+  std::vector<std::string> signals;
+  std::vector<Sdx::SignalPower> signalPowers;
+
+  inline const Sdx::SignalPower& signalPower(size_t row, size_t signal) const
+  {
+    return signalPowers[row * signals.size() + signal];
+  }
+};
+
+struct SvElevationAzimuth
+{
+  double elevation;
+  double azimuth;
+};
+
+struct SvPseudorangeNoiseOffset
+{
+  bool enabled;
+  double offset;
+};
+
+// Sends one query per key in a single write with RemoteSimulator::callBlob, the results being read while the queries
+// are written: a snapshot of N satellites costs one round trip instead of N. The fill function is called for every
+// successful result, with its row index.
+void querySvs(RemoteSimulator& simulator,
+              const std::vector<SvKey>& keys,
+              const std::function<CommandBasePtr(const SvKey& key)>& createQuery,
+              const std::function<void(size_t row, const CommandResultPtr& result)>& fill,
+              std::vector<uint8_t>& valid);
+
+// Visible satellites of every system, with a single round trip
+std::vector<SvKey> queryVisibleSvs(RemoteSimulator& simulator, const std::vector<std::string>& systems);
+
+SvPowerTable queryPower(RemoteSimulator& simulator,
+                        const std::vector<SvKey>& keys,
+                        const std::vector<std::string>& signals);
+// Rows of the satellites without elevation and azimuth (not in view) are not valid
+SvTable<SvElevationAzimuth> queryElevationAzimuth(RemoteSimulator& simulator, const std::vector<SvKey>& keys);
+SvTable<SvPseudorangeNoiseOffset> queryPseudorangeNoiseOffset(RemoteSimulator& simulator,
+                                                              const std::vector<SvKey>& keys);
+
+} // namespace Sdx
+
+#endif // SV_QUERIES_H
@@ -0,0 +1,233 @@
+#include "trace_recorder.h"
+
+#include <rapidjson/ostreamwrapper.h>
+#include <rapidjson/writer.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+
+namespace Sdx
+{
+
+// The sequence is odd while the event is written, then 2 * (index + 1) once published.
+struct TraceRecorder::Slot
+{
+  std::atomic<uint64_t> sequence {0};
+  TraceEvent event;
+};
+
+namespace
+{
+uint32_t currentThreadId()
+{
+  static std::atomic<uint32_t> nextId {1};
+  thread_local const uint32_t id = nextId.fetch_add(1, std::memory_order_relaxed);
+  return id;
+}
+} // namespace
+
+TraceRecorder& TraceRecorder::instance()
+{
+  static TraceRecorder uniqueInstance;
+  return uniqueInstance;
+}
+
+TraceRecorder::TraceRecorder() :
+  m_enabled(false),
+  m_buffer(nullptr),
+  m_mask(0),
+  m_next(0),
+  m_origin(std::chrono::steady_clock::now())
+{
+}
+
+TraceRecorder::~TraceRecorder() = default;
+
+void TraceRecorder::start(size_t capacity)
+{
+  std::lock_guard lock(m_startMutex);
+  if (!m_slots)
+  {
+    const size_t size = std::bit_ceil(std::max<size_t>(capacity, 2));
+    m_slots = std::make_unique<Slot[]>(size);
+    m_mask = size - 1;
+    m_buffer.store(m_slots.get(), std::memory_order_release);
+  }
+  m_enabled.store(true, std::memory_order_relaxed);
+}
+
+void TraceRecorder::stop()
+{
+  m_enabled.store(false, std::memory_order_relaxed);
+}
+
+void TraceRecorder::clear()
+{
+  std::lock_guard lock(m_startMutex);
+  if (!m_slots)
+    return;
+  for (size_t i = 0; i <= m_mask; ++i)
+    m_slots[i].sequence.store(0, std::memory_order_relaxed);
+  m_next.store(0, std::memory_order_release);
+}
+
+size_t TraceRecorder::eventCount() const
+{
+  const uint64_t next = m_next.load(std::memory_order_acquire);
+  return m_buffer.load(std::memory_order_acquire) ? static_cast<size_t>(std::min<uint64_t>(next, m_mask + 1)) : 0;
+}
+
+size_t TraceRecorder::droppedEventCount() const
+{
+  const uint64_t next = m_next.load(std::memory_order_acquire);
+  return next > m_mask + 1 ? static_cast<size_t>(next - m_mask - 1) : 0;
+}
+
+int64_t TraceRecorder::sinceOrigin(std::chrono::steady_clock::time_point time) const
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(time - m_origin).count();
+}
+
+void TraceRecorder::complete(const char* category,
+                             const char* name,
+                             std::chrono::steady_clock::time_point start,
+                             std::chrono::steady_clock::time_point end,
+                             std::string_view detail)
+{
+  TraceEvent event;
+  event.category = category;
+  event.name = name;
+  event.phase = 'X';
+  event.timestamp = sinceOrigin(start);
+  event.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  event.hasValue = false;
+  push(event, detail);
+}
+
+void TraceRecorder::instant(const char* category, const char* name, std::string_view detail)
+{
+  TraceEvent event;
+  event.category = category;
+  event.name = name;
+  event.phase = 'i';
+  event.timestamp = sinceOrigin(std::chrono::steady_clock::now());
+  event.duration = 0;
+  event.hasValue = false;
+  push(event, detail);
+}
+
+void TraceRecorder::instant(const char* category, const char* name, double value, std::string_view detail)
+{
+  TraceEvent event;
+  event.category = category;
+  event.name = name;
+  event.phase = 'i';
+  event.timestamp = sinceOrigin(std::chrono::steady_clock::now());
+  event.duration = 0;
+  event.value = value;
+  event.hasValue = true;
+  push(event, detail);
+}
+
+void TraceRecorder::push(TraceEvent& event, std::string_view detail)
+{
+  Slot* buffer = m_buffer.load(std::memory_order_acquire);
+  if (!buffer)
+    return;
+
+  event.threadId = currentThreadId();
+  const size_t detailSize = std::min(detail.size(), TraceEvent::MaxDetailSize);
+  memcpy(event.detail, detail.data(), detailSize);
+  event.detail[detailSize] = '\0';
+
+  const uint64_t index = m_next.fetch_add(1, std::memory_order_relaxed);
+  Slot& slot = buffer[index & m_mask];
+
+  // A writer a full buffer ahead may own the slot, the oldest of the two events is lost
+  uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+  if ((sequence & 1) || sequence > 2 * index ||
+      !slot.sequence.compare_exchange_strong(sequence, 2 * index + 1, std::memory_order_acquire))
+    return;
+  slot.event = event;
+  slot.sequence.store(2 * index + 2, std::memory_order_release);
+}
+
+bool TraceRecorder::writeChromeTrace(const std::string& path) const
+{
+  std::ofstream file(path);
+  if (!file)
+    return false;
+
+  rapidjson::OStreamWrapper stream(file);
+  rapidjson::Writer<rapidjson::OStreamWrapper> writer(stream);
+  writer.StartObject();
+  writer.Key("displayTimeUnit");
+  writer.String("ms");
+  writer.Key("traceEvents");
+  writer.StartArray();
+
+  const Slot* buffer = m_buffer.load(std::memory_order_acquire);
+  const uint64_t next = m_next.load(std::memory_order_acquire);
+  const uint64_t first = buffer && next > m_mask + 1 ? next - m_mask - 1 : 0;
+  for (uint64_t index = first; buffer && index < next; ++index)
+  {
+    const Slot& slot = buffer[index & m_mask];
+    const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if (sequence != 2 * index + 2)
+      continue;
+    const TraceEvent event = slot.event;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) != sequence)
+      continue;
+
+    writer.StartObject();
+    writer.Key("name");
+    writer.String(event.name);
+    writer.Key("cat");
+    writer.String(event.category);
+    writer.Key("ph");
+    writer.String(&event.phase, 1);
+    writer.Key("ts");
+    writer.Double(static_cast<double>(event.timestamp) / 1000.0);
+    if (event.phase == 'X')
+    {
+      writer.Key("dur");
+      writer.Double(static_cast<double>(event.duration) / 1000.0);
+    }
+    else
+    {
+      writer.Key("s");
+      writer.String("t");
+    }
+    writer.Key("pid");
+    writer.Int(1);
+    writer.Key("tid");
+    writer.Uint(event.threadId);
+    if (event.detail[0] != '\0' || event.hasValue)
+    {
+      writer.Key("args");
+      writer.StartObject();
+      if (event.detail[0] != '\0')
+      {
+        writer.Key("detail");
+        writer.String(event.detail);
+      }
+      if (event.hasValue)
+      {
+        writer.Key("value");
+        writer.Double(event.value);
+      }
+      writer.EndObject();
+    }
+    writer.EndObject();
+  }
+
+  writer.EndArray();
+  writer.EndObject();
+  file << std::endl;
+  return file.good();
+}
+
+} // namespace Sdx
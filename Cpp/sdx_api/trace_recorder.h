@@ -0,0 +1,119 @@
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace Sdx
+{
+
+struct TraceEvent
+{
+  static constexpr size_t MaxDetailSize = 63;
+
+  const char* category; // Static string
+  const char* name;     // Static string
+  char phase;           // 'X' complete event, 'i' instant event
+  uint32_t threadId;
+  int64_t timestamp; // ns since the recorder creation
+  int64_t duration;  // ns, complete events only
+  double value;
+  bool hasValue;
+  char detail[MaxDetailSize + 1];
+};
+
+// Process wide recorder of the command and HIL activity, exported in the Chrome trace event format (load the file in
+// chrome://tracing or ui.perfetto.dev).
+//
+// RemoteSimulator (post, wait, hilCheck), CmdClient (send, receive, parse) and HilClient (HIL push, VehicleInfo
+// receive) record events while the recorder is started. Events are written in a fixed size ring buffer without
+// locking, the oldest events are overwritten when it is full. When stopped, the instrumented code only checks a flag.
+class TraceRecorder
+{
+public:
+  static constexpr size_t DefaultCapacity = 1 << 18;
+
+  static TraceRecorder& instance();
+  ~TraceRecorder();
+
+  // The buffer is allocated by the first start, capacity is rounded up to a power of two and ignored afterward.
+  void start(size_t capacity = DefaultCapacity);
+  void stop();
+  inline bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+  // Discards the recorded events. Must not be called while started.
+  void clear();
+  size_t eventCount() const;
+  size_t droppedEventCount() const;
+
+  void complete(const char* category,
+                const char* name,
+                std::chrono::steady_clock::time_point start,
+                std::chrono::steady_clock::time_point end,
+                std::string_view detail = {});
+  void instant(const char* category, const char* name, std::string_view detail = {});
+  void instant(const char* category, const char* name, double value, std::string_view detail = {});
+
+  // Writes the recorded events, oldest first. Events being recorded during the write are skipped.
+  bool writeChromeTrace(const std::string& path) const;
+
+private:
+  TraceRecorder();
+  void push(TraceEvent& event, std::string_view detail);
+  int64_t sinceOrigin(std::chrono::steady_clock::time_point time) const;
+
+  struct Slot;
+
+  std::atomic<bool> m_enabled;
+  std::mutex m_startMutex;
+  std::unique_ptr<Slot[]> m_slots;
+  std::atomic<Slot*> m_buffer;
+  size_t m_mask;
+  std::atomic<uint64_t> m_next;
+  std::chrono::steady_clock::time_point m_origin;
+};
+
+// Records a complete event covering its lifetime if the TraceRecorder is started at construction. The detail (usually
+// a command name) must outlive the scope.
+class TraceScope
+{
+public:
+  inline TraceScope(const char* category, const char* name, std::string_view detail = {}) :
+    m_category(category),
+    m_name(name),
+    m_detail(detail),
+    m_active(TraceRecorder::instance().isEnabled())
+  {
+    if (m_active)
+      m_start = std::chrono::steady_clock::now();
+  }
+
+  inline ~TraceScope()
+  {
+    if (m_active)
+      TraceRecorder::instance().complete(m_category, m_name, m_start, std::chrono::steady_clock::now(), m_detail);
+  }
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+  inline void setDetail(std::string_view detail) { m_detail = detail; }
+  inline bool isActive() const { return m_active; }
+
+private:
+  const char* m_category;
+  const char* m_name;
+  std::string_view m_detail;
+  bool m_active;
+  std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace Sdx
+
+#endif // TRACE_RECORDER_H
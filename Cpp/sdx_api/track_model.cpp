@@ -0,0 +1,171 @@
+#include "track_model.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Sdx
+{
+
+namespace
+{
+// Velocity (per second) at node i from its neighbours, nodes times are in milliseconds
+double nodeSlope(const std::vector<double>& t, const std::vector<double>& p, size_t i)
+{
+  const size_t last = t.size() - 1;
+  if (i == 0)
+    return (p[1] - p[0]) / (t[1] - t[0]) * 1000.0;
+  if (i == last)
+    return (p[last] - p[last - 1]) / (t[last] - t[last - 1]) * 1000.0;
+
+  const double h0 = t[i] - t[i - 1];
+  const double h1 = t[i + 1] - t[i];
+  const double d0 = (p[i] - p[i - 1]) / h0;
+  const double d1 = (p[i + 1] - p[i]) / h1;
+  return (d0 * h1 + d1 * h0) / (h0 + h1) * 1000.0;
+}
+} // namespace
+
+TrackModel::TrackModel()
+{
+}
+
+TrackModel::TrackModel(std::span<const TrackNode> nodes)
+{
+  assign(nodes);
+}
+
+void TrackModel::assign(std::span<const TrackNode> nodes)
+{
+  for (size_t i = 1; i < nodes.size(); ++i)
+  {
+    if (nodes[i].elapsedTime <= nodes[i - 1].elapsedTime)
+      throw std::runtime_error("Track node times must be strictly increasing.");
+  }
+
+  clear();
+  const size_t count = nodes.size();
+  m_time.resize(count);
+  m_x.resize(count);
+  m_y.resize(count);
+  m_z.resize(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    m_time[i] = static_cast<double>(nodes[i].elapsedTime);
+    m_x[i] = nodes[i].position.x;
+    m_y[i] = nodes[i].position.y;
+    m_z[i] = nodes[i].position.z;
+  }
+
+  m_vx.assign(count, 0.0);
+  m_vy.assign(count, 0.0);
+  m_vz.assign(count, 0.0);
+  if (count < 2)
+    return;
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    m_vx[i] = nodeSlope(m_time, m_x, i);
+    m_vy[i] = nodeSlope(m_time, m_y, i);
+    m_vz[i] = nodeSlope(m_time, m_z, i);
+  }
+}
+
+void TrackModel::clear()
+{
+  m_time.clear();
+  m_x.clear();
+  m_y.clear();
+  m_z.clear();
+  m_vx.clear();
+  m_vy.clear();
+  m_vz.clear();
+}
+
+bool TrackModel::isEmpty() const
+{
+  return m_time.empty();
+}
+
+size_t TrackModel::size() const
+{
+  return m_time.size();
+}
+
+int TrackModel::startTime() const
+{
+  if (isEmpty())
+    throw std::runtime_error("Track model is empty.");
+  return static_cast<int>(m_time.front());
+}
+
+int TrackModel::endTime() const
+{
+  if (isEmpty())
+    throw std::runtime_error("Track model is empty.");
+  return static_cast<int>(m_time.back());
+}
+
+size_t TrackModel::segmentAt(double elapsedTime) const
+{
+  if (m_time.size() < 2 || elapsedTime <= m_time.front())
+    return 0;
+
+  auto it = std::upper_bound(m_time.begin(), m_time.end(), elapsedTime);
+  size_t index = static_cast<size_t>(it - m_time.begin()) - 1;
+  return std::min(index, m_time.size() - 2);
+}
+
+bool TrackModel::sampleAt(double elapsedTime, Ecef& position, Ecef& velocity) const
+{
+  if (isEmpty() || elapsedTime < m_time.front() || elapsedTime > m_time.back())
+    return false;
+
+  if (m_time.size() == 1)
+  {
+    position = Ecef(m_x[0], m_y[0], m_z[0]);
+    velocity.clear();
+    return true;
+  }
+
+  const size_t i = segmentAt(elapsedTime);
+  const double h = (m_time[i + 1] - m_time[i]) / 1000.0; // s
+  const double s = (elapsedTime - m_time[i]) / (m_time[i + 1] - m_time[i]);
+  const double s2 = s * s;
+  const double s3 = s2 * s;
+
+  // Cubic Hermite basis and derivatives
+  const double h00 = 2 * s3 - 3 * s2 + 1;
+  const double h10 = (s3 - 2 * s2 + s) * h;
+  const double h01 = -2 * s3 + 3 * s2;
+  const double h11 = (s3 - s2) * h;
+  const double d00 = (6 * s2 - 6 * s) / h;
+  const double d10 = 3 * s2 - 4 * s + 1;
+  const double d01 = (-6 * s2 + 6 * s) / h;
+  const double d11 = 3 * s2 - 2 * s;
+
+  position = Ecef(h00 * m_x[i] + h10 * m_vx[i] + h01 * m_x[i + 1] + h11 * m_vx[i + 1],
+                  h00 * m_y[i] + h10 * m_vy[i] + h01 * m_y[i + 1] + h11 * m_vy[i + 1],
+                  h00 * m_z[i] + h10 * m_vz[i] + h01 * m_z[i + 1] + h11 * m_vz[i + 1]);
+  velocity = Ecef(d00 * m_x[i] + d10 * m_vx[i] + d01 * m_x[i + 1] + d11 * m_vx[i + 1],
+                  d00 * m_y[i] + d10 * m_vy[i] + d01 * m_y[i + 1] + d11 * m_vy[i + 1],
+                  d00 * m_z[i] + d10 * m_vz[i] + d01 * m_z[i + 1] + d11 * m_vz[i + 1]);
+  return true;
+}
+
+bool TrackModel::positionAt(double elapsedTime, Ecef& position) const
+{
+  Ecef velocity;
+  return sampleAt(elapsedTime, position, velocity);
+}
+
+TrackNode TrackModel::node(size_t index) const
+{
+  return TrackNode {static_cast<int>(m_time.at(index)), Ecef(m_x[index], m_y[index], m_z[index])};
+}
+
+Ecef TrackModel::nodeVelocity(size_t index) const
+{
+  return Ecef(m_vx.at(index), m_vy[index], m_vz[index]);
+}
+
+} // namespace Sdx
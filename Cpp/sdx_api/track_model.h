@@ -0,0 +1,71 @@
+#ifndef TRACK_MODEL_H
+#define TRACK_MODEL_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "ecef.h"
+
+namespace Sdx
+{
+
+struct TrackNode
+{
+  int elapsedTime; // ms
+  Ecef position;
+};
+
+// Client-side copy of a track uploaded with RemoteSimulator::pushTrackEcef.
+//
+// Nodes are stored as structure of arrays with the velocity at every node precomputed, so the position and velocity
+// at any elapsed time are obtained with a binary search on the time index followed by a cubic Hermite interpolation.
+// Node velocities are estimated with a second order finite difference (first order at both ends of the track).
+//
+class TrackModel
+{
+public:
+  TrackModel();
+  explicit TrackModel(std::span<const TrackNode> nodes);
+
+  // Replaces the model with the given nodes. Node times must be strictly increasing.
+  void assign(std::span<const TrackNode> nodes);
+  void clear();
+
+  bool isEmpty() const;
+  size_t size() const;
+  int startTime() const; // ms
+  int endTime() const;   // ms
+
+  // Interpolates the track at the given elapsed time.
+  //
+  //  Parameter     Type      Units          Description
+  //  -----------------------------------------------------------------------------------------------
+  //  elapsedTime             milliseconds   Time since the beginning of the simulation.
+  //  position      x, y, z   m              Interpolated position of the vehicle.
+  //  velocity      x, y, z   m/s            Interpolated velocity of the vehicle.
+  //
+  // Returns false, leaving position and velocity untouched, if elapsedTime is outside of the track.
+  //
+  bool sampleAt(double elapsedTime, Ecef& position, Ecef& velocity) const;
+  bool positionAt(double elapsedTime, Ecef& position) const;
+
+  // Index of the node starting the segment containing elapsedTime, in O(log n).
+  size_t segmentAt(double elapsedTime) const;
+
+  TrackNode node(size_t index) const;
+  Ecef nodeVelocity(size_t index) const;
+
+private:
+  std::vector<double> m_time;
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<double> m_z;
+  std::vector<double> m_vx;
+  std::vector<double> m_vy;
+  std::vector<double> m_vz;
+};
+
+} // namespace Sdx
+
+#endif // TRACK_MODEL_H
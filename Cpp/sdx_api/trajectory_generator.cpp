@@ -0,0 +1,432 @@
+#include "trajectory_generator.h"
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+
+#include <stdexcept>
+
+#include "gps_constants.h"
+
+namespace Sdx
+{
+
+//
+// TrajectoryBlock
+//
+
+void TrajectoryBlock::resize(size_t count)
+{
+  for (std::vector<double>* v : {&time, &px, &py, &pz, &vx, &vy, &vz, &ax, &ay, &az, &jx, &jy, &jz})
+    v->resize(count);
+}
+
+Ecef TrajectoryBlock::position(size_t i) const
+{
+  return Ecef(px[i], py[i], pz[i]);
+}
+
+Ecef TrajectoryBlock::velocity(size_t i) const
+{
+  return Ecef(vx[i], vy[i], vz[i]);
+}
+
+Ecef TrajectoryBlock::acceleration(size_t i) const
+{
+  return Ecef(ax[i], ay[i], az[i]);
+}
+
+Ecef TrajectoryBlock::jerk(size_t i) const
+{
+  return Ecef(jx[i], jy[i], jz[i]);
+}
+
+//
+// LocalFrame
+//
+
+LocalFrame::LocalFrame(const Lla& origin) :
+  m_origin(origin),
+  m_originEcef(origin),
+  m_sinLat(sin(origin.lat)),
+  m_cosLat(cos(origin.lat)),
+  m_sinLon(sin(origin.lon)),
+  m_cosLon(cos(origin.lon))
+{
+}
+
+void LocalFrame::vectorsToEcef(double* e, double* n, double* u, size_t count) const
+{
+  const double xe = -m_sinLon, xn = -m_sinLat * m_cosLon, xu = m_cosLat * m_cosLon;
+  const double ye = m_cosLon, yn = -m_sinLat * m_sinLon, yu = m_cosLat * m_sinLon;
+  const double zn = m_cosLat, zu = m_sinLat;
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    const double de = e[i], dn = n[i], du = u[i];
+    e[i] = xe * de + xn * dn + xu * du;
+    n[i] = ye * de + yn * dn + yu * du;
+    u[i] = zn * dn + zu * du;
+  }
+}
+
+void LocalFrame::positionsToEcef(double* e, double* n, double* u, size_t count) const
+{
+  vectorsToEcef(e, n, u, count);
+
+  const double x0 = m_originEcef.x, y0 = m_originEcef.y, z0 = m_originEcef.z;
+  for (size_t i = 0; i < count; ++i)
+  {
+    e[i] += x0;
+    n[i] += y0;
+    u[i] += z0;
+  }
+}
+
+//
+// TrajectoryGenerator
+//
+
+void TrajectoryGenerator::generate(double startTime, double step, size_t count, TrajectoryBlock& block) const
+{
+  block.resize(count);
+  for (size_t i = 0; i < count; ++i)
+    block.time[i] = startTime + step * static_cast<double>(i);
+  generate(block);
+}
+
+//
+// LocalTrajectoryGenerator
+//
+
+LocalTrajectoryGenerator::LocalTrajectoryGenerator(const Lla& origin) : m_frame(origin)
+{
+}
+
+void LocalTrajectoryGenerator::generate(TrajectoryBlock& block) const
+{
+  const size_t count = block.size();
+
+  std::vector<double> seconds(count);
+  for (size_t i = 0; i < count; ++i)
+    seconds[i] = block.time[i] / 1000.0;
+
+  generateEnu(seconds.data(), count, block);
+
+  m_frame.positionsToEcef(block.px.data(), block.py.data(), block.pz.data(), count);
+  m_frame.vectorsToEcef(block.vx.data(), block.vy.data(), block.vz.data(), count);
+  m_frame.vectorsToEcef(block.ax.data(), block.ay.data(), block.az.data(), count);
+  m_frame.vectorsToEcef(block.jx.data(), block.jy.data(), block.jz.data(), count);
+}
+
+//
+// CircleGenerator
+//
+
+CircleGenerator::CircleGenerator(const Lla& origin, double radius, double speed) :
+  LocalTrajectoryGenerator(origin),
+  m_radius(radius),
+  m_speed(speed)
+{
+  if (radius <= 0)
+    throw std::runtime_error("Circle radius must be greater than zero.");
+}
+
+void CircleGenerator::generateEnu(const double* t, size_t count, TrajectoryBlock& block) const
+{
+  const double w = m_speed / m_radius;
+  const double r1 = m_radius * w;
+  const double r2 = r1 * w;
+  const double r3 = r2 * w;
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    const double c = cos(w * t[i]);
+    const double s = sin(w * t[i]);
+    block.px[i] = m_radius * c;
+    block.py[i] = m_radius * s;
+    block.pz[i] = 0.0;
+    block.vx[i] = -r1 * s;
+    block.vy[i] = r1 * c;
+    block.vz[i] = 0.0;
+    block.ax[i] = -r2 * c;
+    block.ay[i] = -r2 * s;
+    block.az[i] = 0.0;
+    block.jx[i] = r3 * s;
+    block.jy[i] = -r3 * c;
+    block.jz[i] = 0.0;
+  }
+}
+
+//
+// ClimbingSpiralGenerator
+//
+
+ClimbingSpiralGenerator::ClimbingSpiralGenerator(const Lla& origin, double radius, double speed, double climbRate) :
+  CircleGenerator(origin, radius, speed),
+  m_climbRate(climbRate)
+{
+}
+
+void ClimbingSpiralGenerator::generateEnu(const double* t, size_t count, TrajectoryBlock& block) const
+{
+  CircleGenerator::generateEnu(t, count, block);
+  for (size_t i = 0; i < count; ++i)
+  {
+    block.pz[i] = m_climbRate * t[i];
+    block.vz[i] = m_climbRate;
+  }
+}
+
+//
+// FigureEightGenerator
+//
+
+FigureEightGenerator::FigureEightGenerator(const Lla& origin, double halfWidth, double period) :
+  LocalTrajectoryGenerator(origin),
+  m_halfWidth(halfWidth),
+  m_omega(2.0 * M_PI / period)
+{
+  if (period <= 0)
+    throw std::runtime_error("Figure eight period must be greater than zero.");
+}
+
+void FigureEightGenerator::generateEnu(const double* t, size_t count, TrajectoryBlock& block) const
+{
+  // e = a sin(wt), n = a/2 sin(2wt)
+  const double a = m_halfWidth;
+  const double w = m_omega;
+  const double w2 = w * w;
+  const double w3 = w2 * w;
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    const double c = cos(w * t[i]);
+    const double s = sin(w * t[i]);
+    const double c2 = c * c - s * s;
+    const double s2 = 2.0 * s * c;
+    block.px[i] = a * s;
+    block.py[i] = 0.5 * a * s2;
+    block.pz[i] = 0.0;
+    block.vx[i] = a * w * c;
+    block.vy[i] = a * w * c2;
+    block.vz[i] = 0.0;
+    block.ax[i] = -a * w2 * s;
+    block.ay[i] = -2.0 * a * w2 * s2;
+    block.az[i] = 0.0;
+    block.jx[i] = -a * w3 * c;
+    block.jy[i] = -4.0 * a * w3 * c2;
+    block.jz[i] = 0.0;
+  }
+}
+
+//
+// RacetrackGenerator
+//
+
+RacetrackGenerator::RacetrackGenerator(const Lla& origin, double straightLength, double radius, double speed) :
+  LocalTrajectoryGenerator(origin),
+  m_straightLength(straightLength),
+  m_radius(radius),
+  m_speed(speed)
+{
+  if (radius <= 0 || straightLength < 0)
+    throw std::runtime_error("Racetrack radius must be greater than zero and its straight length positive.");
+}
+
+void RacetrackGenerator::generateEnu(const double* t, size_t count, TrajectoryBlock& block) const
+{
+  // Bottom straight heading east, right turn, top straight heading west, left turn
+  const double halfLength = m_straightLength / 2.0;
+  const double turnLength = M_PI * m_radius;
+  const double lapLength = 2.0 * m_straightLength + 2.0 * turnLength;
+  const double v = m_speed;
+  const double a = v * v / m_radius;
+  const double j = a * v / m_radius;
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    double d = fmod(v * t[i], lapLength);
+    if (d < 0)
+      d += lapLength;
+
+    block.pz[i] = block.vz[i] = block.az[i] = block.jz[i] = 0.0;
+    if (d < m_straightLength || (d >= m_straightLength + turnLength && d < 2.0 * m_straightLength + turnLength))
+    {
+      const bool bottom = d < m_straightLength;
+      const double sign = bottom ? 1.0 : -1.0;
+      const double along = bottom ? d : d - m_straightLength - turnLength;
+      block.px[i] = sign * (along - halfLength);
+      block.py[i] = -sign * m_radius;
+      block.vx[i] = sign * v;
+      block.vy[i] = 0.0;
+      block.ax[i] = block.ay[i] = block.jx[i] = block.jy[i] = 0.0;
+    }
+    else
+    {
+      const bool right = d < m_straightLength + turnLength;
+      const double center = right ? halfLength : -halfLength;
+      const double start = right ? -M_PI_2 : M_PI_2;
+      const double along = right ? d - m_straightLength : d - 2.0 * m_straightLength - turnLength;
+      const double phi = start + along / m_radius;
+      const double c = cos(phi);
+      const double s = sin(phi);
+      block.px[i] = center + m_radius * c;
+      block.py[i] = m_radius * s;
+      block.vx[i] = -v * s;
+      block.vy[i] = v * c;
+      block.ax[i] = -a * c;
+      block.ay[i] = -a * s;
+      block.jx[i] = j * s;
+      block.jy[i] = -j * c;
+    }
+  }
+}
+
+//
+// ConstantTurnGenerator
+//
+
+ConstantTurnGenerator::ConstantTurnGenerator(const Lla& origin,
+                                             double speed,
+                                             double heading,
+                                             double turnRate,
+                                             double climbRate) :
+  LocalTrajectoryGenerator(origin),
+  m_speed(speed),
+  m_heading(heading),
+  m_turnRate(turnRate),
+  m_climbRate(climbRate)
+{
+}
+
+void ConstantTurnGenerator::generateEnu(const double* t, size_t count, TrajectoryBlock& block) const
+{
+  const double v = m_speed;
+  const double r = m_turnRate;
+  const double sin0 = sin(m_heading);
+  const double cos0 = cos(m_heading);
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    const double heading = m_heading + r * t[i];
+    const double s = sin(heading);
+    const double c = cos(heading);
+    if (r == 0.0)
+    {
+      block.px[i] = v * t[i] * s;
+      block.py[i] = v * t[i] * c;
+    }
+    else
+    {
+      block.px[i] = v / r * (cos0 - c);
+      block.py[i] = v / r * (s - sin0);
+    }
+    block.pz[i] = m_climbRate * t[i];
+    block.vx[i] = v * s;
+    block.vy[i] = v * c;
+    block.vz[i] = m_climbRate;
+    block.ax[i] = v * r * c;
+    block.ay[i] = -v * r * s;
+    block.az[i] = 0.0;
+    block.jx[i] = -v * r * r * s;
+    block.jy[i] = -v * r * r * c;
+    block.jz[i] = 0.0;
+  }
+}
+
+//
+// KeplerOrbitGenerator
+//
+
+KeplerOrbitGenerator::KeplerOrbitGenerator(const OrbitalElements& elements) : m_elements(elements)
+{
+  if (elements.semiMajorAxis <= 0 || elements.eccentricity < 0 || elements.eccentricity >= 1)
+    throw std::runtime_error("Only elliptical orbits are supported.");
+
+  m_meanMotion = sqrt(GPS::GM / (elements.semiMajorAxis * elements.semiMajorAxis * elements.semiMajorAxis));
+
+  const double cosW = cos(elements.argumentOfPerigee), sinW = sin(elements.argumentOfPerigee);
+  const double cosO = cos(elements.rightAscension), sinO = sin(elements.rightAscension);
+  const double cosI = cos(elements.inclination), sinI = sin(elements.inclination);
+
+  m_p[0] = cosW * cosO - sinW * cosI * sinO;
+  m_p[1] = cosW * sinO + sinW * cosI * cosO;
+  m_p[2] = sinW * sinI;
+  m_q[0] = -sinW * cosO - cosW * cosI * sinO;
+  m_q[1] = -sinW * sinO + cosW * cosI * cosO;
+  m_q[2] = cosW * sinI;
+}
+
+void KeplerOrbitGenerator::generate(TrajectoryBlock& block) const
+{
+  const double a = m_elements.semiMajorAxis;
+  const double e = m_elements.eccentricity;
+  const double n = m_meanMotion;
+  const double b = a * sqrt(1.0 - e * e);
+  const double w = GPS::OMEGA_E;
+
+  for (size_t i = 0; i < block.size(); ++i)
+  {
+    const double dt = (block.time[i] - m_elements.referenceTime) / 1000.0;
+
+    // Eccentric anomaly
+    const double m = m_elements.meanAnomaly + n * dt;
+    double ea = m;
+    for (int k = 0; k < 10; ++k)
+    {
+      const double delta = (ea - e * sin(ea) - m) / (1.0 - e * cos(ea));
+      ea -= delta;
+      if (fabs(delta) < 1e-13)
+        break;
+    }
+    const double cosE = cos(ea), sinE = sin(ea);
+    const double eaDot = n / (1.0 - e * cosE);
+
+    // Position and velocity in the orbital plane, then in the frame aligned with ECEF at reference time
+    const double xp = a * (cosE - e), yp = b * sinE;
+    const double vxp = -a * sinE * eaDot, vyp = b * cosE * eaDot;
+    double r[3], v[3], acc[3], jerk[3];
+    for (int k = 0; k < 3; ++k)
+    {
+      r[k] = xp * m_p[k] + yp * m_q[k];
+      v[k] = vxp * m_p[k] + vyp * m_q[k];
+    }
+
+    const double radius = sqrt(r[0] * r[0] + r[1] * r[1] + r[2] * r[2]);
+    const double mu3 = GPS::GM / (radius * radius * radius);
+    const double rv = (r[0] * v[0] + r[1] * v[1] + r[2] * v[2]) / (radius * radius);
+    for (int k = 0; k < 3; ++k)
+    {
+      acc[k] = -mu3 * r[k];
+      jerk[k] = -mu3 * (v[k] - 3.0 * rv * r[k]);
+    }
+
+    // Rotating frame derivatives with w along z: D^n x = derivative of the ECEF vector expressed in the inertial frame
+    //   v' = v - w x r, a' = a - 2 w x v + w x w x r, j' = j - 3 w x a + 3 w x w x v - w x w x w x r
+    // where w x (x, y, z) = w (-y, x, 0) and w x w x (x, y, z) = -w² (x, y, 0)
+    const double w2 = w * w, w3 = w2 * w;
+    const double ve[3] = {v[0] + w * r[1], v[1] - w * r[0], v[2]};
+    const double ae[3] = {acc[0] + 2 * w * v[1] - w2 * r[0], acc[1] - 2 * w * v[0] - w2 * r[1], acc[2]};
+    const double je[3] = {jerk[0] + 3 * w * acc[1] - 3 * w2 * v[0] - w3 * r[1],
+                          jerk[1] - 3 * w * acc[0] - 3 * w2 * v[1] + w3 * r[0],
+                          jerk[2]};
+
+    // Earth rotation since reference
+    const double theta = w * dt;
+    const double c = cos(theta), s = sin(theta);
+    block.px[i] = c * r[0] + s * r[1];
+    block.py[i] = -s * r[0] + c * r[1];
+    block.pz[i] = r[2];
+    block.vx[i] = c * ve[0] + s * ve[1];
+    block.vy[i] = -s * ve[0] + c * ve[1];
+    block.vz[i] = ve[2];
+    block.ax[i] = c * ae[0] + s * ae[1];
+    block.ay[i] = -s * ae[0] + c * ae[1];
+    block.az[i] = ae[2];
+    block.jx[i] = c * je[0] + s * je[1];
+    block.jy[i] = -s * je[0] + c * je[1];
+    block.jz[i] = je[2];
+  }
+}
+
+} // namespace Sdx
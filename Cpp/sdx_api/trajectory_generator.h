@@ -0,0 +1,209 @@
+#ifndef TRAJECTORY_GENERATOR_H
+#define TRAJECTORY_GENERATOR_H
+
+#include <cstddef>
+#include <vector>
+
+#include "ecef.h"
+#include "lla.h"
+
+namespace Sdx
+{
+
+// Batch of trajectory samples stored as structure of arrays. All vectors are in the ECEF coordinate system.
+//
+//  Member         Units          Description
+//  ---------------------------------------------------------------
+//  time           milliseconds   Time since the beginning of the simulation.
+//  px, py, pz     m              Position.
+//  vx, vy, vz     m/s            Velocity.
+//  ax, ay, az     m/s²           Acceleration.
+//  jx, jy, jz     m/s³           Jerk.
+//
+struct TrajectoryBlock
+{
+  void resize(size_t count);
+  inline size_t size() const { return time.size(); }
+
+  Ecef position(size_t i) const;
+  Ecef velocity(size_t i) const;
+  Ecef acceleration(size_t i) const;
+  Ecef jerk(size_t i) const;
+
+  std::vector<double> time;
+  std::vector<double> px, py, pz;
+  std::vector<double> vx, vy, vz;
+  std::vector<double> ax, ay, az;
+  std::vector<double> jx, jy, jz;
+};
+
+// Local tangent plane (ENU) frame with its rotation to ECEF computed once.
+class LocalFrame
+{
+public:
+  explicit LocalFrame(const Lla& origin);
+
+  inline const Lla& origin() const { return m_origin; }
+
+  // In place conversion of count ENU positions to ECEF positions.
+  void positionsToEcef(double* e, double* n, double* u, size_t count) const;
+  // In place rotation of count ENU vectors (velocity, acceleration, ...) to ECEF.
+  void vectorsToEcef(double* e, double* n, double* u, size_t count) const;
+
+private:
+  Lla m_origin;
+  Ecef m_originEcef;
+  double m_sinLat;
+  double m_cosLat;
+  double m_sinLon;
+  double m_cosLon;
+};
+
+// Analytic trajectory producing position, velocity, acceleration and jerk in batches.
+class TrajectoryGenerator
+{
+public:
+  virtual ~TrajectoryGenerator() {}
+
+  // Fills block with count samples taken every step milliseconds from startTime milliseconds.
+  void generate(double startTime, double step, size_t count, TrajectoryBlock& block) const;
+
+  // Fills the kinematics of the block for the times already set in block.time.
+  virtual void generate(TrajectoryBlock& block) const = 0;
+};
+
+// Trajectory defined in the local ENU frame of an origin. Implementations fill the block vectors with ENU
+// coordinates, the conversion to ECEF is done for the whole block at once.
+class LocalTrajectoryGenerator : public TrajectoryGenerator
+{
+public:
+  explicit LocalTrajectoryGenerator(const Lla& origin);
+
+  using TrajectoryGenerator::generate;
+  void generate(TrajectoryBlock& block) const override;
+
+  inline const LocalFrame& frame() const { return m_frame; }
+
+protected:
+  // Fill the block vectors with ENU kinematics, t is in seconds.
+  virtual void generateEnu(const double* t, size_t count, TrajectoryBlock& block) const = 0;
+
+private:
+  LocalFrame m_frame;
+};
+
+// Circle around the origin at constant speed, counterclockwise starting east of the origin.
+class CircleGenerator : public LocalTrajectoryGenerator
+{
+public:
+  CircleGenerator(const Lla& origin, double radius, double speed);
+
+protected:
+  void generateEnu(const double* t, size_t count, TrajectoryBlock& block) const override;
+
+  double m_radius; // m
+  double m_speed;  // m/s
+};
+
+// Circle around the origin climbing (or descending) at a constant vertical rate.
+class ClimbingSpiralGenerator : public CircleGenerator
+{
+public:
+  ClimbingSpiralGenerator(const Lla& origin, double radius, double speed, double climbRate);
+
+protected:
+  void generateEnu(const double* t, size_t count, TrajectoryBlock& block) const override;
+
+private:
+  double m_climbRate; // m/s
+};
+
+// Lemniscate of Gerono centered on the origin, half width along the east axis and a full loop every period.
+class FigureEightGenerator : public LocalTrajectoryGenerator
+{
+public:
+  FigureEightGenerator(const Lla& origin, double halfWidth, double period);
+
+protected:
+  void generateEnu(const double* t, size_t count, TrajectoryBlock& block) const override;
+
+private:
+  double m_halfWidth; // m
+  double m_omega;     // rad/s
+};
+
+// Two straight lines along the east axis joined by half circles, driven counterclockwise at constant speed.
+class RacetrackGenerator : public LocalTrajectoryGenerator
+{
+public:
+  RacetrackGenerator(const Lla& origin, double straightLength, double radius, double speed);
+
+protected:
+  void generateEnu(const double* t, size_t count, TrajectoryBlock& block) const override;
+
+private:
+  double m_straightLength; // m
+  double m_radius;         // m
+  double m_speed;          // m/s
+};
+
+// Constant speed and turn rate starting at the origin. Heading is clockwise from north, a positive turn rate turns
+// right. A zero turn rate gives a straight line.
+class ConstantTurnGenerator : public LocalTrajectoryGenerator
+{
+public:
+  ConstantTurnGenerator(const Lla& origin, double speed, double heading, double turnRate, double climbRate = 0.0);
+
+protected:
+  void generateEnu(const double* t, size_t count, TrajectoryBlock& block) const override;
+
+private:
+  double m_speed;     // m/s
+  double m_heading;   // rad
+  double m_turnRate;  // rad/s
+  double m_climbRate; // m/s
+};
+
+// Keplerian elements, as returned by GetVehicleTrajectoryOrbit.
+//
+//  Name                Units   Description
+//  ------------------------------------------------------------------------------------------------------
+//  semiMajorAxis       m       Semi-major axis
+//  eccentricity                Eccentricity
+//  inclination         rad     Inclination angle
+//  rightAscension      rad     Geographic longitude of the ascending node of the orbital plane at reference
+//  argumentOfPerigee   rad     Argument of perigee
+//  meanAnomaly         rad     Mean anomaly at reference
+//  referenceTime       ms      Elapsed time at which the elements are given
+//
+struct OrbitalElements
+{
+  double semiMajorAxis;
+  double eccentricity;
+  double inclination;
+  double rightAscension;
+  double argumentOfPerigee;
+  double meanAnomaly;
+  double referenceTime = 0.0;
+};
+
+// Unperturbed two-body orbit, expressed in the rotating ECEF frame.
+class KeplerOrbitGenerator : public TrajectoryGenerator
+{
+public:
+  explicit KeplerOrbitGenerator(const OrbitalElements& elements);
+
+  using TrajectoryGenerator::generate;
+  void generate(TrajectoryBlock& block) const override;
+
+private:
+  OrbitalElements m_elements;
+  double m_meanMotion; // rad/s
+  // Orbital plane axes (perigee and its normal in the plane) in the frame aligned with ECEF at reference time
+  double m_p[3];
+  double m_q[3];
+};
+
+} // namespace Sdx
+
+#endif // TRAJECTORY_GENERATOR_H
@@ -0,0 +1,90 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Sdx
+{
+
+#ifdef _MSC_VER
+inline const void* volatile benchmarkSink = nullptr;
+#endif
+
+// Keeps the compiler from optimizing away a benchmarked computation: value is assumed to be read, and any memory
+// written.
+template<typename T>
+inline void doNotOptimize(const T& value)
+{
+#ifdef _MSC_VER
+  benchmarkSink = &value;
+  _ReadWriteBarrier();
+#else
+  asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
+
+struct BenchmarkResult
+{
+  std::string name;
+  uint64_t iterations;
+  double nsPerOp;
+};
+
+// Runs each benchmark in batches of growing size until the batch lasts at least the minimum time.
+class BenchmarkRunner
+{
+public:
+  BenchmarkRunner(double minTime, const std::string& filter) : m_minTime(minTime), m_filter(filter) {}
+
+  template<typename F>
+  void run(const std::string& name, F&& fct, double minTime = 0.0)
+  {
+    if (!m_filter.empty() && name.find(m_filter) == std::string::npos)
+      return;
+
+    using Clock = std::chrono::steady_clock;
+    const double targetTime = minTime > 0.0 ? minTime : m_minTime;
+    fct(); // warmup
+
+    uint64_t iterations = 1;
+    while (true)
+    {
+      auto start = Clock::now();
+      for (uint64_t i = 0; i < iterations; ++i)
+        fct();
+      const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+      if (elapsed >= targetTime || iterations >= (uint64_t(1) << 40))
+      {
+        m_results.push_back({name, iterations, elapsed * 1e9 / static_cast<double>(iterations)});
+        if (m_verbose)
+          std::cout << name << ": " << m_results.back().nsPerOp << " ns/op" << std::endl;
+        return;
+      }
+      iterations = elapsed > 0.0 ? std::max(iterations * 2, static_cast<uint64_t>(iterations * targetTime / elapsed))
+                                 : iterations * 10;
+    }
+  }
+
+  inline void setVerbose(bool verbose) { m_verbose = verbose; }
+  inline const std::vector<BenchmarkResult>& results() const { return m_results; }
+
+private:
+  double m_minTime;
+  std::string m_filter;
+  bool m_verbose {false};
+  std::vector<BenchmarkResult> m_results;
+};
+
+} // namespace Sdx
+
+#endif // BENCHMARK_H
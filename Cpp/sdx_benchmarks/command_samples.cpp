@@ -0,0 +1,167 @@
+#include "command_samples.h"
+
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <map>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+
+#include "command_factory.h"
+#include "command_result.h"
+
+namespace Sdx
+{
+
+namespace
+{
+std::string trim(const std::string& str)
+{
+  const size_t first = str.find_first_not_of(' ');
+  if (first == std::string::npos)
+    return "";
+  return str.substr(first, str.find_last_not_of(' ') - first + 1);
+}
+
+// Name -> Type from the documentation table
+std::map<std::string, std::string> documentedTypes(const std::string& documentation)
+{
+  std::vector<std::string> lines;
+  std::stringstream ss(documentation);
+  for (std::string line; std::getline(ss, line);)
+    lines.push_back(line);
+
+  std::map<std::string, std::string> types;
+  for (size_t i = 1; i < lines.size(); ++i)
+  {
+    if (lines[i].rfind("---", 0) != 0 || lines[i - 1].rfind("Name", 0) != 0)
+      continue;
+
+    const size_t nameWidth = lines[i].find(' ');
+    const size_t typeWidth = lines[i].find(' ', nameWidth + 1) - nameWidth - 1;
+    for (size_t row = i + 1; row < lines.size() && !trim(lines[row]).empty(); ++row)
+    {
+      const std::string name = trim(lines[row].substr(0, nameWidth));
+      if (!name.empty() && lines[row].size() > nameWidth)
+        types[name] = trim(lines[row].substr(nameWidth + 1, typeWidth));
+    }
+    break;
+  }
+  return types;
+}
+
+std::optional<rapidjson::Value> sampleValue(const std::string& type, rapidjson::Document::AllocatorType& alloc)
+{
+  using rapidjson::Value;
+
+  if (const size_t orPos = type.find(" or "); orPos != std::string::npos)
+    return sampleValue(type.substr(0, orPos), alloc);
+  if (type.rfind("optional ", 0) == 0)
+    return Value(rapidjson::kNullType);
+  if (type.rfind("array ", 0) == 0)
+  {
+    Value array(rapidjson::kArrayType);
+    if (auto element = sampleValue(type.substr(6), alloc))
+      array.PushBack(*element, alloc);
+    return array;
+  }
+  if (type.rfind("dict string:", 0) == 0)
+  {
+    Value dict(rapidjson::kObjectType);
+    if (auto element = sampleValue(type.substr(12), alloc))
+      dict.AddMember("Key", *element, alloc);
+    return dict;
+  }
+  if (type == "int")
+    return Value(1);
+  if (type == "double")
+    return Value(1.5);
+  if (type == "bool")
+    return Value(true);
+  if (type == "string")
+    return Value("Sample");
+  if (type == "date" || type == "datetime")
+  {
+    Value date(rapidjson::kObjectType);
+    date.AddMember("Year", 2021, alloc);
+    date.AddMember("Month", 6, alloc);
+    date.AddMember("Day", 1, alloc);
+    if (type == "datetime")
+    {
+      date.AddMember("Spec", "UTC", alloc);
+      date.AddMember("Hour", 12, alloc);
+      date.AddMember("Minute", 0, alloc);
+      date.AddMember("Second", 0, alloc);
+    }
+    return date;
+  }
+  // Enumerations are serialized as int, structures can't be guessed
+  if (!type.empty() && type[0] >= 'A' && type[0] <= 'Z')
+    return Value(0);
+  return {};
+}
+
+std::string serialize(const rapidjson::Document& doc)
+{
+  rapidjson::StringBuffer sb;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+  doc.Accept(writer);
+  return sb.GetString();
+}
+} // namespace
+
+std::vector<CommandSample> buildCommandSamples(std::vector<std::string>& skipped)
+{
+  CommandFactory* factory = CommandFactory::instance();
+  const CommandBasePtr getVersion = factory->createEmptyCommand("GetVersion");
+  if (!getVersion)
+    throw std::runtime_error("GetVersion is not registered, the results can't be sampled.");
+  const std::string relatedCommand = getVersion->toString();
+
+  std::vector<CommandSample> samples;
+  for (const std::string& name : factory->registeredNames())
+  {
+    CommandBasePtr cmd = factory->createEmptyCommand(name);
+    if (!cmd)
+    {
+      skipped.push_back(name);
+      continue;
+    }
+    const bool isResult = CommandResult::dynamicCast(cmd) != nullptr;
+    const auto types = documentedTypes(cmd->documentation());
+
+    rapidjson::Document doc;
+    doc.CopyFrom(cmd->values(), doc.GetAllocator());
+    bool complete = true;
+    for (const std::string& field : cmd->fieldNames())
+    {
+      auto type = types.find(field);
+      std::optional<rapidjson::Value> value;
+      if (type != types.end())
+        value = sampleValue(type->second, doc.GetAllocator());
+      if (!value)
+      {
+        complete = false;
+        break;
+      }
+      doc.AddMember(rapidjson::Value(field.c_str(), doc.GetAllocator()), *value, doc.GetAllocator());
+    }
+    if (isResult)
+      doc.AddMember(rapidjson::StringRef(CommandResult::RelatedCommand.c_str()),
+                    rapidjson::Value(relatedCommand.c_str(), doc.GetAllocator()),
+                    doc.GetAllocator());
+
+    CommandSample sample {name, isResult, serialize(doc)};
+    const bool valid = complete && (isResult ? factory->createCommandResult(sample.json) != nullptr
+                                             : factory->createCommand(sample.json) != nullptr);
+    if (valid)
+      samples.push_back(std::move(sample));
+    else
+      skipped.push_back(name);
+  }
+  return samples;
+}
+
+} // namespace Sdx
@@ -0,0 +1,24 @@
+#ifndef COMMAND_SAMPLES_H
+#define COMMAND_SAMPLES_H
+
+#include <string>
+#include <vector>
+
+namespace Sdx
+{
+
+struct CommandSample
+{
+  std::string name;
+  bool isResult;
+  std::string json; // Serialized valid instance
+};
+
+// Builds a valid serialized instance of every command and result registered in the CommandFactory, with values
+// derived from the type column of the command documentation. Commands for which no valid instance could be built
+// are listed in skipped.
+std::vector<CommandSample> buildCommandSamples(std::vector<std::string>& skipped);
+
+} // namespace Sdx
+
+#endif // COMMAND_SAMPLES_H
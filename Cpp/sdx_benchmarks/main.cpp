@@ -0,0 +1,334 @@
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "all_commands.h"
+#include "attitude.h"
+#include "benchmark.h"
+#include "command_factory.h"
+#include "command_samples.h"
+#include "command_template.h"
+#include "hil_client.h"
+#include "hil_helper.h"
+#include "track_model.h"
+#include "trajectory_generator.h"
+
+using namespace Sdx;
+using namespace Sdx::Cmd;
+
+namespace
+{
+struct Options
+{
+  double minTime {0.2};
+  double factoryMinTime {0.005};
+  std::string filter;
+  std::string jsonPath;
+  bool verbose {false};
+};
+
+void printUsage()
+{
+  std::cout << "Usage: sdx_benchmarks [--filter <substring>] [--min-time <s>] [--factory-min-time <s>] "
+               "[--json <file>] [--verbose]"
+            << std::endl;
+}
+
+bool parseOptions(int argc, char* argv[], Options& options)
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    const bool hasValue = i + 1 < argc;
+    if (arg == "--filter" && hasValue)
+      options.filter = argv[++i];
+    else if (arg == "--min-time" && hasValue)
+      options.minTime = std::stod(argv[++i]);
+    else if (arg == "--factory-min-time" && hasValue)
+      options.factoryMinTime = std::stod(argv[++i]);
+    else if (arg == "--json" && hasValue)
+      options.jsonPath = argv[++i];
+    else if (arg == "--verbose")
+      options.verbose = true;
+    else
+      return false;
+  }
+  return true;
+}
+
+// 181 x 361 (1 degree resolution) gain pattern, the typical large payload
+std::vector<std::vector<double>> antennaPattern()
+{
+  std::vector<std::vector<double>> gain(181, std::vector<double>(361));
+  for (size_t el = 0; el < gain.size(); ++el)
+    for (size_t az = 0; az < gain[el].size(); ++az)
+      gain[el][az] = -10.0 + 10.0 * std::cos(toRadian(static_cast<double>(el) - 90.0)) + 0.001 * az;
+  return gain;
+}
+
+void benchmarkCommands(BenchmarkRunner& runner)
+{
+  runner.run("command/construct/SetGpsStartTime", [] {
+    doNotOptimize(SetGpsStartTime::create(DateTime(2021, 6, 1, 12, 0, 0)));
+  });
+  runner.run("command/construct/SetVehicleAntennaGain", [] {
+    doNotOptimize(SetVehicleAntennaGain::create({{0.0}}, AntennaPatternType::Custom, GNSSBand::L1));
+  });
+
+  auto cmd = SetGpsStartTime::create(DateTime(2021, 6, 1, 12, 0, 0));
+  runner.run("command/generateUuid", [&] {
+    cmd->generateUuid();
+    doNotOptimize(cmd->uuid());
+  });
+  runner.run("command/toString/SetGpsStartTime", [&] { doNotOptimize(cmd->toString()); });
+
+  auto gain = SetVehicleAntennaGain::create(antennaPattern(), AntennaPatternType::Custom, GNSSBand::L1);
+  const std::string gainJson = gain->toString();
+  runner.run("command/toString/SetVehicleAntennaGain181x361", [&] { doNotOptimize(gain->toString()); });
+  runner.run("command/gain/SetVehicleAntennaGain181x361", [&] { doNotOptimize(gain->gain()); });
+  runner.run("factory/createCommand/SetVehicleAntennaGain181x361", [&] {
+    doNotOptimize(CommandFactory::instance()->createCommand(gainJson));
+  });
+
+  int time = 0;
+  runner.run("command/createAndToString/PushTrackEcef", [&] {
+    doNotOptimize(PushTrackEcef::create(time += 100, 1.0e6, -4.0e6, 4.5e6)->toString());
+  });
+  auto reused = PushTrackEcef::create(0, 0.0, 0.0, 0.0);
+  runner.run("command/renewAndToString/PushTrackEcef", [&] {
+    reused->renew();
+    reused->setTime(time += 100);
+    reused->setX(1.0e6);
+    reused->setY(-4.0e6);
+    reused->setZ(4.5e6);
+    doNotOptimize(reused->toString());
+  });
+  CommandTemplate pushTemplate(PushTrackEcef::create(0, 0.0, 0.0, 0.0), {"Time", "X", "Y", "Z"});
+  runner.run("template/render/PushTrackEcef", [&] {
+    pushTemplate.setInt(0, time += 100);
+    pushTemplate.setDouble(1, 1.0e6);
+    pushTemplate.setDouble(2, -4.0e6);
+    pushTemplate.setDouble(3, 4.5e6);
+    doNotOptimize(pushTemplate.render());
+  });
+}
+
+void benchmarkFactory(BenchmarkRunner& runner, double minTime)
+{
+  std::vector<std::string> skipped;
+  const std::vector<CommandSample> samples = buildCommandSamples(skipped);
+  std::cout << "Factory samples: " << samples.size() << " built, " << skipped.size() << " skipped" << std::endl;
+
+  CommandFactory* factory = CommandFactory::instance();
+  for (const CommandSample& sample : samples)
+  {
+    if (sample.isResult)
+      runner.run(
+        "factory/createCommandResult/" + sample.name,
+        [&] { doNotOptimize(factory->createCommandResult(sample.json)); },
+        minTime);
+    else
+      runner.run(
+        "factory/createCommand/" + sample.name,
+        [&] { doNotOptimize(factory->createCommand(sample.json)); },
+        minTime);
+  }
+}
+
+void benchmarkParseJson(BenchmarkRunner& runner)
+{
+  rapidjson::Document doc;
+  std::vector<double> values(100000);
+  for (size_t i = 0; i < values.size(); ++i)
+    values[i] = 0.5 * static_cast<double>(i);
+
+  runner.run("parse_json/format/vector<double>100k", [&] {
+    rapidjson::Document out;
+    doNotOptimize(parse_json<std::vector<double>>::format(values, out.GetAllocator()));
+  });
+  rapidjson::Value valuesJson = parse_json<std::vector<double>>::format(values, doc.GetAllocator());
+  runner.run("parse_json/is_valid/vector<double>100k",
+             [&] { doNotOptimize(parse_json<std::vector<double>>::is_valid(valuesJson)); });
+  runner.run("parse_json/parse/vector<double>100k",
+             [&] { doNotOptimize(parse_json<std::vector<double>>::parse(valuesJson)); });
+
+  using Matrix = std::vector<std::vector<double>>;
+  const Matrix matrix = antennaPattern();
+  runner.run("parse_json/format/matrix181x361", [&] {
+    rapidjson::Document out;
+    doNotOptimize(parse_json<Matrix>::format(matrix, out.GetAllocator()));
+  });
+  rapidjson::Value matrixJson = parse_json<Matrix>::format(matrix, doc.GetAllocator());
+  runner.run("parse_json/parse/matrix181x361", [&] { doNotOptimize(parse_json<Matrix>::parse(matrixJson)); });
+}
+
+#ifndef _WIN32
+// Measures the message encoding and the send syscall: the datagrams go to a local socket that never reads them.
+void benchmarkHil(BenchmarkRunner& runner)
+{
+  int sink = static_cast<int>(socket(AF_INET, SOCK_DGRAM, 0));
+  sockaddr_in addr {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t addrLen = sizeof(addr);
+  if (sink < 0 || bind(sink, reinterpret_cast<sockaddr*>(&addr), addrLen) < 0 ||
+      getsockname(sink, reinterpret_cast<sockaddr*>(&addr), &addrLen) < 0)
+  {
+    std::cout << "Skipping HIL benchmarks: unable to bind a local socket" << std::endl;
+    if (sink >= 0)
+      close(sink);
+    return;
+  }
+
+  HilClient hil(false);
+  if (hil.connectToHost("127.0.0.1", ntohs(addr.sin_port)))
+  {
+    const Ecef position(1.0e6, -4.0e6, 4.5e6);
+    const Ecef velocity(1.0, 2.0, 3.0);
+    const Attitude attitude(0.1, 0.2, 0.3);
+    double elapsedTime = 0.0;
+
+    runner.run("hil/pushEcef", [&] { doNotOptimize(hil.pushEcef(elapsedTime += 1.0, position)); });
+    runner.run("hil/pushEcef/velocity", [&] { doNotOptimize(hil.pushEcef(elapsedTime += 1.0, position, velocity)); });
+    runner.run("hil/pushEcef/velocity/named", [&] {
+      doNotOptimize(hil.pushEcef(elapsedTime += 1.0, position, velocity, "Jammer1"));
+    });
+    runner.run("hil/pushEcefNed", [&] { doNotOptimize(hil.pushEcefNed(elapsedTime += 1.0, position, attitude)); });
+    hil.disconnect();
+  }
+  close(sink);
+}
+#endif
+
+void benchmarkGeodesy(BenchmarkRunner& runner)
+{
+  const Lla origin(toRadian(45.0), toRadian(-74.0), 1.0);
+  Ecef ecef;
+  origin.toEcef(ecef);
+
+  runner.run("geodesy/Lla::toEcef", [&] {
+    Ecef out;
+    origin.toEcef(out);
+    doNotOptimize(out);
+  });
+  runner.run("geodesy/Ecef::toLla", [&] {
+    Lla out;
+    ecef.toLla(out);
+    doNotOptimize(out);
+  });
+  runner.run("geodesy/Lla::addEnu", [&] { doNotOptimize(origin.addEnu(Enu(10.0, 20.0, 1.0))); });
+
+  CircleTrajectory circle;
+  double elapsedTime = 0.0;
+  runner.run("trajectory/CircleTrajectory",
+             [&] { doNotOptimize(circle.generatePositionAndVelocityAt(elapsedTime += 1.0)); });
+
+  const CircleGenerator generator(origin, 10.0, 10.0);
+  TrajectoryBlock block;
+  runner.run("trajectory/CircleGenerator/block1000", [&] {
+    generator.generate(0.0, 1.0, 1000, block);
+    doNotOptimize(block);
+  });
+
+  std::vector<TrackNode> nodes(10000);
+  for (size_t i = 0; i < nodes.size(); ++i)
+  {
+    nodes[i].elapsedTime = static_cast<int>(i * 100);
+    nodes[i].position = std::get<0>(circle.generatePositionAndVelocityAt(nodes[i].elapsedTime));
+  }
+  const TrackModel track(nodes);
+  const double duration = track.endTime() - track.startTime();
+  double sampleTime = 0.0;
+  runner.run("track/TrackModel::sampleAt", [&] {
+    Ecef position, velocity;
+    sampleTime = std::fmod(sampleTime + 37.3, duration);
+    doNotOptimize(track.sampleAt(sampleTime, position, velocity));
+  });
+}
+
+void printResults(const std::vector<BenchmarkResult>& results)
+{
+  size_t width = 9;
+  for (const BenchmarkResult& result : results)
+    width = std::max(width, result.name.size());
+
+  std::cout << std::left << std::setw(static_cast<int>(width)) << "Benchmark" << std::right << std::setw(14)
+            << "Iterations" << std::setw(16) << "ns/op" << std::endl;
+  std::cout << std::string(width + 30, '-') << std::endl;
+  for (const BenchmarkResult& result : results)
+    std::cout << std::left << std::setw(static_cast<int>(width)) << result.name << std::right << std::setw(14)
+              << result.iterations << std::setw(16) << std::fixed << std::setprecision(1) << result.nsPerOp
+              << std::endl;
+}
+
+bool writeJson(const std::vector<BenchmarkResult>& results, const std::string& path)
+{
+  rapidjson::StringBuffer sb;
+  rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(sb);
+  writer.StartObject();
+  writer.Key("benchmarks");
+  writer.StartArray();
+  for (const BenchmarkResult& result : results)
+  {
+    writer.StartObject();
+    writer.Key("name");
+    writer.String(result.name.c_str());
+    writer.Key("iterations");
+    writer.Uint64(result.iterations);
+    writer.Key("ns_per_op");
+    writer.Double(result.nsPerOp);
+    writer.EndObject();
+  }
+  writer.EndArray();
+  writer.EndObject();
+
+  std::ofstream file(path);
+  file << sb.GetString() << std::endl;
+  return file.good();
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  Options options;
+  if (!parseOptions(argc, argv, options))
+  {
+    printUsage();
+    return 1;
+  }
+
+  BenchmarkRunner runner(options.minTime, options.filter);
+  runner.setVerbose(options.verbose);
+
+  benchmarkCommands(runner);
+  benchmarkFactory(runner, options.factoryMinTime);
+  benchmarkParseJson(runner);
+#ifndef _WIN32
+  benchmarkHil(runner);
+#endif
+  benchmarkGeodesy(runner);
+
+  printResults(runner.results());
+  if (!options.jsonPath.empty() && !writeJson(runner.results(), options.jsonPath))
+  {
+    std::cout << "Unable to write " << options.jsonPath << std::endl;
+    return 1;
+  }
+  return 0;
+}
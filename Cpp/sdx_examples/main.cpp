@@ -32,6 +32,7 @@
 #include "hil_helper.h"
 #include "lla.h"
 #include "remote_simulator.h"
+#include "sv_queries.h"
 #include "vehicle_info.h"
 
 using namespace Sdx;
@@ -1018,15 +1019,13 @@ void runExampleGetPower(const std::string& host, const std::string& targetType,
   std::cout << "==> Arming Simulation" << std::endl;
   sim.arm();
 
-  GetVisibleSVResultPtr visbiles = GetVisibleSVResult::dynamicCast(sim.call(GetVisibleSV::create("GPS")));
-  std::vector<int> svIds = visbiles->svId();
+  // The power of all the visible satellites is queried in a single round trip
+  std::vector<SvKey> svs = queryVisibleSvs(sim, {"GPS"});
+  SvPowerTable powers = queryPower(sim, svs, {"L1CA"});
 
-  for (int i = 0; i < static_cast<int>(svIds.size()); ++i)
+  for (size_t i = 0; i < powers.size(); ++i)
   {
-    GetAllPowerForSVResultPtr power = GetAllPowerForSVResult::dynamicCast(
-      sim.call(GetAllPowerForSV::create("GPS", svIds[i], {"L1CA"})));
-
-    std::cout << "SV ID " << svIds[i] << " received power: " << power->signalPowerDict().at("L1CA").Total << " dBm"
+    std::cout << "SV ID " << powers.keys[i].svId << " received power: " << powers.signalPower(i, 0).Total << " dBm"
               << std::endl;
   }
 
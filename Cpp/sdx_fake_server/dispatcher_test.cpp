@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Safran Trusted 4D Canada Inc.
+// Skydel - Software-Defined GNSS Simulator
+// Remote API C++ Fake Server
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Kills the fake server while several threads submit commands to a CommandDispatcher: every future must be resolved
+// without stopping the dispatcher, and the submits made afterward must fail.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "all_commands.h"
+#include "cmd_client.h"
+#include "command_dispatcher.h"
+#include "fake_server.h"
+
+using namespace Sdx;
+
+int main()
+{
+  constexpr int ThreadCount = 8;
+
+  FakeServer server;
+  if (!server.start(0))
+  {
+    std::cout << "Cannot start the fake server" << std::endl;
+    return 1;
+  }
+
+  CmdClient client(true);
+  if (!client.connectToHost("127.0.0.1", server.port()))
+  {
+    std::cout << "Cannot connect to the fake server" << std::endl;
+    return 1;
+  }
+
+  CommandDispatcher dispatcher(client);
+  std::mutex futuresMutex;
+  std::vector<std::shared_future<CommandResultPtr>> futures;
+  std::atomic<int> rejectedThreads {0};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < ThreadCount; ++i)
+  {
+    threads.emplace_back([&] {
+      try
+      {
+        while (true)
+        {
+          auto future = dispatcher.submit(Cmd::SetEngineLatency::create(1));
+          std::lock_guard lock(futuresMutex);
+          futures.push_back(std::move(future));
+        }
+      }
+      catch (const std::runtime_error&)
+      {
+        ++rejectedThreads;
+      }
+    });
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  server.stop();
+  for (std::thread& thread : threads)
+    thread.join();
+
+  int failures = 0;
+  if (rejectedThreads != ThreadCount)
+  {
+    std::cout << "Submits still accepted after the connection was lost" << std::endl;
+    ++failures;
+  }
+
+  size_t succeeded = 0;
+  size_t failed = 0;
+  for (const auto& future : futures)
+  {
+    if (future.wait_for(std::chrono::seconds(10)) != std::future_status::ready)
+    {
+      std::cout << "A command result is never resolved" << std::endl;
+      ++failures;
+      break;
+    }
+    try
+    {
+      future.get();
+      ++succeeded;
+    }
+    catch (const std::runtime_error&)
+    {
+      ++failed;
+    }
+  }
+  std::cout << futures.size() << " commands: " << succeeded << " succeeded, " << failed << " failed" << std::endl;
+
+  dispatcher.stop();
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,610 @@
+#include "fake_server.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+
+#include "all_commands.h"
+#include "cmd_client.h"
+#include "command_factory.h"
+#include "ecef.h"
+#include "hil_client.h"
+#include "lla.h"
+
+#define CMD_BLOCK_SIZE 65535
+#define HIL_BLOCK_SIZE 65535
+#define VEHICLE_INFO_SIZE 81
+
+namespace Sdx
+{
+
+namespace
+{
+bool readExact(int s, char* buffer, size_t length)
+{
+  while (length > 0)
+  {
+    ssize_t rx = recv(s, buffer, length, 0);
+    if (rx <= 0)
+      return false;
+    buffer += rx;
+    length -= static_cast<size_t>(rx);
+  }
+  return true;
+}
+
+bool writeExact(int s, const char* buffer, size_t length)
+{
+  while (length > 0)
+  {
+    ssize_t tx = send(s, buffer, length, MSG_NOSIGNAL);
+    if (tx <= 0)
+      return false;
+    buffer += tx;
+    length -= static_cast<size_t>(tx);
+  }
+  return true;
+}
+
+template<typename T>
+T readValue(const char*& ptr)
+{
+  T value;
+  memcpy(&value, ptr, sizeof(T));
+  ptr += sizeof(T);
+  return value;
+}
+
+Ecef readEcef(const char*& ptr)
+{
+  Ecef ecef;
+  ecef.x = readValue<double>(ptr);
+  ecef.y = readValue<double>(ptr);
+  ecef.z = readValue<double>(ptr);
+  return ecef;
+}
+
+template<typename T>
+void append(char*& ptr, const T& value)
+{
+  memcpy(ptr, &value, sizeof(T));
+  ptr += sizeof(T);
+}
+} // namespace
+
+struct FakeServer::Pimpl
+{
+  struct State
+  {
+    std::string name;
+    SimulatorState stateId;
+    SimulatorSubState subStateId;
+  };
+
+  std::atomic<bool> running {false};
+  bool verbose {false};
+  int apiVersion {Cmd::COMMANDS_API_VERSION};
+  LatencyModel latency;
+  std::map<std::string, Responder> responders;
+
+  int listenSocket {-1};
+  int hilSocket {-1};
+  int port {0};
+  int hilPort {0};
+  std::thread acceptThread;
+  std::thread hilThread;
+  std::list<std::thread> connectionThreads;
+  std::list<int> connectionSockets;
+  std::mutex connectionsMutex;
+
+  // Simulation state shared by all the connections
+  std::mutex stateMutex;
+  State state {"Ready", SimulatorState::StateIdle, SimulatorSubState::Idle_ConfigValid};
+  std::chrono::steady_clock::time_point startTime;
+  int trackNodes {0};
+  int routeNodes {0};
+  std::unordered_map<std::string, int> intTxTrackNodes;
+
+  // HIL
+  std::atomic<bool> vehicleInfoEnabled {false};
+  sockaddr_in hilPeer {};
+  bool hasHilPeer {false};
+  double odometer {0.0};
+  bool hasLastPosition {false};
+  Ecef lastPosition;
+
+  std::atomic<uint64_t> commandCount {0};
+  std::atomic<uint64_t> hilMessageCount {0};
+  std::atomic<uint64_t> vehicleInfoCount {0};
+
+  void acceptLoop();
+  void connectionLoop(int s);
+  void hilLoop();
+
+  void applyLatency(std::mt19937_64& random);
+  CommandResultPtr execute(const CommandBasePtr& cmd);
+  CommandResultPtr defaultResult(const CommandBasePtr& cmd);
+  void setState(const std::string& name, SimulatorState stateId, SimulatorSubState subStateId);
+  void handleHilMessage(const char* message, int length, const sockaddr_in& from);
+};
+
+FakeServer::FakeServer() : m(std::make_unique<Pimpl>())
+{
+}
+
+FakeServer::~FakeServer()
+{
+  stop();
+}
+
+bool FakeServer::start(int port, int hilPort)
+{
+  if (m->running)
+    return false;
+
+  m->listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+  m->hilSocket = socket(AF_INET, SOCK_DGRAM, 0);
+  if (m->listenSocket < 0 || m->hilSocket < 0)
+  {
+    stop();
+    return false;
+  }
+
+  int reuse = 1;
+  setsockopt(m->listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+  // Closing a datagram socket does not wake up recvfrom, the HIL thread polls the running flag instead
+  timeval timeout {0, 200000};
+  setsockopt(m->hilSocket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+  sockaddr_in addr {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(static_cast<uint16_t>(port));
+  if (bind(m->listenSocket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 || listen(m->listenSocket, 16) < 0)
+  {
+    std::cout << "Fake server: unable to listen on port " << port << std::endl;
+    stop();
+    return false;
+  }
+
+  addr.sin_port = htons(static_cast<uint16_t>(hilPort));
+  if (bind(m->hilSocket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0)
+  {
+    std::cout << "Fake server: unable to bind HIL port " << hilPort << std::endl;
+    stop();
+    return false;
+  }
+
+  socklen_t addrLength = sizeof(addr);
+  getsockname(m->listenSocket, reinterpret_cast<sockaddr*>(&addr), &addrLength);
+  m->port = ntohs(addr.sin_port);
+  addrLength = sizeof(addr);
+  getsockname(m->hilSocket, reinterpret_cast<sockaddr*>(&addr), &addrLength);
+  m->hilPort = ntohs(addr.sin_port);
+
+  m->running = true;
+  m->acceptThread = std::thread(&Pimpl::acceptLoop, m.get());
+  m->hilThread = std::thread(&Pimpl::hilLoop, m.get());
+  return true;
+}
+
+void FakeServer::stop()
+{
+  m->running = false;
+
+  if (m->listenSocket >= 0)
+  {
+    shutdown(m->listenSocket, SHUT_RDWR);
+    close(m->listenSocket);
+    m->listenSocket = -1;
+  }
+  if (m->acceptThread.joinable())
+    m->acceptThread.join();
+  if (m->hilThread.joinable())
+    m->hilThread.join();
+  if (m->hilSocket >= 0)
+  {
+    close(m->hilSocket);
+    m->hilSocket = -1;
+  }
+
+  std::list<std::thread> threads;
+  {
+    std::lock_guard<std::mutex> lock(m->connectionsMutex);
+    for (int s : m->connectionSockets)
+      shutdown(s, SHUT_RDWR);
+    threads.swap(m->connectionThreads);
+  }
+  for (std::thread& thread : threads)
+    thread.join();
+}
+
+bool FakeServer::isRunning() const
+{
+  return m->running;
+}
+
+int FakeServer::port() const
+{
+  return m->port;
+}
+
+int FakeServer::hilPort() const
+{
+  return m->hilPort;
+}
+
+void FakeServer::setApiVersion(int apiVersion)
+{
+  m->apiVersion = apiVersion;
+}
+
+void FakeServer::setLatencyModel(const LatencyModel& latency)
+{
+  m->latency = latency;
+}
+
+void FakeServer::setResponder(const std::string& cmdName, Responder responder)
+{
+  m->responders[cmdName] = std::move(responder);
+}
+
+void FakeServer::setVerbose(bool verbose)
+{
+  m->verbose = verbose;
+}
+
+uint64_t FakeServer::commandCount() const
+{
+  return m->commandCount;
+}
+
+uint64_t FakeServer::hilMessageCount() const
+{
+  return m->hilMessageCount;
+}
+
+uint64_t FakeServer::vehicleInfoCount() const
+{
+  return m->vehicleInfoCount;
+}
+
+void FakeServer::Pimpl::acceptLoop()
+{
+  while (running)
+  {
+    int s = accept(listenSocket, nullptr, nullptr);
+    if (s < 0)
+    {
+      if (!running)
+        return;
+      continue;
+    }
+
+    int noDelay = 1;
+    setsockopt(s, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    connectionSockets.push_back(s);
+    connectionThreads.emplace_back(&Pimpl::connectionLoop, this, s);
+  }
+}
+
+void FakeServer::Pimpl::connectionLoop(int s)
+{
+  if (verbose)
+    std::cout << "Fake server: client connected" << std::endl;
+
+  std::mt19937_64 random(static_cast<uint64_t>(s));
+  std::vector<char> message(CMD_BLOCK_SIZE + 2);
+  std::vector<char> answer(CMD_BLOCK_SIZE + 2);
+
+  while (running)
+  {
+    uint16_t size;
+    if (!readExact(s, reinterpret_cast<char*>(&size), 2) || !readExact(s, message.data(), size) || size < 1)
+      break;
+
+    const int msgId = static_cast<int>(message[0]);
+    if (msgId == CmdMsgId_ApiVersion)
+    {
+      char* ptr = answer.data();
+      append(ptr, static_cast<uint16_t>(5));
+      append(ptr, static_cast<char>(CmdMsgId_ApiVersion));
+      append(ptr, static_cast<uint32_t>(apiVersion));
+      if (!writeExact(s, answer.data(), 7))
+        break;
+      continue;
+    }
+    if (msgId != CmdMsgId_Command)
+      continue;
+
+    ++commandCount;
+    std::string json(&message[1], strnlen(&message[1], size - 1));
+    std::string errorMsg;
+    CommandBasePtr cmd = CommandFactory::instance()->createCommand(json, &errorMsg);
+    CommandResultPtr result;
+    if (cmd)
+    {
+      result = execute(cmd);
+    }
+    else
+    {
+      // The client fails to decode the related command and reports the error instead of waiting forever
+      if (verbose)
+        std::cout << "Fake server: " << errorMsg << std::endl;
+      result = Cmd::FailureResult::create(errorMsg);
+      rapidjson::Value related(rapidjson::StringRef(json.c_str(), json.size()));
+      result->setValue(CommandResult::RelatedCommand, related);
+    }
+
+    applyLatency(random);
+
+    const std::string resultJson = result->toString();
+    const size_t msgSize = resultJson.size() + 1 + 5;
+    if (msgSize > CMD_BLOCK_SIZE - 2)
+    {
+      std::cout << "Fake server: result of " << result->relatedCommand()->name() << " is too large" << std::endl;
+      continue;
+    }
+
+    char* ptr = answer.data();
+    append(ptr, static_cast<uint16_t>(msgSize));
+    append(ptr, static_cast<char>(CmdMsgId_Result));
+    append(ptr, static_cast<uint32_t>(0));
+    memcpy(ptr, resultJson.c_str(), resultJson.size() + 1);
+    if (!writeExact(s, answer.data(), msgSize + 2))
+      break;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    connectionSockets.remove(s);
+  }
+  close(s);
+
+  if (verbose)
+    std::cout << "Fake server: client disconnected" << std::endl;
+}
+
+void FakeServer::Pimpl::applyLatency(std::mt19937_64& random)
+{
+  auto delay = latency.fixed;
+  if (latency.jitter.count() > 0)
+    delay += std::chrono::microseconds(
+      std::uniform_int_distribution<int64_t>(0, latency.jitter.count())(random));
+  if (delay.count() > 0)
+    std::this_thread::sleep_for(delay);
+}
+
+void FakeServer::Pimpl::setState(const std::string& name, SimulatorState stateId, SimulatorSubState subStateId)
+{
+  state = State {name, stateId, subStateId};
+}
+
+CommandResultPtr FakeServer::Pimpl::execute(const CommandBasePtr& cmd)
+{
+  if (auto it = responders.find(cmd->name()); it != responders.end())
+  {
+    if (CommandResultPtr result = it->second(cmd))
+    {
+      result->setRelatedCommand(cmd);
+      return result;
+    }
+  }
+  return defaultResult(cmd);
+}
+
+CommandResultPtr FakeServer::Pimpl::defaultResult(const CommandBasePtr& cmd)
+{
+  const std::string& name = cmd->name();
+  std::lock_guard<std::mutex> lock(stateMutex);
+
+  if (name == "GetHilPort")
+    return Cmd::HilPortResult::create(cmd, hilPort);
+
+  if (name == "New" || name == "Open" || name == "Stop")
+  {
+    setState("Ready", SimulatorState::StateIdle, SimulatorSubState::Idle_ConfigValid);
+    vehicleInfoEnabled = name == "Stop" && vehicleInfoEnabled;
+  }
+  else if (name == "Arm" || name == "ArmPPS")
+  {
+    setState("Armed", SimulatorState::StateStarted, SimulatorSubState::Started_Armed);
+  }
+  else if (name == "Start" || name == "StartPPS")
+  {
+    setState("Streaming RF", SimulatorState::StateStarted, SimulatorSubState::Started_Streaming);
+    startTime = std::chrono::steady_clock::now();
+    odometer = 0.0;
+    hasLastPosition = false;
+  }
+  else if (name == "GetSimulatorState" || name == "WaitSimulatorState")
+  {
+    return Cmd::SimulatorStateResult::create(cmd, state.name, "", state.stateId, state.subStateId);
+  }
+  else if (name == "GetSimulationElapsedTime")
+  {
+    int elapsed = 0;
+    if (state.stateId == SimulatorState::StateStarted && state.subStateId == SimulatorSubState::Started_Streaming)
+      elapsed = static_cast<int>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count());
+    return Cmd::SimulationElapsedTimeResult::create(cmd, elapsed);
+  }
+  else if (name == "BeginVehicleInfo" || name == "EndVehicleInfo")
+  {
+    vehicleInfoEnabled = name == "BeginVehicleInfo";
+  }
+  else if (name == "BeginTrackDefinition")
+  {
+    trackNodes = 0;
+  }
+  else if (name == "PushTrackEcef" || name == "PushTrackEcefNed")
+  {
+    ++trackNodes;
+  }
+  else if (name == "EndTrackDefinition")
+  {
+    return Cmd::EndTrackDefinitionResult::create(cmd, trackNodes);
+  }
+  else if (name == "BeginRouteDefinition")
+  {
+    routeNodes = 0;
+  }
+  else if (name == "PushRouteEcef")
+  {
+    ++routeNodes;
+  }
+  else if (name == "EndRouteDefinition")
+  {
+    return Cmd::EndRouteDefinitionResult::create(cmd, routeNodes);
+  }
+  else if (name == "BeginIntTxTrackDefinition")
+  {
+    intTxTrackNodes[cmd->value("Id").GetString()] = 0;
+  }
+  else if (name == "PushIntTxTrackEcef" || name == "PushIntTxTrackEcefNed")
+  {
+    ++intTxTrackNodes[cmd->value("Id").GetString()];
+  }
+  else if (name == "EndIntTxTrackDefinition")
+  {
+    const std::string id = cmd->value("Id").GetString();
+    return Cmd::EndIntTxTrackDefinitionResult::create(cmd, intTxTrackNodes[id], id);
+  }
+
+  return Cmd::SuccessResult::create(cmd);
+}
+
+void FakeServer::Pimpl::hilLoop()
+{
+  std::vector<char> message(HIL_BLOCK_SIZE);
+  while (running)
+  {
+    sockaddr_in from {};
+    socklen_t fromLength = sizeof(from);
+    ssize_t rx = recvfrom(hilSocket, message.data(), message.size(), 0, reinterpret_cast<sockaddr*>(&from), &fromLength);
+    if (rx <= 0)
+    {
+      if (!running)
+        return;
+      continue;
+    }
+    ++hilMessageCount;
+    handleHilMessage(message.data(), static_cast<int>(rx), from);
+  }
+}
+
+void FakeServer::Pimpl::handleHilMessage(const char* message, int length, const sockaddr_in& from)
+{
+  const char* ptr = message;
+  const int msgId = static_cast<int>(readValue<char>(ptr));
+
+  switch (msgId)
+  {
+    case HilMsgId_Hello:
+      hilPeer = from;
+      hasHilPeer = true;
+      return;
+    case HilMsgId_Bye:
+      hasHilPeer = false;
+      return;
+    case HilMsgId_PushEcef:
+    case HilMsgId_PushEcefNed:
+    case HilMsgId_PushEcefDynamics:
+    case HilMsgId_PushEcefNedDynamics:
+      break;
+    default:
+      return;
+  }
+
+  if (!vehicleInfoEnabled || !hasHilPeer)
+    return;
+
+  const bool hasDynamics = msgId == HilMsgId_PushEcefDynamics || msgId == HilMsgId_PushEcefNedDynamics;
+  const bool hasAttitude = msgId == HilMsgId_PushEcefNed || msgId == HilMsgId_PushEcefNedDynamics;
+  const int minimumLength = 1 + (hasDynamics ? 1 : 0) + 8 + 24 + (hasAttitude ? 24 : 0) + (hasDynamics ? 24 : 0);
+  if (length < minimumLength)
+    return;
+
+  const int dynamics = hasDynamics ? static_cast<int>(readValue<char>(ptr)) : -1;
+  const double elapsedTime = readValue<double>(ptr);
+  const Ecef position = readEcef(ptr);
+  double attitude[3] = {0, 0, 0};
+  if (hasAttitude)
+  {
+    for (double& angle : attitude)
+      angle = readValue<double>(ptr);
+  }
+  Ecef velocity;
+  if (hasDynamics)
+    velocity = readEcef(ptr);
+
+  // Skip the remaining dynamics, only the vehicle positions are echoed, not the jammers ones
+  const int vectorsPerOrder = hasAttitude ? 2 : 1;
+  ptr += (hasDynamics ? (dynamics + 1) * vectorsPerOrder - 1 : 0) * 24;
+  if (ptr + 4 <= message + length)
+  {
+    if (readValue<unsigned int>(ptr) != 0)
+      return;
+  }
+
+  std::lock_guard<std::mutex> lock(stateMutex);
+  if (hasLastPosition)
+  {
+    const double dx = position.x - lastPosition.x;
+    const double dy = position.y - lastPosition.y;
+    const double dz = position.z - lastPosition.z;
+    odometer += std::sqrt(dx * dx + dy * dy + dz * dz);
+  }
+  lastPosition = position;
+  hasLastPosition = true;
+
+  double heading = 0.0;
+  if (hasDynamics)
+  {
+    Lla lla;
+    position.toLla(lla);
+    const double ve = -std::sin(lla.lon) * velocity.x + std::cos(lla.lon) * velocity.y;
+    const double vn = -std::sin(lla.lat) * std::cos(lla.lon) * velocity.x -
+                      std::sin(lla.lat) * std::sin(lla.lon) * velocity.y + std::cos(lla.lat) * velocity.z;
+    heading = std::atan2(ve, vn);
+  }
+  const double speed =
+    std::sqrt(velocity.x * velocity.x + velocity.y * velocity.y + velocity.z * velocity.z) * 3.6; // km/h
+
+  char info[VEHICLE_INFO_SIZE];
+  char* out = info;
+  append(out, static_cast<char>(HilMsgId_VehicleInfo));
+  append(out, static_cast<uint64_t>(std::llround(elapsedTime)));
+  append(out, position.x);
+  append(out, position.y);
+  append(out, position.z);
+  append(out, attitude[0]);
+  append(out, attitude[1]);
+  append(out, attitude[2]);
+  append(out, speed);
+  append(out, heading);
+  append(out, odometer);
+
+  if (sendto(hilSocket, info, VEHICLE_INFO_SIZE, 0, reinterpret_cast<const sockaddr*>(&hilPeer), sizeof(hilPeer)) ==
+      VEHICLE_INFO_SIZE)
+    ++vehicleInfoCount;
+}
+
+} // namespace Sdx
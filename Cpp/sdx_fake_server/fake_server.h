@@ -0,0 +1,64 @@
+#ifndef FAKE_SERVER_H
+#define FAKE_SERVER_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "command_base.h"
+
+namespace Sdx
+{
+
+// Processing delay applied by the fake server before answering each command: fixed + uniform random [0, jitter].
+struct LatencyModel
+{
+  std::chrono::microseconds fixed {0};
+  std::chrono::microseconds jitter {0};
+};
+
+// Local stand-in for the Skydel command and HIL servers.
+//
+// Speaks the CmdClient TCP framing (API version handshake, commands and results) and the HilClient UDP protocol,
+// so CmdClient, HilClient and RemoteSimulator can be exercised without a running simulator. Every command received
+// is decoded with the CommandFactory and answered with a SuccessResult, unless a responder is registered for its
+// name. Built-in responders cover the commands RemoteSimulator depends on (GetHilPort, simulator states, track and
+// route definitions, elapsed time). HIL positions are echoed back as VehicleInfo between BeginVehicleInfo and
+// EndVehicleInfo.
+class FakeServer
+{
+public:
+  using Responder = std::function<CommandResultPtr(const CommandBasePtr& cmd)>;
+
+  FakeServer();
+  ~FakeServer();
+
+  // Listens for commands on port and for HIL datagrams on hilPort (0 picks a free port).
+  bool start(int port = 4820, int hilPort = 0);
+  void stop();
+  bool isRunning() const;
+
+  int port() const;
+  int hilPort() const;
+
+  void setApiVersion(int apiVersion);
+  void setLatencyModel(const LatencyModel& latency);
+
+  // The responder result replaces the default answer for the command name. Must be set before start.
+  void setResponder(const std::string& cmdName, Responder responder);
+  void setVerbose(bool verbose);
+
+  uint64_t commandCount() const;
+  uint64_t hilMessageCount() const;
+  uint64_t vehicleInfoCount() const;
+
+private:
+  struct Pimpl;
+  std::unique_ptr<Pimpl> m;
+};
+
+} // namespace Sdx
+
+#endif // FAKE_SERVER_H
@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Safran Trusted 4D Canada Inc.
+// Skydel - Software-Defined GNSS Simulator
+// Remote API C++ Fake Server
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Stand-in for Skydel to run the remote API clients and benchmarks without a simulator.
+// Every command is answered with a SuccessResult (or the minimal typed result RemoteSimulator expects) and HIL
+// positions are echoed back as vehicle info.
+//
+// Usage: sdx_fake_server [--port 4820] [--instances 1] [--latency-us 0] [--jitter-us 0] [--verbose]
+//        Instance i listens on port + i, like RemoteSimulator::connect(ip, id).
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fake_server.h"
+
+using namespace Sdx;
+
+static std::atomic<bool> stopRequested {false};
+
+void onSignal(int)
+{
+  stopRequested = true;
+}
+
+int main(int argc, char* argv[])
+{
+  int port = 4820;
+  int instances = 1;
+  LatencyModel latency;
+  bool verbose = false;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    const bool hasValue = i + 1 < argc;
+    if (arg == "--port" && hasValue)
+      port = std::stoi(argv[++i]);
+    else if (arg == "--instances" && hasValue)
+      instances = std::stoi(argv[++i]);
+    else if (arg == "--latency-us" && hasValue)
+      latency.fixed = std::chrono::microseconds(std::stoll(argv[++i]));
+    else if (arg == "--jitter-us" && hasValue)
+      latency.jitter = std::chrono::microseconds(std::stoll(argv[++i]));
+    else if (arg == "--verbose")
+      verbose = true;
+    else
+    {
+      std::cout << "Usage: " << argv[0]
+                << " [--port 4820] [--instances 1] [--latency-us 0] [--jitter-us 0] [--verbose]" << std::endl;
+      return 1;
+    }
+  }
+
+  std::vector<std::unique_ptr<FakeServer>> servers;
+  for (int id = 0; id < instances; ++id)
+  {
+    auto server = std::make_unique<FakeServer>();
+    server->setVerbose(verbose);
+    server->setLatencyModel(latency);
+    if (!server->start(port + id))
+      return 1;
+    std::cout << "Instance " << id << " listening on port " << server->port() << ", HIL port " << server->hilPort()
+              << std::endl;
+    servers.push_back(std::move(server));
+  }
+
+  std::signal(SIGINT, onSignal);
+  std::signal(SIGTERM, onSignal);
+  while (!stopRequested)
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  for (size_t id = 0; id < servers.size(); ++id)
+  {
+    servers[id]->stop();
+    std::cout << "Instance " << id << ": " << servers[id]->commandCount() << " commands, "
+              << servers[id]->hilMessageCount() << " HIL messages, " << servers[id]->vehicleInfoCount()
+              << " vehicle infos" << std::endl;
+  }
+  return 0;
+}